@@ -24,6 +24,7 @@
 #include "util/hash.h"
 #include "util/log.h"
 #include "util/math.h"
+#include "util/tbb.h"
 
 #include "mikktspace.hh"
 
@@ -851,10 +852,16 @@ static void create_mesh(Scene *scene,
   }
   mesh->resize_mesh(positions.size(), numtris);
 
+  /* Grain size for the per element copies below, large meshes are converted in parallel. */
+  static const int ELEMENTS_PER_TASK = 4096;
+
   float3 *verts = mesh->get_verts().data();
-  for (const int i : positions.index_range()) {
-    verts[i] = make_float3(positions[i][0], positions[i][1], positions[i][2]);
-  }
+  parallel_for(blocked_range<size_t>(0, positions.size(), ELEMENTS_PER_TASK),
+               [&](const blocked_range<size_t> &r) {
+                 for (size_t i = r.begin(); i != r.end(); i++) {
+                   verts[i] = make_float3(positions[i][0], positions[i][1], positions[i][2]);
+                 }
+               });
 
   AttributeSet &attributes = (subdivision) ? mesh->subd_attributes : mesh->attributes;
   Attribute *attr_N = attributes.add(ATTR_STD_VERTEX_NORMAL);
@@ -862,9 +869,13 @@ static void create_mesh(Scene *scene,
 
   if (subdivision || !(use_corner_normals && !corner_normals.is_empty())) {
     const blender::Span<blender::float3> vert_normals = b_mesh.vert_normals();
-    for (const int i : vert_normals.index_range()) {
-      N[i] = make_float3(vert_normals[i][0], vert_normals[i][1], vert_normals[i][2]);
-    }
+    parallel_for(blocked_range<size_t>(0, vert_normals.size(), ELEMENTS_PER_TASK),
+                 [&](const blocked_range<size_t> &r) {
+                   for (size_t i = r.begin(); i != r.end(); i++) {
+                     N[i] = make_float3(
+                         vert_normals[i][0], vert_normals[i][1], vert_normals[i][2]);
+                   }
+                 });
   }
 
   const set<ustring> blender_uv_names = get_blender_uv_names(b_mesh);
@@ -912,18 +923,24 @@ static void create_mesh(Scene *scene,
     int *shader = mesh->get_shader().data();
 
     const blender::Span<blender::int3> corner_tris = b_mesh.corner_tris();
-    for (const int i : corner_tris.index_range()) {
-      const blender::int3 &tri = corner_tris[i];
-      triangles[i * 3 + 0] = corner_verts[tri[0]];
-      triangles[i * 3 + 1] = corner_verts[tri[1]];
-      triangles[i * 3 + 2] = corner_verts[tri[2]];
-    }
+    parallel_for(blocked_range<size_t>(0, corner_tris.size(), ELEMENTS_PER_TASK),
+                 [&](const blocked_range<size_t> &r) {
+                   for (size_t i = r.begin(); i != r.end(); i++) {
+                     const blender::int3 &tri = corner_tris[i];
+                     triangles[i * 3 + 0] = corner_verts[tri[0]];
+                     triangles[i * 3 + 1] = corner_verts[tri[1]];
+                     triangles[i * 3 + 2] = corner_verts[tri[2]];
+                   }
+                 });
 
     if (!material_indices.is_empty()) {
       const blender::Span<int> tri_faces = b_mesh.corner_tri_faces();
-      for (const int i : corner_tris.index_range()) {
-        shader[i] = clamp_material_index(material_indices[tri_faces[i]]);
-      }
+      parallel_for(blocked_range<size_t>(0, corner_tris.size(), ELEMENTS_PER_TASK),
+                   [&](const blocked_range<size_t> &r) {
+                     for (size_t i = r.begin(); i != r.end(); i++) {
+                       shader[i] = clamp_material_index(material_indices[tri_faces[i]]);
+                     }
+                   });
     }
     else {
       std::fill(shader, shader + numtris, 0);
@@ -931,9 +948,12 @@ static void create_mesh(Scene *scene,
 
     if (!sharp_faces.is_empty() && !(use_corner_normals && !corner_normals.is_empty())) {
       const blender::Span<int> tri_faces = b_mesh.corner_tri_faces();
-      for (const int i : corner_tris.index_range()) {
-        smooth[i] = !sharp_faces[tri_faces[i]];
-      }
+      parallel_for(blocked_range<size_t>(0, corner_tris.size(), ELEMENTS_PER_TASK),
+                   [&](const blocked_range<size_t> &r) {
+                     for (size_t i = r.begin(); i != r.end(); i++) {
+                       smooth[i] = !sharp_faces[tri_faces[i]];
+                     }
+                   });
     }
     else {
       /* If only face normals are needed, all faces are sharp. */
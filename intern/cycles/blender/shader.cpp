@@ -275,6 +275,54 @@ static bool is_image_animated(BL::Image::source_enum b_image_source, BL::ImageUs
          b_image_user.use_auto_refresh();
 }
 
+/* Check whether the node tree, including nested groups, references an image which is re-read
+ * when the animation frame changes. */
+static bool node_tree_has_animated_image(BL::ShaderNodeTree b_ntree)
+{
+  for (BL::Node &b_node : b_ntree.nodes) {
+    if (b_node.mute()) {
+      continue;
+    }
+
+    if (b_node.is_a(&RNA_ShaderNodeTexImage)) {
+      BL::ShaderNodeTexImage b_image_node(b_node);
+      BL::Image b_image(b_image_node.image());
+      BL::ImageUser b_image_user(b_image_node.image_user());
+      if (b_image && is_image_animated(b_image.source(), b_image_user)) {
+        return true;
+      }
+    }
+    else if (b_node.is_a(&RNA_ShaderNodeTexEnvironment)) {
+      BL::ShaderNodeTexEnvironment b_env_node(b_node);
+      BL::Image b_image(b_env_node.image());
+      BL::ImageUser b_image_user(b_env_node.image_user());
+      if (b_image && is_image_animated(b_image.source(), b_image_user)) {
+        return true;
+      }
+    }
+    else if (b_node.is_a(&RNA_ShaderNodeGroup) || b_node.is_a(&RNA_NodeCustomGroup) ||
+             b_node.is_a(&RNA_ShaderNodeCustomGroup))
+    {
+      BL::ShaderNodeTree b_group_ntree(PointerRNA_NULL);
+      if (b_node.is_a(&RNA_ShaderNodeGroup)) {
+        b_group_ntree = BL::ShaderNodeTree(((BL::NodeGroup)(b_node)).node_tree());
+      }
+      else if (b_node.is_a(&RNA_NodeCustomGroup)) {
+        b_group_ntree = BL::ShaderNodeTree(((BL::NodeCustomGroup)(b_node)).node_tree());
+      }
+      else {
+        b_group_ntree = BL::ShaderNodeTree(((BL::ShaderNodeCustomGroup)(b_node)).node_tree());
+      }
+
+      if (b_group_ntree && node_tree_has_animated_image(b_group_ntree)) {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
 static ShaderNode *add_node(Scene *scene,
                             BL::RenderEngine &b_engine,
                             BL::BlendData &b_data,
@@ -1566,7 +1614,7 @@ bool BlenderSync::scene_attr_needs_recalc(Shader *shader, BL::Depsgraph &b_depsg
 
 /* Sync Materials */
 
-void BlenderSync::sync_materials(BL::Depsgraph &b_depsgraph, bool update_all)
+void BlenderSync::sync_materials(BL::Depsgraph &b_depsgraph, bool auto_refresh_update)
 {
   shader_map.set_default(scene->default_surface);
 
@@ -1582,7 +1630,9 @@ void BlenderSync::sync_materials(BL::Depsgraph &b_depsgraph, bool update_all)
     Shader *shader;
 
     /* test if we need to sync */
-    if (shader_map.add_or_update(&shader, b_mat) || update_all ||
+    if (shader_map.add_or_update(&shader, b_mat) ||
+        (auto_refresh_update && b_mat.use_nodes() && b_mat.node_tree() &&
+         node_tree_has_animated_image(BL::ShaderNodeTree(b_mat.node_tree()))) ||
         scene_attr_needs_recalc(shader, b_depsgraph))
     {
       unique_ptr<ShaderGraph> graph = make_unique<ShaderGraph>();
@@ -1653,7 +1703,9 @@ void BlenderSync::sync_materials(BL::Depsgraph &b_depsgraph, bool update_all)
 
 /* Sync World */
 
-void BlenderSync::sync_world(BL::Depsgraph &b_depsgraph, BL::SpaceView3D &b_v3d, bool update_all)
+void BlenderSync::sync_world(BL::Depsgraph &b_depsgraph,
+                             BL::SpaceView3D &b_v3d,
+                             bool auto_refresh_update)
 {
   Background *background = scene->background;
   Integrator *integrator = scene->integrator;
@@ -1665,7 +1717,10 @@ void BlenderSync::sync_world(BL::Depsgraph &b_depsgraph, BL::SpaceView3D &b_v3d,
 
   Shader *shader = scene->default_background;
 
-  if (world_recalc || update_all || b_world.ptr.data != world_map ||
+  if (world_recalc ||
+      (auto_refresh_update && b_world && b_world.use_nodes() && b_world.node_tree() &&
+       node_tree_has_animated_image(BL::ShaderNodeTree(b_world.node_tree()))) ||
+      b_world.ptr.data != world_map ||
       viewport_parameters.shader_modified(new_viewport_parameters) ||
       scene_attr_needs_recalc(shader, b_depsgraph))
   {
@@ -1813,7 +1868,7 @@ void BlenderSync::sync_world(BL::Depsgraph &b_depsgraph, BL::SpaceView3D &b_v3d,
 
 /* Sync Lights */
 
-void BlenderSync::sync_lights(BL::Depsgraph &b_depsgraph, bool update_all)
+void BlenderSync::sync_lights(BL::Depsgraph &b_depsgraph, bool auto_refresh_update)
 {
   shader_map.set_default(scene->default_light);
 
@@ -1826,7 +1881,9 @@ void BlenderSync::sync_lights(BL::Depsgraph &b_depsgraph, bool update_all)
     Shader *shader;
 
     /* test if we need to sync */
-    if (shader_map.add_or_update(&shader, b_light) || update_all ||
+    if (shader_map.add_or_update(&shader, b_light) ||
+        (auto_refresh_update && b_light.use_nodes() && b_light.node_tree() &&
+         node_tree_has_animated_image(BL::ShaderNodeTree(b_light.node_tree()))) ||
         scene_attr_needs_recalc(shader, b_depsgraph))
     {
       unique_ptr<ShaderGraph> graph = make_unique<ShaderGraph>();
@@ -1856,13 +1913,15 @@ void BlenderSync::sync_lights(BL::Depsgraph &b_depsgraph, bool update_all)
   }
 }
 
-void BlenderSync::sync_shaders(BL::Depsgraph &b_depsgraph, BL::SpaceView3D &b_v3d, bool update_all)
+void BlenderSync::sync_shaders(BL::Depsgraph &b_depsgraph,
+                               BL::SpaceView3D &b_v3d,
+                               bool auto_refresh_update)
 {
   shader_map.pre_sync();
 
-  sync_world(b_depsgraph, b_v3d, update_all);
-  sync_lights(b_depsgraph, update_all);
-  sync_materials(b_depsgraph, update_all);
+  sync_world(b_depsgraph, b_v3d, auto_refresh_update);
+  sync_lights(b_depsgraph, auto_refresh_update);
+  sync_materials(b_depsgraph, auto_refresh_update);
 }
 
 CCL_NAMESPACE_END
@@ -110,8 +110,8 @@ class BlenderSync {
 
  private:
   /* sync */
-  void sync_lights(BL::Depsgraph &b_depsgraph, bool update_all);
-  void sync_materials(BL::Depsgraph &b_depsgraph, bool update_all);
+  void sync_lights(BL::Depsgraph &b_depsgraph, bool auto_refresh_update);
+  void sync_materials(BL::Depsgraph &b_depsgraph, bool auto_refresh_update);
   void sync_objects(BL::Depsgraph &b_depsgraph,
                     BL::SpaceView3D &b_v3d,
                     const float motion_time = 0.0f);
@@ -127,8 +127,12 @@ class BlenderSync {
 
   /* Shader */
   array<Node *> find_used_shaders(BL::Object &b_ob);
-  void sync_world(BL::Depsgraph &b_depsgraph, BL::SpaceView3D &b_v3d, bool update_all);
-  void sync_shaders(BL::Depsgraph &b_depsgraph, BL::SpaceView3D &b_v3d, bool update_all);
+  void sync_world(BL::Depsgraph &b_depsgraph,
+                  BL::SpaceView3D &b_v3d,
+                  bool auto_refresh_update);
+  void sync_shaders(BL::Depsgraph &b_depsgraph,
+                    BL::SpaceView3D &b_v3d,
+                    bool auto_refresh_update);
   void sync_nodes(Shader *shader, BL::ShaderNodeTree &b_ntree);
 
   bool scene_attr_needs_recalc(Shader *shader, BL::Depsgraph &b_depsgraph);
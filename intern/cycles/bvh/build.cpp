@@ -24,6 +24,7 @@
 #include "util/log.h"
 #include "util/progress.h"
 #include "util/stack_allocator.h"
+#include "util/tbb.h"
 #include "util/time.h"
 
 CCL_NAMESPACE_BEGIN
@@ -65,19 +66,49 @@ void BVHBuild::add_reference_triangles(BoundBox &root,
     attr_mP = mesh->attributes.find(ATTR_STD_MOTION_VERTEX_POSITION);
   }
   const size_t num_triangles = mesh->num_triangles();
-  for (uint j = 0; j < num_triangles; j++) {
-    const Mesh::Triangle t = mesh->get_triangle(j);
+
+  if (attr_mP == nullptr) {
+    /* Static triangles: compute bounds of blocks of triangles in parallel. The blocks are
+     * appended in order afterwards, so the references are the same as a serial build. */
+    static const size_t TRIANGLES_PER_BLOCK = 16384;
+    const size_t num_blocks = divide_up(num_triangles, TRIANGLES_PER_BLOCK);
+    struct Block {
+      vector<BVHReference> references;
+      BoundBox root = BoundBox::empty;
+      BoundBox center = BoundBox::empty;
+    };
+    vector<Block> blocks(num_blocks);
     const float3 *verts = mesh->verts.data();
-    if (attr_mP == nullptr) {
-      BoundBox bounds = BoundBox::empty;
-      t.bounds_grow(verts, bounds);
-      if (bounds.valid() && t.valid(verts)) {
-        references.push_back(BVHReference(bounds, j, object_index, primitive_type));
-        root.grow(bounds);
-        center.grow(bounds.center2());
+    parallel_for(blocked_range<size_t>(0, num_blocks, 1), [&](const blocked_range<size_t> &r) {
+      for (size_t block_index = r.begin(); block_index != r.end(); block_index++) {
+        Block &block = blocks[block_index];
+        const size_t start = block_index * TRIANGLES_PER_BLOCK;
+        const size_t end = min(start + TRIANGLES_PER_BLOCK, num_triangles);
+        block.references.reserve(end - start);
+        for (size_t j = start; j < end; j++) {
+          const Mesh::Triangle t = mesh->get_triangle(j);
+          BoundBox bounds = BoundBox::empty;
+          t.bounds_grow(verts, bounds);
+          if (bounds.valid() && t.valid(verts)) {
+            block.references.push_back(BVHReference(bounds, j, object_index, primitive_type));
+            block.root.grow(bounds);
+            block.center.grow(bounds.center2());
+          }
+        }
       }
+    });
+    for (const Block &block : blocks) {
+      references.insert(references.end(), block.references.begin(), block.references.end());
+      root.grow(block.root);
+      center.grow(block.center);
     }
-    else if (params.num_motion_triangle_steps == 0 || params.use_spatial_split) {
+    return;
+  }
+
+  for (uint j = 0; j < num_triangles; j++) {
+    const Mesh::Triangle t = mesh->get_triangle(j);
+    const float3 *verts = mesh->verts.data();
+    if (params.num_motion_triangle_steps == 0 || params.use_spatial_split) {
       /* Motion triangles, simple case: single node for the whole
        * primitive. Lowest memory footprint and faster BVH build but
        * least optimal ray-tracing.
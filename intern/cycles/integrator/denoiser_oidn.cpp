@@ -14,6 +14,7 @@
 #include "util/log.h"
 #include "util/openimagedenoise.h"
 #include "util/path.h"
+#include "util/tbb.h"
 
 CCL_NAMESPACE_BEGIN
 
@@ -462,9 +463,9 @@ class OIDNDenoiseContext {
     const bool has_pass_sample_count = (pass_sample_count_ != PASS_UNUSED);
     const bool need_scale = has_pass_sample_count || oidn_input_pass.use_compositing;
 
-    for (int y = 0; y < height; ++y) {
+    parallel_for(0, height, [&](int64_t y) {
       float *buffer_row = buffer_data + buffer_offset + y * row_stride;
-      for (int x = 0; x < width; ++x) {
+      for (int64_t x = 0; x < width; ++x) {
         float *buffer_pixel = buffer_row + x * pass_stride;
         float *denoised_pixel = buffer_pixel + oidn_output_pass.offset;
 
@@ -494,7 +495,7 @@ class OIDNDenoiseContext {
           denoised_pixel[3] = 0;
         }
       }
-    }
+    });
   }
 
   bool is_pass_scale_needed(OIDNPass &oidn_pass) const
@@ -536,9 +537,9 @@ class OIDNDenoiseContext {
 
     const bool has_pass_sample_count = (pass_sample_count_ != PASS_UNUSED);
 
-    for (int y = 0; y < height; ++y) {
+    parallel_for(0, height, [&](int64_t y) {
       float *buffer_row = buffer_data + buffer_offset + y * row_stride;
-      for (int x = 0; x < width; ++x) {
+      for (int64_t x = 0; x < width; ++x) {
         float *buffer_pixel = buffer_row + x * pass_stride;
         float *pass_pixel = buffer_pixel + oidn_pass.offset;
 
@@ -550,7 +551,7 @@ class OIDNDenoiseContext {
         pass_pixel[1] = pass_pixel[1] * pixel_scale;
         pass_pixel[2] = pass_pixel[2] * pixel_scale;
       }
-    }
+    });
   }
 
   OIDNDenoiser *denoiser_ = nullptr;
@@ -36,9 +36,10 @@ static double calculate_total_time(const vector<WorkBalanceInfo> &work_balance_i
   return total_time;
 }
 
-/* The balance is based on equalizing time which devices spent performing a task. Assume that
- * average of the observed times is usable for estimating whether more or less work is to be
- * scheduled, and how difference in the work scheduling is needed. */
+/* The balance is based on equalizing time which devices spent performing a task. The observed
+ * time and the weight of each device give its throughput, and the new weights are chosen
+ * proportional to the throughput, so that with the same per-device speed all devices would spend
+ * the same time on the next work. */
 
 bool work_balance_do_rebalance(vector<WorkBalanceInfo> &work_balance_infos)
 {
@@ -47,27 +48,18 @@ bool work_balance_do_rebalance(vector<WorkBalanceInfo> &work_balance_infos)
   const double total_time = calculate_total_time(work_balance_infos);
   const double time_average = total_time / num_infos;
 
-  double total_weight = 0;
-  vector<double> new_weights;
-  new_weights.reserve(num_infos);
-
-  /* Equalize the overall average time. This means that we don't make it so every work will perform
-   * amount of work based on the current average, but that after the weights changes the time will
-   * equalize.
-   * Can think of it that if one of the devices is 10% faster than another, then one device needs
-   * to do 5% less of the current work, and another needs to do 5% more. */
-  const double lerp_weight = 1.0 / num_infos;
+  /* Without timing of every device there is nothing to balance against. */
+  for (const WorkBalanceInfo &info : work_balance_infos) {
+    if (info.time_spent <= 0.0) {
+      return false;
+    }
+  }
 
   bool has_big_difference = false;
-
   for (const WorkBalanceInfo &info : work_balance_infos) {
-    const double time_target = mix(info.time_spent, time_average, lerp_weight);
-    const double new_weight = info.weight * time_target / info.time_spent;
-    new_weights.push_back(new_weight);
-    total_weight += new_weight;
-
-    if (std::fabs(1.0 - time_target / time_average) > 0.02) {
+    if (std::fabs(1.0 - info.time_spent / time_average) > 0.02) {
       has_big_difference = true;
+      break;
     }
   }
 
@@ -75,6 +67,15 @@ bool work_balance_do_rebalance(vector<WorkBalanceInfo> &work_balance_infos)
     return false;
   }
 
+  double total_weight = 0;
+  vector<double> new_weights;
+  new_weights.reserve(num_infos);
+  for (const WorkBalanceInfo &info : work_balance_infos) {
+    const double throughput = info.weight / info.time_spent;
+    new_weights.push_back(throughput);
+    total_weight += throughput;
+  }
+
   const double total_weight_inv = 1.0 / total_weight;
   for (int i = 0; i < num_infos; ++i) {
     WorkBalanceInfo &info = work_balance_infos[i];
@@ -7,6 +7,7 @@
 #include "util/image.h"
 #include "util/log.h"
 #include "util/path.h"
+#include "util/tbb.h"
 #include "util/unique_ptr.h"
 
 CCL_NAMESPACE_BEGIN
@@ -125,14 +126,21 @@ static void oiio_load_pixels(const ImageMetaData &metadata,
     in->read_image(0, 0, 0, components, FileFormat, (uchar *)readpixels);
   }
 
+  /* The per pixel conversions below are independent, large textures are converted in
+   * parallel. */
+  static const size_t PIXELS_PER_TASK = 65536;
+
   if (components > 4) {
     const size_t dimensions = width * height;
-    for (size_t i = dimensions - 1, pixel = 0; pixel < dimensions; pixel++, i--) {
-      pixels[i * 4 + 3] = tmppixels[i * components + 3];
-      pixels[i * 4 + 2] = tmppixels[i * components + 2];
-      pixels[i * 4 + 1] = tmppixels[i * components + 1];
-      pixels[i * 4 + 0] = tmppixels[i * components + 0];
-    }
+    parallel_for(blocked_range<size_t>(0, dimensions, PIXELS_PER_TASK),
+                 [&](const blocked_range<size_t> &r) {
+                   for (size_t i = r.begin(); i != r.end(); i++) {
+                     pixels[i * 4 + 3] = tmppixels[i * components + 3];
+                     pixels[i * 4 + 2] = tmppixels[i * components + 2];
+                     pixels[i * 4 + 1] = tmppixels[i * components + 1];
+                     pixels[i * 4 + 0] = tmppixels[i * components + 0];
+                   }
+                 });
     tmppixels.clear();
   }
 
@@ -142,26 +150,35 @@ static void oiio_load_pixels(const ImageMetaData &metadata,
     const StorageType one = util_image_cast_from_float<StorageType>(1.0f);
 
     const size_t num_pixels = width * height * depth;
-    for (size_t i = num_pixels - 1, pixel = 0; pixel < num_pixels; pixel++, i--) {
-      const float c = util_image_cast_to_float(pixels[i * 4 + 0]);
-      const float m = util_image_cast_to_float(pixels[i * 4 + 1]);
-      const float y = util_image_cast_to_float(pixels[i * 4 + 2]);
-      const float k = util_image_cast_to_float(pixels[i * 4 + 3]);
-      pixels[i * 4 + 0] = util_image_cast_from_float<StorageType>((1.0f - c) * (1.0f - k));
-      pixels[i * 4 + 1] = util_image_cast_from_float<StorageType>((1.0f - m) * (1.0f - k));
-      pixels[i * 4 + 2] = util_image_cast_from_float<StorageType>((1.0f - y) * (1.0f - k));
-      pixels[i * 4 + 3] = one;
-    }
+    parallel_for(blocked_range<size_t>(0, num_pixels, PIXELS_PER_TASK),
+                 [&](const blocked_range<size_t> &r) {
+                   for (size_t i = r.begin(); i != r.end(); i++) {
+                     const float c = util_image_cast_to_float(pixels[i * 4 + 0]);
+                     const float m = util_image_cast_to_float(pixels[i * 4 + 1]);
+                     const float y = util_image_cast_to_float(pixels[i * 4 + 2]);
+                     const float k = util_image_cast_to_float(pixels[i * 4 + 3]);
+                     pixels[i * 4 + 0] = util_image_cast_from_float<StorageType>((1.0f - c) *
+                                                                                 (1.0f - k));
+                     pixels[i * 4 + 1] = util_image_cast_from_float<StorageType>((1.0f - m) *
+                                                                                 (1.0f - k));
+                     pixels[i * 4 + 2] = util_image_cast_from_float<StorageType>((1.0f - y) *
+                                                                                 (1.0f - k));
+                     pixels[i * 4 + 3] = one;
+                   }
+                 });
   }
 
   if (components == 4 && associate_alpha) {
     const size_t dimensions = width * height;
-    for (size_t i = dimensions - 1, pixel = 0; pixel < dimensions; pixel++, i--) {
-      const StorageType alpha = pixels[i * 4 + 3];
-      pixels[i * 4 + 0] = util_image_multiply_native(pixels[i * 4 + 0], alpha);
-      pixels[i * 4 + 1] = util_image_multiply_native(pixels[i * 4 + 1], alpha);
-      pixels[i * 4 + 2] = util_image_multiply_native(pixels[i * 4 + 2], alpha);
-    }
+    parallel_for(blocked_range<size_t>(0, dimensions, PIXELS_PER_TASK),
+                 [&](const blocked_range<size_t> &r) {
+                   for (size_t i = r.begin(); i != r.end(); i++) {
+                     const StorageType alpha = pixels[i * 4 + 3];
+                     pixels[i * 4 + 0] = util_image_multiply_native(pixels[i * 4 + 0], alpha);
+                     pixels[i * 4 + 1] = util_image_multiply_native(pixels[i * 4 + 1], alpha);
+                     pixels[i * 4 + 2] = util_image_multiply_native(pixels[i * 4 + 2], alpha);
+                   }
+                 });
   }
 }
 
@@ -8,6 +8,7 @@
 
 #include "util/math_fast.h"
 #include "util/progress.h"
+#include "util/tbb.h"
 
 CCL_NAMESPACE_BEGIN
 
@@ -269,11 +270,24 @@ bool LightTree::triangle_usable_as_light(Mesh *mesh, const int prim_id)
 
 void LightTree::add_mesh(Scene *scene, Mesh *mesh, const int object_id)
 {
+  /* Create the emitters of blocks of triangles in parallel, then append the blocks in order so
+   * the emitters are the same as when created serially. */
+  static const size_t TRIANGLES_PER_BLOCK = 16384;
   const size_t mesh_num_triangles = mesh->num_triangles();
-  for (size_t i = 0; i < mesh_num_triangles; i++) {
-    if (triangle_usable_as_light(mesh, i)) {
-      emitters_.emplace_back(scene, i, object_id);
+  vector<vector<LightTreeEmitter>> blocks(divide_up(mesh_num_triangles, TRIANGLES_PER_BLOCK));
+  parallel_for(blocked_range<size_t>(0, blocks.size(), 1), [&](const blocked_range<size_t> &r) {
+    for (size_t block_index = r.begin(); block_index != r.end(); block_index++) {
+      const size_t start = block_index * TRIANGLES_PER_BLOCK;
+      const size_t end = min(start + TRIANGLES_PER_BLOCK, mesh_num_triangles);
+      for (size_t i = start; i < end; i++) {
+        if (triangle_usable_as_light(mesh, i)) {
+          blocks[block_index].emplace_back(scene, i, object_id);
+        }
+      }
     }
+  });
+  for (vector<LightTreeEmitter> &block : blocks) {
+    std::move(block.begin(), block.end(), std::back_inserter(emitters_));
   }
 }
 
@@ -72,10 +72,22 @@ void SVMShaderManager::device_update_specific(Device *device,
   /* test if we need to update */
   device_free(device, dscene, scene);
 
-  /* Build all shaders. */
+  /* Build all modified shaders, reuse the nodes of the others from the previous update. */
+  const Shader *background_shader = scene->background->get_shader(scene);
   TaskPool task_pool;
   vector<array<int4>> shader_svm_nodes(num_shaders);
+  int num_compiled_shaders = 0;
   for (int i = 0; i < num_shaders; i++) {
+    Shader *shader = scene->shaders[i];
+    const bool background = (shader == background_shader);
+    if (!shader->is_modified()) {
+      auto it = compiled_shaders_.find(shader);
+      if (it != compiled_shaders_.end() && it->second.background == background) {
+        shader_svm_nodes[i] = it->second.svm_nodes;
+        continue;
+      }
+    }
+    num_compiled_shaders++;
     task_pool.push([this, scene, &progress, &shader_svm_nodes, i] {
       device_update_shader(scene, scene->shaders[i], progress, &shader_svm_nodes[i]);
     });
@@ -83,9 +95,22 @@ void SVMShaderManager::device_update_specific(Device *device,
   task_pool.wait_work();
 
   if (progress.get_cancel()) {
+    /* Partially compiled shaders can't be reused. */
+    compiled_shaders_.clear();
     return;
   }
 
+  VLOG_INFO << "Compiled " << num_compiled_shaders << " modified shaders.";
+
+  /* Remember the compiled nodes, dropping shaders that were removed from the scene. */
+  compiled_shaders_.clear();
+  for (int i = 0; i < num_shaders; i++) {
+    const Shader *shader = scene->shaders[i];
+    CompiledShader &compiled = compiled_shaders_[shader];
+    compiled.svm_nodes = shader_svm_nodes[i];
+    compiled.background = (shader == background_shader);
+  }
+
   /* The global node list contains a jump table (one node per shader)
    * followed by the nodes of all shaders. */
   int svm_nodes_size = num_shaders;
@@ -10,6 +10,7 @@
 #include "scene/shader_graph.h"
 
 #include "util/array.h"
+#include "util/map.h"
 #include "util/string.h"
 
 CCL_NAMESPACE_BEGIN
@@ -41,6 +42,14 @@ class SVMShaderManager : public ShaderManager {
                             Shader *shader,
                             Progress &progress,
                             array<int4> *svm_nodes);
+
+  /* Compiled nodes of each shader from the previous update, reused for shaders that were not
+   * modified since, similar to how OSL keeps the shader groups of unmodified shaders. */
+  struct CompiledShader {
+    array<int4> svm_nodes;
+    bool background = false;
+  };
+  unordered_map<const Shader *, CompiledShader> compiled_shaders_;
 };
 
 /* Graph Compiler */
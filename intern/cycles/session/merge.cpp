@@ -6,6 +6,7 @@
 
 #include "util/array.h"
 #include "util/map.h"
+#include "util/tbb.h"
 #include "util/time.h"
 #include "util/unique_ptr.h"
 
@@ -389,6 +390,60 @@ static void alloc_pixels(const ImageSpec &spec, array<float> &pixels)
   pixels.resize(num_pixels * num_channels);
 }
 
+static void merge_pass_pixels(const MergeImageLayer &layer,
+                              const MergeImagePass &pass,
+                              const unordered_map<string, SampleCount> &layer_samples,
+                              const array<float> &pixels,
+                              const size_t stride,
+                              const size_t out_stride,
+                              const blocked_range<size_t> &pixel_range,
+                              array<float> &out_pixels)
+{
+  switch (pass.op) {
+    case MERGE_CHANNEL_NOP:
+      break;
+    case MERGE_CHANNEL_COPY:
+      for (size_t i = pixel_range.begin(); i != pixel_range.end(); i++) {
+        out_pixels[pass.merge_offset + i * out_stride] = pixels[pass.offset + i * stride];
+      }
+      break;
+    case MERGE_CHANNEL_SUM:
+      for (size_t i = pixel_range.begin(); i != pixel_range.end(); i++) {
+        out_pixels[pass.merge_offset + i * out_stride] += pixels[pass.offset + i * stride];
+      }
+      break;
+    case MERGE_CHANNEL_AVERAGE: {
+      /* Weights based on sample count passes and sample metadata. Per channel since not
+       * all files are guaranteed to have the same channels. */
+      const auto &samples = layer_samples.at(layer.name);
+
+      for (size_t i = pixel_range.begin(); i != pixel_range.end(); i++) {
+        const float total_samples = samples.per_pixel[i];
+
+        float layer_samples;
+        if (layer.has_sample_pass) {
+          layer_samples = pixels[layer.sample_pass_offset + i * stride] * layer.samples;
+        }
+        else {
+          layer_samples = layer.samples;
+        }
+
+        out_pixels[pass.merge_offset + i * out_stride] += pixels[pass.offset + i * stride] *
+                                                          (1.0f * layer_samples / total_samples);
+      }
+      break;
+    }
+    case MERGE_CHANNEL_SAMPLES: {
+      const auto &samples = layer_samples.at(layer.name);
+      for (size_t i = pixel_range.begin(); i != pixel_range.end(); i++) {
+        out_pixels[pass.merge_offset + i * out_stride] = 1.0f * samples.per_pixel[i] /
+                                                         samples.total;
+      }
+      break;
+    }
+  }
+}
+
 static bool merge_pixels(const vector<MergeImage> &images,
                          const ImageSpec &out_spec,
                          const unordered_map<string, SampleCount> &layer_samples,
@@ -409,63 +464,21 @@ static bool merge_pixels(const vector<MergeImage> &images,
       return false;
     }
 
-    for (const MergeImageLayer &layer : image.layers) {
-      const size_t stride = image.in->spec().nchannels;
-      const size_t out_stride = out_spec.nchannels;
-      const size_t num_pixels = pixels.size();
-
-      for (const MergeImagePass &pass : layer.passes) {
-        size_t offset = pass.offset;
-        size_t out_offset = pass.merge_offset;
-
-        switch (pass.op) {
-          case MERGE_CHANNEL_NOP:
-            break;
-          case MERGE_CHANNEL_COPY:
-            for (; offset < num_pixels; offset += stride, out_offset += out_stride) {
-              out_pixels[out_offset] = pixels[offset];
-            }
-            break;
-          case MERGE_CHANNEL_SUM:
-            for (; offset < num_pixels; offset += stride, out_offset += out_stride) {
-              out_pixels[out_offset] += pixels[offset];
-            }
-            break;
-          case MERGE_CHANNEL_AVERAGE: {
-            /* Weights based on sample count passes and sample metadata. Per channel since not
-             * all files are guaranteed to have the same channels. */
-            size_t sample_pass_offset = layer.sample_pass_offset;
-            const auto &samples = layer_samples.at(layer.name);
-
-            for (size_t i = 0; offset < num_pixels;
-                 offset += stride, sample_pass_offset += stride, out_offset += out_stride, i++)
-            {
-              const float total_samples = samples.per_pixel[i];
-
-              float layer_samples;
-              if (layer.has_sample_pass) {
-                layer_samples = pixels[sample_pass_offset] * layer.samples;
-              }
-              else {
-                layer_samples = layer.samples;
-              }
-
-              out_pixels[out_offset] += pixels[offset] * (1.0f * layer_samples / total_samples);
-            }
-            break;
-          }
-          case MERGE_CHANNEL_SAMPLES: {
-            const auto &samples = layer_samples.at(layer.name);
-            for (size_t i = 0; offset < num_pixels;
-                 offset += stride, out_offset += out_stride, i++)
-            {
-              out_pixels[out_offset] = 1.0f * samples.per_pixel[i] / samples.total;
-            }
-            break;
-          }
-        }
-      }
-    }
+    const size_t stride = image.in->spec().nchannels;
+    const size_t out_stride = out_spec.nchannels;
+    const size_t num_pixels = pixels.size() / stride;
+
+    /* Pixels are independent, merge ranges of them in parallel. */
+    static const size_t PIXELS_PER_TASK = 16384;
+    parallel_for(blocked_range<size_t>(0, num_pixels, PIXELS_PER_TASK),
+                 [&](const blocked_range<size_t> &r) {
+                   for (const MergeImageLayer &layer : image.layers) {
+                     for (const MergeImagePass &pass : layer.passes) {
+                       merge_pass_pixels(
+                           layer, pass, layer_samples, pixels, stride, out_stride, r, out_pixels);
+                     }
+                   }
+                 });
   }
 
   return true;
@@ -327,14 +327,36 @@ float QuadDice::scale_factor(SubPatch &sub, const int Mu, const int Mv)
   return S;
 }
 
-void QuadDice::add_grid(SubPatch &sub, const int Mu, const int Mv, const int offset)
+bool QuadDice::get_grid_size(SubPatch &sub, int &grid_Mu, int &grid_Mv)
+{
+  const int Mu = max(sub.edge_u0.edge->T, sub.edge_u1.edge->T);
+  const int Mv = max(sub.edge_v0.edge->T, sub.edge_v1.edge->T);
+
+  if (Mu == 1 || Mv == 1) {
+    /* No inner grid, triangles are stitched from side to side. */
+    return false;
+  }
+
+#if 0 /* Doesn't work very well, especially at grazing angles. */
+  const float S = scale_factor(sub, ef, Mu, Mv);
+#else
+  const float S = 1.0f;
+#endif
+
+  grid_Mu = max((int)ceilf(S * Mu), 1);  // XXX handle 0 & 1?
+  grid_Mv = max((int)ceilf(S * Mv), 1);  // XXX handle 0 & 1?
+
+  return true;
+}
+
+void QuadDice::set_grid_verts(SubPatch &sub, const int Mu, const int Mv, const int offset)
 {
   /* no inner grid? */
   if (Mu == 1 || Mv == 1) {
     return;
   }
 
-  /* create inner grid */
+  /* create inner grid vertices */
   const float du = 1.0f / (float)Mu;
   const float dv = 1.0f / (float)Mv;
 
@@ -345,25 +367,51 @@ void QuadDice::add_grid(SubPatch &sub, const int Mu, const int Mv, const int off
       const int center_i = offset + (i - 1) + (j - 1) * (Mu - 1);
 
       set_vert(sub, center_i, make_float2(u, v));
+    }
+  }
+}
 
-      if (i < Mu - 1 && j < Mv - 1) {
-        const int i1 = offset + (i - 1) + (j - 1) * (Mu - 1);
-        const int i2 = offset + i + (j - 1) * (Mu - 1);
-        const int i3 = offset + i + j * (Mu - 1);
-        const int i4 = offset + (i - 1) + j * (Mu - 1);
+void QuadDice::add_grid(SubPatch &sub, const int Mu, const int Mv, const int offset)
+{
+  /* no inner grid? */
+  if (Mu == 1 || Mv == 1) {
+    return;
+  }
 
-        const float2 uv1 = sub.map_uv(make_float2(u, v));
-        const float2 uv2 = sub.map_uv(make_float2(u + du, v));
-        const float2 uv3 = sub.map_uv(make_float2(u + du, v + dv));
-        const float2 uv4 = sub.map_uv(make_float2(u, v + dv));
+  /* create inner grid triangles */
+  const float du = 1.0f / (float)Mu;
+  const float dv = 1.0f / (float)Mv;
 
-        add_triangle(sub.patch, i1, i2, i3, uv1, uv2, uv3);
-        add_triangle(sub.patch, i1, i3, i4, uv1, uv3, uv4);
-      }
+  for (int j = 1; j < Mv - 1; j++) {
+    for (int i = 1; i < Mu - 1; i++) {
+      const float u = i * du;
+      const float v = j * dv;
+
+      const int i1 = offset + (i - 1) + (j - 1) * (Mu - 1);
+      const int i2 = offset + i + (j - 1) * (Mu - 1);
+      const int i3 = offset + i + j * (Mu - 1);
+      const int i4 = offset + (i - 1) + j * (Mu - 1);
+
+      const float2 uv1 = sub.map_uv(make_float2(u, v));
+      const float2 uv2 = sub.map_uv(make_float2(u + du, v));
+      const float2 uv3 = sub.map_uv(make_float2(u + du, v + dv));
+      const float2 uv4 = sub.map_uv(make_float2(u, v + dv));
+
+      add_triangle(sub.patch, i1, i2, i3, uv1, uv2, uv3);
+      add_triangle(sub.patch, i1, i3, i4, uv1, uv3, uv4);
     }
   }
 }
 
+void QuadDice::dice_grid_verts(SubPatch &sub)
+{
+  int grid_Mu;
+  int grid_Mv;
+  if (get_grid_size(sub, grid_Mu, grid_Mv)) {
+    set_grid_verts(sub, grid_Mu, grid_Mv, sub.inner_grid_vert_offset);
+  }
+}
+
 void QuadDice::dice(SubPatch &sub)
 {
   /* Compute inner grid size with scale factor. */
@@ -376,6 +424,9 @@ void QuadDice::dice(SubPatch &sub)
   set_side(sub, 2);
   set_side(sub, 3);
 
+  int grid_Mu;
+  int grid_Mv;
+
   if (Mv == 1) {
     /* No inner grid, stitch triangles from side to side. */
     stitch_triangles_across(sub, 2, 0);
@@ -384,17 +435,8 @@ void QuadDice::dice(SubPatch &sub)
     /* No inner grid, stitch triangles from side to side. */
     stitch_triangles_across(sub, 3, 1);
   }
-  else {
-#if 0 /* Doesn't work very well, especially at grazing angles. */
-    const float S = scale_factor(sub, ef, Mu, Mv);
-#else
-    const float S = 1.0f;
-#endif
-
-    const int grid_Mu = max((int)ceilf(S * Mu), 1);  // XXX handle 0 & 1?
-    const int grid_Mv = max((int)ceilf(S * Mv), 1);  // XXX handle 0 & 1?
-
-    /* Inner grid. */
+  else if (get_grid_size(sub, grid_Mu, grid_Mv)) {
+    /* Inner grid, vertices are expected to be set by dice_grid_verts(). */
     add_grid(sub, grid_Mu, grid_Mv, sub.inner_grid_vert_offset);
 
     /* Stitch triangles to inner grid. */
@@ -68,6 +68,11 @@ class QuadDice : public EdgeDice {
  public:
   explicit QuadDice(const SubdParams &params);
 
+  /* Evaluate the inner grid vertices of the subpatch. These are not shared with other subpatches,
+   * so this may be called for different subpatches in parallel. Must be done before dice(). */
+  void dice_grid_verts(SubPatch &sub);
+
+  /* Evaluate the vertices on the sides of the subpatch and add its triangles. */
   void dice(SubPatch &sub);
 
  protected:
@@ -75,6 +80,8 @@ class QuadDice : public EdgeDice {
 
   void set_vert(SubPatch &sub, const int index, const float2 uv);
 
+  bool get_grid_size(SubPatch &sub, int &grid_Mu, int &grid_Mv);
+  void set_grid_verts(SubPatch &sub, const int Mu, const int Mv, const int offset);
   void add_grid(SubPatch &sub, const int Mu, const int Mv, const int offset);
 
   void set_side(SubPatch &sub, const int edge);
@@ -13,6 +13,7 @@
 #include "util/algorithm.h"
 
 #include "util/math.h"
+#include "util/tbb.h"
 #include "util/types.h"
 
 CCL_NAMESPACE_BEGIN
@@ -498,12 +499,18 @@ void DiagSplit::split_patches(const Patch *patches, const size_t patches_byte_st
   // TODO: avoid multiple write for linear vert attributes
   // TODO: avoid multiple write for smooth vert attributes
   // TODO: support not splitting n-gons if not needed
-  // TODO: multithreading
 
   /* Dice all patches. */
   QuadDice dice(params);
   dice.reserve(num_verts, num_triangles);
 
+  /* Inner grid vertices are owned by a single subpatch and are the bulk of the evaluation work,
+   * so evaluate them in parallel. Shared vertices along edges and the triangles are added
+   * afterwards in order, which keeps the result deterministic. */
+  parallel_for_each(subpatches.begin(), subpatches.end(), [&](SubPatch &sub) {
+    dice.dice_grid_verts(sub);
+  });
+
   for (SubPatch &sub : subpatches) {
     dice.dice(sub);
   }
@@ -190,6 +190,8 @@ extern void (*MEM_set_memory_debug)(void);
 extern size_t (*MEM_get_memory_in_use)(void);
 /** Get amount of memory blocks in use. */
 extern unsigned int (*MEM_get_memory_blocks_in_use)(void);
+/** Get the number of allocations since startup, frees don't decrease this. */
+extern size_t (*MEM_get_memory_allocations_num)(void);
 
 /** Reset the peak memory statistic to zero. */
 extern void (*MEM_reset_peak_memory)(void);
@@ -274,6 +276,15 @@ void MEM_use_lockfree_allocator(void);
  */
 void MEM_use_guarded_allocator(void);
 
+/**
+ * Advise the kernel to back large allocations of the lock-free allocator with transparent huge
+ * pages, which reduces TLB misses when processing big arrays (e.g. high resolution geometry).
+ *
+ * Only affects allocations made after this call. Does nothing on platforms other than Linux,
+ * and with the fully guarded allocator.
+ */
+void MEM_use_transparent_huge_pages(void);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -69,6 +69,7 @@ bool (*MEM_consistency_check)(void) = MEM_lockfree_consistency_check;
 void (*MEM_set_memory_debug)(void) = MEM_lockfree_set_memory_debug;
 size_t (*MEM_get_memory_in_use)(void) = MEM_lockfree_get_memory_in_use;
 uint (*MEM_get_memory_blocks_in_use)(void) = MEM_lockfree_get_memory_blocks_in_use;
+size_t (*MEM_get_memory_allocations_num)(void) = MEM_lockfree_get_memory_allocations_num;
 void (*MEM_reset_peak_memory)(void) = MEM_lockfree_reset_peak_memory;
 size_t (*MEM_get_peak_memory)(void) = MEM_lockfree_get_peak_memory;
 
@@ -190,6 +191,7 @@ void MEM_use_lockfree_allocator()
   MEM_set_memory_debug = MEM_lockfree_set_memory_debug;
   MEM_get_memory_in_use = MEM_lockfree_get_memory_in_use;
   MEM_get_memory_blocks_in_use = MEM_lockfree_get_memory_blocks_in_use;
+  MEM_get_memory_allocations_num = MEM_lockfree_get_memory_allocations_num;
   MEM_reset_peak_memory = MEM_lockfree_reset_peak_memory;
   MEM_get_peak_memory = MEM_lockfree_get_peak_memory;
 
@@ -226,6 +228,7 @@ void MEM_use_guarded_allocator()
   MEM_set_memory_debug = MEM_guarded_set_memory_debug;
   MEM_get_memory_in_use = MEM_guarded_get_memory_in_use;
   MEM_get_memory_blocks_in_use = MEM_guarded_get_memory_blocks_in_use;
+  MEM_get_memory_allocations_num = MEM_guarded_get_memory_allocations_num;
   MEM_reset_peak_memory = MEM_guarded_reset_peak_memory;
   MEM_get_peak_memory = MEM_guarded_get_peak_memory;
 
@@ -188,6 +188,7 @@ static const char *check_memlist(const MemHead *memh);
 /* --------------------------------------------------------------------- */
 
 static uint totblock = 0;
+static size_t totalloc = 0;
 static size_t mem_in_use = 0, peak_mem = 0;
 
 static volatile localListBase _membase;
@@ -517,6 +518,7 @@ static void make_memhead_header(MemHead *memh,
   memt->tag3 = MEMTAG3;
 
   atomic_add_and_fetch_u(&totblock, 1);
+  atomic_add_and_fetch_z(&totalloc, 1);
   atomic_add_and_fetch_z(&mem_in_use, len);
 
   mem_lock_thread();
@@ -1382,6 +1384,11 @@ uint MEM_guarded_get_memory_blocks_in_use()
   return _totblock;
 }
 
+size_t MEM_guarded_get_memory_allocations_num()
+{
+  return atomic_load_z(&totalloc);
+}
+
 #ifndef NDEBUG
 const char *MEM_guarded_name_ptr(void *vmemh)
 {
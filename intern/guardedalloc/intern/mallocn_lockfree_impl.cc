@@ -14,6 +14,10 @@
 #include <string.h> /* memcpy */
 #include <sys/types.h>
 
+#ifdef __linux__
+#  include <sys/mman.h> /* madvise */
+#endif
+
 #include "MEM_guardedalloc.h"
 
 /* Quiet warnings when dealing with allocated data written into the blend file.
@@ -46,6 +50,7 @@ static_assert(MEM_MIN_CPP_ALIGNMENT <= alignof(MemHeadAligned), "Bad alignment o
 static_assert(MEM_MIN_CPP_ALIGNMENT <= sizeof(MemHeadAligned), "Bad size of MemHeadAligned");
 
 static bool malloc_debug_memset = false;
+static bool use_transparent_huge_pages = false;
 
 static void (*error_callback)(const char *) = nullptr;
 
@@ -74,6 +79,31 @@ enum {
 #define MEMHEAD_IS_FROM_CPP_NEW(memhead) ((memhead)->len & size_t(MEMHEAD_FLAG_FROM_CPP_NEW))
 #define MEMHEAD_LEN(memhead) ((memhead)->len & ~size_t(MEMHEAD_FLAG_MASK))
 
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+/** Size of a transparent huge page on common Linux platforms (x86-64 and arm64). */
+#  define MEM_HUGE_PAGE_SIZE (size_t(2) << 20)
+
+/**
+ * Ask the kernel to back the huge page aligned part of a large allocation with transparent huge
+ * pages. This reduces TLB misses when iterating over big arrays. Must be called before the memory
+ * is touched, otherwise the pages are only collapsed later by the kernel (if at all).
+ */
+static void mem_advise_huge_pages(void *ptr, const size_t len)
+{
+  if (len < 2 * MEM_HUGE_PAGE_SIZE) {
+    return;
+  }
+  const uintptr_t begin = (uintptr_t(ptr) + MEM_HUGE_PAGE_SIZE - 1) & ~(MEM_HUGE_PAGE_SIZE - 1);
+  const uintptr_t end = (uintptr_t(ptr) + len) & ~(MEM_HUGE_PAGE_SIZE - 1);
+  if (begin < end) {
+    /* Failure is not an error, the memory simply stays backed by regular pages. */
+    madvise((void *)begin, size_t(end - begin), MADV_HUGEPAGE);
+  }
+}
+#else
+static void mem_advise_huge_pages(void * /*ptr*/, const size_t /*len*/) {}
+#endif
+
 #ifdef __GNUC__
 __attribute__((format(printf, 1, 0)))
 #endif
@@ -300,6 +330,9 @@ void *MEM_lockfree_callocN(size_t len, const char *str)
   memh = (MemHead *)calloc(1, len + sizeof(MemHead));
 
   if (LIKELY(memh)) {
+    if (UNLIKELY(use_transparent_huge_pages)) {
+      mem_advise_huge_pages(memh + 1, len);
+    }
     memh->len = len;
     memory_usage_block_alloc(len);
 
@@ -342,6 +375,9 @@ void *MEM_lockfree_mallocN(size_t len, const char *str)
   memh = (MemHead *)malloc(len + sizeof(MemHead));
 
   if (LIKELY(memh)) {
+    if (UNLIKELY(use_transparent_huge_pages)) {
+      mem_advise_huge_pages(memh + 1, len);
+    }
 
     if (LIKELY(len)) {
       if (UNLIKELY(malloc_debug_memset)) {
@@ -427,6 +463,10 @@ void *MEM_lockfree_mallocN_aligned(size_t len,
      */
     memh = (MemHeadAligned *)((char *)memh + extra_padding);
 
+    if (UNLIKELY(use_transparent_huge_pages)) {
+      mem_advise_huge_pages(memh + 1, len);
+    }
+
     if (LIKELY(len)) {
       if (UNLIKELY(malloc_debug_memset)) {
         memset(memh + 1, 255, len);
@@ -546,6 +586,11 @@ void MEM_lockfree_set_memory_debug()
   malloc_debug_memset = true;
 }
 
+void MEM_use_transparent_huge_pages()
+{
+  use_transparent_huge_pages = true;
+}
+
 size_t MEM_lockfree_get_memory_in_use()
 {
   return memory_usage_current();
@@ -556,6 +601,11 @@ uint MEM_lockfree_get_memory_blocks_in_use()
   return uint(memory_usage_block_num());
 }
 
+size_t MEM_lockfree_get_memory_allocations_num()
+{
+  return memory_usage_allocations_num();
+}
+
 /* dummy */
 void MEM_lockfree_reset_peak_memory()
 {
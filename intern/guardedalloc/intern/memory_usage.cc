@@ -47,6 +47,11 @@ struct alignas(128) Local {
    * Number of allocated blocks. Can be negative and is atomic for the same reason as above.
    */
   std::atomic<int64_t> blocks_num = 0;
+  /**
+   * Number of allocations done by this thread, frees don't decrease it. Useful to find code that
+   * does many small allocations, which is hidden by the current memory usage.
+   */
+  std::atomic<int64_t> allocations_num = 0;
   /**
    * Amount of memory used when the peak was last updated. This is used so that we don't have to
    * update the peak memory usage after every memory allocation. Instead it's only updated when "a
@@ -90,6 +95,10 @@ struct Global {
    * Number of blocks that are not tracked by #Local, for the same reason as above.
    */
   std::atomic<int64_t> blocks_num_outside_locals = 0;
+  /**
+   * Number of allocations that are not tracked by #Local, for the same reason as above.
+   */
+  std::atomic<int64_t> allocations_num_outside_locals = 0;
   /**
    * Peak memory usage since the last reset.
    */
@@ -152,6 +161,8 @@ Local::~Local()
   /* Don't forget the memory counts stored locally. */
   this->global->blocks_num_outside_locals.fetch_add(this->blocks_num, std::memory_order_relaxed);
   this->global->mem_in_use_outside_locals.fetch_add(this->mem_in_use, std::memory_order_relaxed);
+  this->global->allocations_num_outside_locals.fetch_add(this->allocations_num,
+                                                         std::memory_order_relaxed);
 
   if (this->is_main) {
     /* The main thread started shutting down. Use global counters from now on to avoid accessing
@@ -195,6 +206,7 @@ void memory_usage_block_alloc(const size_t size)
      * time, which is very rare compared to doing allocations. */
     local.blocks_num.fetch_add(1, std::memory_order_relaxed);
     local.mem_in_use.fetch_add(int64_t(size), std::memory_order_relaxed);
+    local.allocations_num.fetch_add(1, std::memory_order_relaxed);
 
     /* If a certain amount of new memory has been allocated, update the peak. */
     if (local.mem_in_use - local.mem_in_use_during_peak_update > peak_update_threshold) {
@@ -206,6 +218,7 @@ void memory_usage_block_alloc(const size_t size)
     /* Increase global memory counts. */
     global.blocks_num_outside_locals.fetch_add(1, std::memory_order_relaxed);
     global.mem_in_use_outside_locals.fetch_add(int64_t(size), std::memory_order_relaxed);
+    global.allocations_num_outside_locals.fetch_add(1, std::memory_order_relaxed);
   }
 }
 
@@ -239,6 +252,19 @@ size_t memory_usage_block_num()
   return size_t(blocks_num);
 }
 
+size_t memory_usage_allocations_num()
+{
+  Global &global = get_global();
+  std::lock_guard lock{global.locals_mutex};
+
+  /* Count the number of allocations since startup. */
+  int64_t allocations_num = global.allocations_num_outside_locals;
+  for (const Local *local : global.locals) {
+    allocations_num += local->allocations_num;
+  }
+  return size_t(allocations_num);
+}
+
 size_t memory_usage_current()
 {
   Global &global = get_global();
@@ -13,19 +13,59 @@
 #include <opensubdiv/osd/cpuPatchTable.h>
 #include <opensubdiv/osd/cpuVertexBuffer.h>
 
+#include "BLI_task.hh"
+
 using OpenSubdiv::Far::StencilTable;
 using OpenSubdiv::Osd::CpuEvaluator;
 using OpenSubdiv::Osd::CpuVertexBuffer;
 
 namespace blender::opensubdiv {
 
+// Same as the CPU evaluator from OpenSubdiv, but applies stencils from multiple threads.
+//
+// Refining a uniformly subdivided mesh evaluates one stencil per final vertex, which otherwise
+// runs on a single thread for every frame. This is safe because the stencil tables are factorized
+// to only reference coarse vertices, which are never written to.
+class ParallelCpuEvaluator : public CpuEvaluator {
+ public:
+  template<typename SRC_BUFFER, typename DST_BUFFER, typename STENCIL_TABLE>
+  static bool EvalStencils(SRC_BUFFER *src_buffer,
+                           const BufferDescriptor &src_desc,
+                           DST_BUFFER *dst_buffer,
+                           const BufferDescriptor &dst_desc,
+                           const STENCIL_TABLE *stencil_table,
+                           const ParallelCpuEvaluator * /*instance*/ = nullptr,
+                           void * /*device_context*/ = nullptr)
+  {
+    const int num_stencils = stencil_table->GetNumStencils();
+    if (num_stencils == 0) {
+      return false;
+    }
+    const float *src = src_buffer->BindCpuBuffer();
+    float *dst = dst_buffer->BindCpuBuffer();
+    threading::parallel_for(IndexRange(num_stencils), 2048, [&](const IndexRange range) {
+      CpuEvaluator::EvalStencils(src,
+                                 src_desc,
+                                 dst,
+                                 dst_desc,
+                                 &stencil_table->GetSizes()[0],
+                                 &stencil_table->GetOffsets()[0],
+                                 &stencil_table->GetControlIndices()[0],
+                                 &stencil_table->GetWeights()[0],
+                                 range.first(),
+                                 range.one_after_last());
+    });
+    return true;
+  }
+};
+
 // NOTE: Define as a class instead of typedef to make it possible
 // to have anonymous class in opensubdiv_evaluator_internal.h
 class CpuEvalOutput : public VolatileEvalOutput<CpuVertexBuffer,
                                                 CpuVertexBuffer,
                                                 StencilTable,
                                                 CpuPatchTable,
-                                                CpuEvaluator> {
+                                                ParallelCpuEvaluator> {
  public:
   CpuEvalOutput(const StencilTable *vertex_stencils,
                 const StencilTable *varying_stencils,
@@ -37,7 +77,7 @@ class CpuEvalOutput : public VolatileEvalOutput<CpuVertexBuffer,
                            CpuVertexBuffer,
                            StencilTable,
                            CpuPatchTable,
-                           CpuEvaluator>(vertex_stencils,
+                           ParallelCpuEvaluator>(vertex_stencils,
                                          varying_stencils,
                                          all_face_varying_stencils,
                                          face_varying_width,
@@ -0,0 +1,152 @@
+# SPDX-FileCopyrightText: 2025 Blender Authors
+#
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+"""
+Persistent worker which runs a stream of jobs in a single Blender process, see:
+
+   blender --command batch --help
+
+Starting Blender, registering add-ons and initializing Python is done once,
+instead of once per job as happens when running ``blender -b file.blend -P script.py``
+for every job.
+
+Jobs are read as JSON, one object per line, with the following keys (all optional):
+
+``id``
+   Passed back unchanged in the result, to match results with jobs.
+``file``
+   The blend-file to open, when omitted an empty file is loaded instead.
+``script``
+   Python script to run after the file has been opened.
+``args``
+   List of arguments for the script, available in ``sys.argv`` after ``--``,
+   the same as when passing them on the command line.
+
+For every job one JSON object is written as a result, with the keys
+``id``, ``status`` (``"OK"`` or ``"ERROR"``), ``message`` and ``time`` (in seconds).
+"""
+
+__all__ = (
+    "cli_batch_handler",
+)
+
+import argparse
+import json
+import os
+import sys
+import time
+
+from typing import (
+    Any,
+    TextIO,
+)
+
+
+def job_reset() -> None:
+    import bpy
+    # Loading an empty file frees all data of the previous job, without reloading add-ons
+    # or preferences as loading the factory settings would.
+    bpy.ops.wm.read_homefile(use_empty=True, load_ui=False)
+
+
+def job_run(job: dict[str, Any]) -> None:
+    import bpy
+    import runpy
+
+    filepath = job.get("file")
+    if filepath:
+        bpy.ops.wm.open_mainfile(filepath=filepath, load_ui=False)
+    else:
+        job_reset()
+
+    script = job.get("script")
+    if not script:
+        return
+
+    # Scripts may change the working directory or arguments, restore them for the next job.
+    argv_orig = sys.argv
+    cwd_orig = os.getcwd()
+    sys.argv = [bpy.app.binary_path, "--", *(str(arg) for arg in job.get("args", ()))]
+    try:
+        runpy.run_path(script, run_name="__main__")
+    except SystemExit as ex:
+        if ex.code not in {None, 0}:
+            raise Exception("script exited with code: {!r}".format(ex.code)) from None
+    finally:
+        sys.argv = argv_orig
+        os.chdir(cwd_orig)
+
+
+def job_result_write(fh: TextIO, job_id: Any, status: str, message: str, time_elapsed: float) -> None:
+    result = {
+        "id": job_id,
+        "status": status,
+        "message": message,
+        "time": time_elapsed,
+    }
+    fh.write(json.dumps(result) + "\n")
+    fh.flush()
+
+
+def jobs_run(fh_jobs: TextIO, fh_results: TextIO) -> bool:
+    import traceback
+
+    all_ok = True
+    for line in fh_jobs:
+        line = line.strip()
+        if not line:
+            continue
+
+        time_start = time.monotonic()
+        job_id = None
+        try:
+            job = json.loads(line)
+            if not isinstance(job, dict):
+                raise Exception("expected a JSON object, found: {:s}".format(type(job).__name__))
+            job_id = job.get("id")
+            job_run(job)
+        except Exception as ex:
+            traceback.print_exc()
+            job_result_write(fh_results, job_id, "ERROR", str(ex), time.monotonic() - time_start)
+            all_ok = False
+        else:
+            job_result_write(fh_results, job_id, "OK", "", time.monotonic() - time_start)
+
+    return all_ok
+
+
+def cli_batch_handler(argv: list[str]) -> int:
+    parser = argparse.ArgumentParser(
+        prog="blender --command batch",
+        description=(
+            "Run jobs read as JSON lines, keeping Blender running between jobs "
+            "(see the \"_bpy_internal.batch_worker\" module for the job format)."
+        ),
+    )
+    parser.add_argument(
+        "--jobs",
+        default="-",
+        help="File to read jobs from, one JSON object per line (\"-\" reads from the standard input).",
+    )
+    parser.add_argument(
+        "--results",
+        default="-",
+        help=(
+            "File to write results to, one JSON object per line (\"-\" writes to the standard output, "
+            "mixed with any output of the scripts)."
+        ),
+    )
+    args = parser.parse_args(argv)
+
+    fh_jobs = sys.stdin if args.jobs == "-" else open(args.jobs, "r", encoding="utf-8")
+    fh_results = sys.stdout if args.results == "-" else open(args.results, "w", encoding="utf-8")
+    try:
+        all_ok = jobs_run(fh_jobs, fh_results)
+    finally:
+        if fh_jobs is not sys.stdin:
+            fh_jobs.close()
+        if fh_results is not sys.stdout:
+            fh_results.close()
+
+    return 0 if all_ok else 1
@@ -332,6 +332,7 @@ def enable(module_name, *, default_set=False, persistent=False, refresh_handled=
     import os
     import sys
     import importlib
+    from time import perf_counter
     from bpy_restrict_state import RestrictBlend
 
     if handle_error is None:
@@ -426,6 +427,7 @@ def enable(module_name, *, default_set=False, persistent=False, refresh_handled=
     with RestrictBlend():
 
         # 1) try import
+        time_import_start = perf_counter()
         try:
             # Use instead of `__import__` so that sub-modules can eventually be supported.
             # This is also documented to be the preferred way to import modules.
@@ -511,6 +513,7 @@ def enable(module_name, *, default_set=False, persistent=False, refresh_handled=
         _bl_owner_id_set(module_name)
 
         # 3) Try run the modules register function.
+        time_register_start = perf_counter()
         try:
             mod.register()
         except Exception as ex:
@@ -524,13 +527,19 @@ def enable(module_name, *, default_set=False, persistent=False, refresh_handled=
             return None
         finally:
             _bl_owner_id_set(owner_id_prev)
+        time_register_end = perf_counter()
 
     # * OK loaded successfully! *
     mod.__addon_enabled__ = True
     mod.__addon_persistent__ = persistent
 
     if _bpy.app.debug_python:
-        print("\taddon_utils.enable", mod.__name__)
+        # Report the time spent, so add-ons that slow down startup can be identified.
+        print("\taddon_utils.enable {:s} (import: {:.4f}s, register: {:.4f}s)".format(
+            mod.__name__,
+            time_register_start - time_import_start,
+            time_register_end - time_register_start,
+        ))
 
     return mod
 
@@ -843,6 +843,7 @@ class RENDER_PT_eevee_performance_viewport(RenderButtonsPanel, Panel):
 
         col = layout.column()
         col.prop(rd, "preview_pixel_size", text="Pixel Size")
+        col.prop(scene.eevee, "use_low_resolution_navigation", text="Lower Resolution Navigation")
 
 
 class RENDER_PT_gpencil(RenderButtonsPanel, Panel):
@@ -0,0 +1,26 @@
+# SPDX-FileCopyrightText: 2025 Blender Authors
+#
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Command line commands built into Blender, see: `blender --command help`.
+
+
+def cli_batch(argv):
+    # Import on demand, to avoid slowing down startup.
+    from _bpy_internal.batch_worker import cli_batch_handler
+    return cli_batch_handler(argv)
+
+
+cli_commands = []
+
+
+def register():
+    from bpy.utils import register_cli_command
+    cli_commands.append(register_cli_command("batch", cli_batch))
+
+
+def unregister():
+    from bpy.utils import unregister_cli_command
+    for cmd in cli_commands:
+        unregister_cli_command(cmd)
+    cli_commands.clear()
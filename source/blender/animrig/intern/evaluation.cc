@@ -159,9 +159,7 @@ static EvaluationResult evaluate_keyframe_data(PointerRNA &animated_id_ptr,
     }
 
     PathResolvedRNA anim_rna;
-    if (!BKE_animsys_rna_path_resolve(
-            &animated_id_ptr, fcu->rna_path, fcu->array_index, &anim_rna))
-    {
+    if (!BKE_animsys_rna_path_resolve_cached(&animated_id_ptr, fcu, &anim_rna)) {
       /* Log this at quite a high level, because it can get _very_ noisy when playing back
        * animation. */
       CLOG_INFO(&LOG,
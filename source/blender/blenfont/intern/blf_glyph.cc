@@ -174,6 +174,10 @@ static GlyphBLF *blf_glyph_cache_find_glyph(const GlyphCacheBLF *gc,
                                             uint charcode,
                                             uint8_t subpixel)
 {
+  if (charcode < 128) {
+    BLI_assert((subpixel >> 4) < 4);
+    return gc->glyph_ascii_table[subpixel >> 4][charcode];
+  }
   const std::unique_ptr<GlyphBLF> *ptr = gc->glyphs.lookup_ptr_as(
       GlyphCacheKey{charcode, subpixel});
   if (ptr != nullptr) {
@@ -334,6 +338,9 @@ static GlyphBLF *blf_glyph_cache_add_glyph(
   GlyphBLF *result = g.get();
   GlyphCacheKey key = {charcode, subpixel};
   gc->glyphs.add(key, std::move(g));
+  if (charcode < 128) {
+    gc->glyph_ascii_table[subpixel >> 4][charcode] = result;
+  }
   return result;
 }
 
@@ -159,6 +159,11 @@ struct GlyphCacheBLF {
 
   /** The glyphs. */
   blender::Map<GlyphCacheKey, std::unique_ptr<GlyphBLF>> glyphs;
+  /**
+   * Direct lookup of the ASCII glyphs in #glyphs, per sub-pixel offset (in steps of 16). These
+   * make up most of the UI text, so this avoids hashing for nearly every drawn character.
+   */
+  GlyphBLF *glyph_ascii_table[4][128] = {{nullptr}};
 
   /** Texture array, to draw the glyphs. */
   GPUTexture *texture;
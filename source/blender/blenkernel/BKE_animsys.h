@@ -287,6 +287,19 @@ bool BKE_animsys_rna_path_resolve(struct PointerRNA *ptr,
                                   const char *rna_path,
                                   int array_index,
                                   struct PathResolvedRNA *r_result);
+/**
+ * Same as #BKE_animsys_rna_path_resolve for the path of the F-Curve, but re-uses the result of
+ * previous evaluations when called from the depsgraph animation evaluation of the owner ID of
+ * `ptr`. Falls back to regular path resolution otherwise.
+ */
+bool BKE_animsys_rna_path_resolve_cached(struct PointerRNA *ptr,
+                                         const struct FCurve *fcu,
+                                         struct PathResolvedRNA *r_result);
+/**
+ * Free the cache of resolved F-Curve paths of an evaluated ID.
+ * Needed when the pointers it contains might have become invalid.
+ */
+void BKE_animsys_path_cache_free(struct AnimData *adt);
 bool BKE_animsys_read_from_rna_path(struct PathResolvedRNA *anim_rna, float *r_value);
 /**
  * Write the given value to a setting using RNA, and return success.
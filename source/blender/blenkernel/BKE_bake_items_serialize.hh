@@ -7,6 +7,7 @@
 #include "BLI_fileops.hh"
 #include "BLI_function_ref.hh"
 #include "BLI_serialize.hh"
+#include "BLI_struct_equality_utils.hh"
 
 #include "BKE_bake_items.hh"
 
@@ -101,11 +102,27 @@ class BlobWriteSharing : NonCopyable, NonMovable {
    */
   Map<const ImplicitSharingInfo *, StoredByRuntimeValue> stored_by_runtime_;
 
+  /**
+   * Identifies written data by its size and content hash. The size is part of the key, so that
+   * arrays with different sizes are never considered equal, even if their hashes collide.
+   */
+  struct ContentKey {
+    int64_t size_in_bytes;
+    uint64_t content_hash;
+
+    uint64_t hash() const
+    {
+      return get_default_hash(this->size_in_bytes, this->content_hash);
+    }
+
+    BLI_STRUCT_EQUALITY_OPERATORS_2(ContentKey, size_in_bytes, content_hash)
+  };
+
   /**
    * Remembers where data was stored based on the hash of the data. This allows us to skip writing
-   * the same array again if it has the same hash.
+   * the same array again if it has the same hash, even when it is written for a different frame.
    */
-  Map<uint64_t, BlobSlice> slice_by_content_hash_;
+  Map<ContentKey, BlobSlice> slice_by_content_hash_;
 
  public:
   ~BlobWriteSharing();
@@ -13,6 +13,7 @@
 
 #include "BLI_implicit_sharing.h"
 #include "BLI_memory_counter_fwd.hh"
+#include "BLI_offset_indices.hh"
 #include "BLI_set.hh"
 #include "BLI_span.hh"
 #include "BLI_string_ref.hh"
@@ -429,6 +430,21 @@ void CustomData_interp(const CustomData *source,
                        const float *sub_weights,
                        int count,
                        int dest_index);
+/**
+ * Batched version of #CustomData_interp for a contiguous range of destination items.
+ *
+ * Destination item `dest_start + i` is interpolated from the source items
+ * `src_indices[src_groups[i]]` with the matching `weights`. Layers are processed in parallel and
+ * common float types are interpolated with typed kernels instead of the generic callbacks.
+ *
+ * \param weights: One weight for every item in `src_indices`. If empty, sources are averaged.
+ */
+void CustomData_interp_batch(const CustomData *source,
+                             CustomData *dest,
+                             blender::OffsetIndices<int> src_groups,
+                             blender::Span<int> src_indices,
+                             blender::Span<float> weights,
+                             int dest_start);
 /**
  * \note src_blocks_ofs & dst_block_ofs
  * must be pointers to the data, offset by layer->offset already.
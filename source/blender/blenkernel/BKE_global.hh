@@ -302,6 +302,13 @@ enum {
    */
   G_LIBOVERRIDE_NO_AUTO_RESYNC = 1 << 3,
 
+  /**
+   * Defer loading of large geometry arrays until they are accessed, see
+   * #BLO_READ_DEFER_GEOMETRY_DATA. Typically set by the `--defer-geometry-on-file-load`
+   * command-line argument.
+   */
+  G_FILE_DEFER_GEOMETRY_READ = 1 << 4,
+
   // G_FILE_DEPRECATED_9 = (1 << 9),
   G_FILE_NO_UI = (1 << 10),
 
@@ -340,8 +347,8 @@ enum {
  * This means we can change the values without worrying about do-versions.
  */
 #define G_FILE_FLAG_ALL_RUNTIME \
-  (G_BACKGROUND_NO_DEPSGRAPH | G_LIBOVERRIDE_NO_AUTO_RESYNC | G_FILE_NO_UI | \
-   G_FILE_RECOVER_READ | G_FILE_RECOVER_WRITE)
+  (G_BACKGROUND_NO_DEPSGRAPH | G_LIBOVERRIDE_NO_AUTO_RESYNC | G_FILE_DEFER_GEOMETRY_READ | \
+   G_FILE_NO_UI | G_FILE_RECOVER_READ | G_FILE_RECOVER_WRITE)
 
 /** #Global.moving, signals drawing in (3d) window to denote transform */
 enum {
@@ -33,6 +33,7 @@
 #include <optional>
 
 #include "BLI_compiler_attrs.h"
+#include "BLI_memory_counter_fwd.hh"
 #include "BLI_set.hh"
 #include "BLI_string_ref.hh"
 #include "BLI_utildefines.h"
@@ -878,6 +879,14 @@ void BKE_id_reorder(const ListBase *lb, ID *id, ID *relative, bool after);
 
 void BKE_id_blend_write(BlendWriter *writer, ID *id);
 
+/**
+ * Estimate the memory used by the data of the ID (currently only supported for geometry types).
+ * Data shared between IDs with implicit sharing is only counted once by the same \a memory.
+ *
+ * \return false if the memory usage of this ID type cannot be counted.
+ */
+bool BKE_id_count_memory(const ID &id, blender::MemoryCounter &memory);
+
 #define IS_TAGGED(_id) ((_id) && (((ID *)_id)->tag & ID_TAG_DOIT))
 
 /* `lib_id_eval.cc` */
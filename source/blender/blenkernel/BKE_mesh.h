@@ -41,6 +41,8 @@ enum eMeshBatchDirtyMode : int8_t {
   BKE_MESH_BATCH_DIRTY_SHADING,
   BKE_MESH_BATCH_DIRTY_UVEDIT_ALL,
   BKE_MESH_BATCH_DIRTY_UVEDIT_SELECT,
+  /** Only generic attribute values changed (e.g. vertex colors), topology is unchanged. */
+  BKE_MESH_BATCH_DIRTY_ATTRIBUTES,
 };
 
 /* `mesh.cc` */
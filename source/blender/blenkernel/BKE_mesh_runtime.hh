@@ -86,6 +86,16 @@ Mesh *mesh_create_eval_no_deform_render(Depsgraph *depsgraph,
 
 void mesh_eval_to_meshkey(const Mesh *me_deformed, Mesh *mesh, KeyBlock *kb);
 
+/**
+ * If both meshes reference the same topology arrays, share the caches that only depend on
+ * topology (vertex to face maps, loose elements, triangle face indices) from \a src with \a dst.
+ * Meant for operations that output a new mesh but keep the topology of their input, so that
+ * derived data doesn't have to be recalculated. Caches that \a dst has already are kept.
+ *
+ * \return True if the topology was the same.
+ */
+bool mesh_share_topology_caches(const Mesh &src, Mesh &dst);
+
 }  // namespace blender::bke
 
 #ifndef NDEBUG
@@ -108,6 +108,18 @@ struct TrianglesCache {
   void tag_dirty();
 };
 
+/**
+ * Tracks whether a cached BVH tree can be refit to changed vertex positions instead of being
+ * rebuilt from scratch. Refitting keeps the tree structure built for the initial positions, so
+ * the tree is still rebuilt every now and then to avoid degraded query performance.
+ */
+struct BVHCacheRefit {
+  /** True when the tree was only invalidated by changed vertex positions since it was built. */
+  bool only_positions_changed = false;
+  /** The number of times the tree has been refit since it was built. */
+  int refits_num = 0;
+};
+
 struct MeshRuntime {
   /**
    * "Evaluated" mesh owned by this mesh. Used for objects which don't have effective modifiers, so
@@ -168,6 +180,8 @@ struct MeshRuntime {
   SharedCache<std::unique_ptr<BVHTree, BVHTreeDeleter>> bvh_cache_loose_verts_no_hidden;
   SharedCache<std::unique_ptr<BVHTree, BVHTreeDeleter>> bvh_cache_loose_edges;
   SharedCache<std::unique_ptr<BVHTree, BVHTreeDeleter>> bvh_cache_loose_edges_no_hidden;
+  BVHCacheRefit bvh_cache_verts_refit;
+  BVHCacheRefit bvh_cache_corner_tris_refit;
 
   SharedCache<std::optional<int>> max_material_index;
 
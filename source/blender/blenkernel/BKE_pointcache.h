@@ -90,6 +90,8 @@ typedef struct PTCacheData {
 
 typedef struct PTCacheFile {
   FILE *fp;
+  /** Buffer used by `fp`, sized so a whole frame is transferred in few large requests. */
+  void *io_buffer;
 
   int frame, old_format;
   unsigned int totpoint, type;
@@ -100,6 +102,8 @@ typedef struct PTCacheFile {
 } PTCacheFile;
 
 #define PTCACHE_VEL_PER_SEC 1
+/** Reading or interpolating a point only accesses that point, points can be read in parallel. */
+#define PTCACHE_INDEPENDENT_POINTS 2
 
 enum {
   PTCACHE_FILE_PTCACHE = 0,
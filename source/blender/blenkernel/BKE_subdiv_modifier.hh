@@ -20,6 +20,7 @@ struct Scene;
 struct SubsurfModifierData;
 
 namespace blender::bke::subdiv {
+struct MeshTopologyKey;
 struct Subdiv;
 struct Settings;
 }  // namespace blender::bke::subdiv
@@ -32,6 +33,10 @@ struct SubsurfRuntimeData {
   /* Cached subdivision surface descriptor, with topology and settings. */
   blender::bke::subdiv::Subdiv *subdiv_cpu;
   blender::bke::subdiv::Subdiv *subdiv_gpu;
+  /* Identifies the mesh data the descriptors were last used with. While it stays the same, the
+   * descriptors can be reused without comparing their topology with the mesh. */
+  blender::bke::subdiv::MeshTopologyKey *subdiv_cpu_key;
+  blender::bke::subdiv::MeshTopologyKey *subdiv_gpu_key;
 
   /* Recent usage markers for UI diagnostics. To avoid UI flicker due to races
    * between evaluation and UI redraw, they are set to 2 when an evaluator is used,
@@ -88,6 +93,8 @@ extern void (*BKE_subsurf_modifier_free_gpu_cache_cb)(blender::bke::subdiv::Subd
 blender::bke::subdiv::Subdiv *BKE_subsurf_modifier_subdiv_descriptor_ensure(
     SubsurfRuntimeData *runtime_data, const Mesh *mesh, bool for_draw_code);
 
+void BKE_subsurf_modifier_runtime_free(SubsurfRuntimeData *runtime_data);
+
 /**
  * Return the #ModifierMode required for the evaluation of the subsurf modifier,
  * which should be used to check if the modifier is enabled.
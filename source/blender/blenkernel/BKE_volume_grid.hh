@@ -19,7 +19,9 @@
 #  include "BKE_volume_enums.hh"
 #  include "BKE_volume_grid_type_traits.hh"
 
+#  include "BLI_bounds_types.hh"
 #  include "BLI_implicit_sharing_ptr.hh"
+#  include "BLI_math_vector_types.hh"
 #  include "BLI_string_ref.hh"
 
 #  include "openvdb_fwd.hh"
@@ -226,6 +228,13 @@ class VolumeGridData : public ImplicitSharingMixin {
    */
   bool is_loaded() const;
 
+  /**
+   * World space bounds of the active voxels as stored in the file meta-data by OpenVDB. Only
+   * available while the tree is not loaded (so it can't have been changed since it was written).
+   * This allows getting the bounds without reading the whole tree from disk.
+   */
+  std::optional<Bounds<float3>> bounds_from_file_meta_data() const;
+
   void count_memory(MemoryCounter &memory) const;
 
   /**
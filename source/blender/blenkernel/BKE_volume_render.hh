@@ -26,8 +26,14 @@ struct DenseFloatVolumeGrid {
   float *voxels;
 };
 
+/**
+ * Extract the active voxels of the grid into a dense float buffer.
+ * Returns false if the grid is empty or if the resolution along any axis exceeds
+ * \a max_resolution, in which case nothing is allocated. A \a max_resolution of 0 means no limit.
+ */
 bool BKE_volume_grid_dense_floats(const Volume *volume,
                                   const blender::bke::VolumeGridData *volume_grid,
+                                  int max_resolution,
                                   DenseFloatVolumeGrid *r_dense_grid);
 void BKE_volume_dense_float_grid_clear(DenseFloatVolumeGrid *dense_grid);
 
@@ -583,8 +583,9 @@ static void read_channelbag(BlendDataReader *reader, animrig::Channelbag &channe
 {
   BLO_read_pointer_array(
       reader, channelbag.group_array_num, reinterpret_cast<void **>(&channelbag.group_array));
+  BLO_read_struct_pointer_array_items(
+      reader, bActionGroup, channelbag.group_array_num, channelbag.group_array);
   for (int i = 0; i < channelbag.group_array_num; i++) {
-    BLO_read_struct(reader, bActionGroup, &channelbag.group_array[i]);
     channelbag.group_array[i]->channelbag = &channelbag;
 
     /* Clear the legacy channels #ListBase, since it will have been set for some
@@ -595,8 +596,9 @@ static void read_channelbag(BlendDataReader *reader, animrig::Channelbag &channe
 
   BLO_read_pointer_array(
       reader, channelbag.fcurve_array_num, reinterpret_cast<void **>(&channelbag.fcurve_array));
+  BLO_read_struct_pointer_array_items(
+      reader, FCurve, channelbag.fcurve_array_num, channelbag.fcurve_array);
   for (int i = 0; i < channelbag.fcurve_array_num; i++) {
-    BLO_read_struct(reader, FCurve, &channelbag.fcurve_array[i]);
     FCurve *fcurve = channelbag.fcurve_array[i];
 
     /* Clear the prev/next pointers set by the forward compatibility code in
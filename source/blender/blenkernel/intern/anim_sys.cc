@@ -11,12 +11,15 @@
 #include <cstddef>
 #include <cstdio>
 #include <cstring>
+#include <optional>
+#include <string>
 
 #include "MEM_guardedalloc.h"
 
 #include "BLI_bit_vector.hh"
 #include "BLI_listbase.h"
 #include "BLI_listbase_wrapper.hh"
+#include "BLI_map.hh"
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
 #include "BLI_math_vector_types.hh"
@@ -25,6 +28,7 @@
 #include "BLI_string_utf8.h"
 #include "BLI_string_utils.hh"
 #include "BLI_utildefines.h"
+#include "BLI_utility_mixins.hh"
 
 #include "BLT_translation.hh"
 
@@ -557,6 +561,98 @@ static void animsys_write_orig_anim_rna(PointerRNA *ptr,
   }
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Resolved RNA Path Cache
+ *
+ * Resolving the RNA path of every F-Curve on every frame is a significant part of the playback
+ * time of rigs with many animated channels. The evaluated copy of an animated ID keeps the
+ * resolved paths of its F-Curves between evaluations. The pointers in the cache stay valid for as
+ * long as the evaluated copy is not re-created, in which case the cache is freed together with
+ * the copied #AnimData. The dependency graph additionally frees it when relations are rebuilt.
+ *
+ * Only the animation evaluation of the ID by the dependency graph uses the cache, other callers
+ * (drivers, which are evaluated from multiple threads, or evaluation on original data) keep doing
+ * regular path resolution.
+ * \{ */
+
+struct AnimDataPathCache {
+  struct Item {
+    /* Copy of the path and index the item was resolved for, to detect F-Curves being changed or
+     * re-allocated at the same address. */
+    std::string rna_path;
+    int array_index;
+    /* Unset when the path could not be resolved. */
+    std::optional<PathResolvedRNA> resolved;
+  };
+  blender::Map<const FCurve *, Item> items;
+};
+
+/* Cache used by the animation evaluation running on the current thread. */
+struct ActivePathCache {
+  const ID *id = nullptr;
+  AnimDataPathCache *cache = nullptr;
+};
+static thread_local ActivePathCache active_path_cache;
+
+bool BKE_animsys_rna_path_resolve_cached(PointerRNA *ptr,
+                                         const FCurve *fcu,
+                                         PathResolvedRNA *r_result)
+{
+  AnimDataPathCache *cache = active_path_cache.cache;
+  if (cache == nullptr || fcu->rna_path == nullptr || ptr->owner_id != active_path_cache.id ||
+      ptr->data != ptr->owner_id)
+  {
+    return BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, r_result);
+  }
+
+  AnimDataPathCache::Item *item = cache->items.lookup_ptr(fcu);
+  if (item == nullptr || item->array_index != fcu->array_index || item->rna_path != fcu->rna_path)
+  {
+    AnimDataPathCache::Item new_item;
+    new_item.rna_path = fcu->rna_path;
+    new_item.array_index = fcu->array_index;
+    PathResolvedRNA resolved;
+    if (BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, &resolved)) {
+      new_item.resolved = resolved;
+    }
+    cache->items.add_overwrite(fcu, std::move(new_item));
+    item = &cache->items.lookup(fcu);
+  }
+
+  if (!item->resolved) {
+    return false;
+  }
+  *r_result = *item->resolved;
+  return true;
+}
+
+void BKE_animsys_path_cache_free(AnimData *adt)
+{
+  MEM_delete(adt->path_cache);
+  adt->path_cache = nullptr;
+}
+
+/* Make the cache of the evaluated ID active on this thread for the scope of this object. */
+class ScopedActivePathCache : blender::NonCopyable, blender::NonMovable {
+ public:
+  ScopedActivePathCache(ID *id, AnimData *adt)
+  {
+    if (adt == nullptr || (id->tag & ID_TAG_COPIED_ON_EVAL) == 0) {
+      return;
+    }
+    if (adt->path_cache == nullptr) {
+      adt->path_cache = MEM_new<AnimDataPathCache>(__func__);
+    }
+    active_path_cache = {id, adt->path_cache};
+  }
+  ~ScopedActivePathCache()
+  {
+    active_path_cache = {};
+  }
+};
+
+/** \} */
+
 /**
  * Evaluate all the F-Curves in the given list
  * This performs a set of standard checks. If extra checks are required,
@@ -575,7 +671,7 @@ static void animsys_evaluate_fcurves(PointerRNA *ptr,
     }
 
     PathResolvedRNA anim_rna;
-    if (BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, &anim_rna)) {
+    if (BKE_animsys_rna_path_resolve_cached(ptr, fcu, &anim_rna)) {
       const float curval = calculate_fcurve(&anim_rna, fcu, anim_eval_context);
       BKE_animsys_write_to_rna_path(&anim_rna, curval);
       if (flush_to_original) {
@@ -4161,6 +4257,7 @@ void BKE_animsys_eval_animdata(Depsgraph *depsgraph, ID *id)
 
   const AnimationEvalContext anim_eval_context = BKE_animsys_eval_context_construct(depsgraph,
                                                                                     ctime);
+  ScopedActivePathCache scoped_path_cache(id, adt);
   BKE_animsys_evaluate_animdata(id, adt, &anim_eval_context, ADT_RECALC_ANIM, flush_to_original);
 }
 
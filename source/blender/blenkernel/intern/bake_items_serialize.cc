@@ -255,9 +255,9 @@ DictionaryValuePtr BlobWriteSharing::write_implicitly_shared(
 std::shared_ptr<io::serialize::DictionaryValue> BlobWriteSharing::write_deduplicated(
     BlobWriter &writer, const void *data, const int64_t size_in_bytes)
 {
-  const uint64_t content_hash = XXH3_64bits(data, size_in_bytes);
+  const ContentKey content_key{size_in_bytes, XXH3_64bits(data, size_in_bytes)};
   const BlobSlice slice = slice_by_content_hash_.lookup_or_add_cb(
-      content_hash, [&]() { return writer.write(data, size_in_bytes); });
+      content_key, [&]() { return writer.write(data, size_in_bytes); });
   return slice.serialize();
 }
 
@@ -1346,7 +1346,12 @@ BlendFileData *BKE_blendfile_read(const char *filepath,
     }
   }
 
-  BlendFileData *bfd = BLO_read_from_file(filepath, eBLOReadSkip(params->skip_flags), reports);
+  eBLOReadSkip skip_flags = eBLOReadSkip(params->skip_flags);
+  if ((G.fileflags & G_FILE_DEFER_GEOMETRY_READ) && (skip_flags & BLO_READ_SKIP_DATA) == 0) {
+    skip_flags |= BLO_READ_DEFER_GEOMETRY_DATA;
+  }
+
+  BlendFileData *bfd = BLO_read_from_file(filepath, skip_flags, reports);
   if (bfd && bfd->main->is_read_invalid) {
     BLO_blendfiledata_free(bfd);
     bfd = nullptr;
@@ -10,6 +10,7 @@
 #include "DNA_pointcloud_types.h"
 
 #include "BLI_math_geom.h"
+#include "BLI_task.hh"
 
 #include "BKE_attribute.hh"
 #include "BKE_bvhutils.hh"
@@ -520,6 +521,63 @@ static std::unique_ptr<BVHTree, BVHTreeDeleter> create_tree_from_tris(const Span
   return tree;
 }
 
+/**
+ * Refitting keeps the structure of the tree built for the initial positions, which becomes less
+ * efficient for queries the further the positions move. So the tree is still rebuilt regularly.
+ */
+static constexpr int bvh_cache_refits_max = 16;
+
+static void refit_tree_from_verts(BVHTree &tree, const Span<float3> positions)
+{
+  BLI_assert(BLI_bvhtree_get_len(&tree) == positions.size());
+  threading::parallel_for(positions.index_range(), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      BLI_bvhtree_update_node(&tree, i, positions[i], nullptr, 1);
+    }
+  });
+  BLI_bvhtree_update_tree(&tree);
+}
+
+static void refit_tree_from_tris(BVHTree &tree,
+                                 const Span<float3> positions,
+                                 const Span<int> corner_verts,
+                                 const Span<int3> corner_tris)
+{
+  BLI_assert(BLI_bvhtree_get_len(&tree) == corner_tris.size());
+  threading::parallel_for(corner_tris.index_range(), 2048, [&](const IndexRange range) {
+    for (const int tri : range) {
+      float co[3][3];
+      copy_v3_v3(co[0], positions[corner_verts[corner_tris[tri][0]]]);
+      copy_v3_v3(co[1], positions[corner_verts[corner_tris[tri][1]]]);
+      copy_v3_v3(co[2], positions[corner_verts[corner_tris[tri][2]]]);
+      BLI_bvhtree_update_node(&tree, tri, co[0], nullptr, 3);
+    }
+  });
+  BLI_bvhtree_update_tree(&tree);
+}
+
+/**
+ * Recompute a cached tree, refitting the existing tree to the new positions when the topology
+ * didn't change since it was built, and building it from scratch otherwise.
+ */
+static void update_cached_tree(
+    std::unique_ptr<BVHTree, BVHTreeDeleter> &tree,
+    BVHCacheRefit &refit,
+    const FunctionRef<void(BVHTree &tree)> refit_fn,
+    const FunctionRef<std::unique_ptr<BVHTree, BVHTreeDeleter>()> build_fn)
+{
+  const bool use_refit = tree && refit.only_positions_changed &&
+                         refit.refits_num < bvh_cache_refits_max;
+  refit.only_positions_changed = false;
+  if (use_refit) {
+    refit_fn(*tree);
+    refit.refits_num++;
+    return;
+  }
+  tree = build_fn();
+  refit.refits_num = 0;
+}
+
 static std::unique_ptr<BVHTree, BVHTreeDeleter> create_tree_from_tris(
     const Span<float3> positions,
     const OffsetIndices<int> faces,
@@ -674,7 +732,11 @@ blender::bke::BVHTreeFromMesh Mesh::bvh_verts() const
   using namespace blender::bke;
   const Span<float3> positions = this->vert_positions();
   this->runtime->bvh_cache_verts.ensure([&](std::unique_ptr<BVHTree, BVHTreeDeleter> &data) {
-    data = create_tree_from_verts(positions, positions.index_range());
+    update_cached_tree(
+        data,
+        this->runtime->bvh_cache_verts_refit,
+        [&](BVHTree &tree) { refit_tree_from_verts(tree, positions); },
+        [&]() { return create_tree_from_verts(positions, positions.index_range()); });
   });
   return create_verts_tree_data(this->runtime->bvh_cache_verts.data().get(), positions);
 }
@@ -773,7 +835,11 @@ blender::bke::BVHTreeFromMesh Mesh::bvh_corner_tris() const
   const Span<int> corner_verts = this->corner_verts();
   const Span<int3> corner_tris = this->corner_tris();
   this->runtime->bvh_cache_corner_tris.ensure([&](std::unique_ptr<BVHTree, BVHTreeDeleter> &data) {
-    data = create_tree_from_tris(positions, corner_verts, corner_tris);
+    update_cached_tree(
+        data,
+        this->runtime->bvh_cache_corner_tris_refit,
+        [&](BVHTree &tree) { refit_tree_from_tris(tree, positions, corner_verts, corner_tris); },
+        [&]() { return create_tree_from_tris(positions, corner_verts, corner_tris); });
   });
   return create_tris_tree_data(
       this->runtime->bvh_cache_corner_tris.data().get(), positions, corner_verts, corner_tris);
@@ -19,6 +19,7 @@
 #include "BLI_math_geom.h"
 #include "BLI_math_vector.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 
 #include "BKE_cloth.hh"
 #include "BKE_collection.hh"
@@ -1419,6 +1420,33 @@ static bool cloth_bvh_selfcollisions_nearcheck(ClothModifierData *clmd,
   return data.collided;
 }
 
+/**
+ * Add the accumulated collision impulses to the velocities of the vertices.
+ * \return The number of vertices that received an impulse.
+ */
+static int cloth_collision_apply_impulses(Cloth *cloth)
+{
+  ClothVertex *verts = cloth->verts;
+  return blender::threading::parallel_reduce(
+      blender::IndexRange(cloth->mvert_num),
+      1024,
+      0,
+      [&](const blender::IndexRange range, int count) {
+        for (const int i : range) {
+          /* Calculate "velocities" (just `xnew = xold + v`; no dt in v). */
+          if (verts[i].impulse_count) {
+            add_v3_v3(verts[i].tv, verts[i].impulse);
+            add_v3_v3(verts[i].dcvel, verts[i].impulse);
+            zero_v3(verts[i].impulse);
+            verts[i].impulse_count = 0;
+            count++;
+          }
+        }
+        return count;
+      },
+      std::plus<>());
+}
+
 static int cloth_bvh_objcollisions_resolve(ClothModifierData *clmd,
                                            Object **collobjs,
                                            CollPair **collisions,
@@ -1427,14 +1455,10 @@ static int cloth_bvh_objcollisions_resolve(ClothModifierData *clmd,
                                            const float dt)
 {
   Cloth *cloth = clmd->clothObject;
-  int i = 0, j = 0, mvert_num = 0;
-  ClothVertex *verts = nullptr;
+  int i = 0, j = 0;
   int ret = 0;
   int result = 0;
 
-  mvert_num = clmd->clothObject->mvert_num;
-  verts = cloth->verts;
-
   result = 1;
 
   for (j = 0; j < 2; j++) {
@@ -1453,17 +1477,7 @@ static int cloth_bvh_objcollisions_resolve(ClothModifierData *clmd,
 
     /* Apply impulses in parallel. */
     if (result) {
-      for (i = 0; i < mvert_num; i++) {
-        // calculate "velocities" (just xnew = xold + v; no dt in v)
-        if (verts[i].impulse_count) {
-          add_v3_v3(verts[i].tv, verts[i].impulse);
-          add_v3_v3(verts[i].dcvel, verts[i].impulse);
-          zero_v3(verts[i].impulse);
-          verts[i].impulse_count = 0;
-
-          ret++;
-        }
-      }
+      ret += cloth_collision_apply_impulses(cloth);
     }
     else {
       break;
@@ -1478,14 +1492,10 @@ static int cloth_bvh_selfcollisions_resolve(ClothModifierData *clmd,
                                             const float dt)
 {
   Cloth *cloth = clmd->clothObject;
-  int i = 0, j = 0, mvert_num = 0;
-  ClothVertex *verts = nullptr;
+  int j = 0;
   int ret = 0;
   int result = 0;
 
-  mvert_num = clmd->clothObject->mvert_num;
-  verts = cloth->verts;
-
   for (j = 0; j < 2; j++) {
     result = 0;
 
@@ -1493,17 +1503,7 @@ static int cloth_bvh_selfcollisions_resolve(ClothModifierData *clmd,
 
     /* Apply impulses in parallel. */
     if (result) {
-      for (i = 0; i < mvert_num; i++) {
-        if (verts[i].impulse_count) {
-          // VECADDMUL ( verts[i].tv, verts[i].impulse, 1.0f / verts[i].impulse_count );
-          add_v3_v3(verts[i].tv, verts[i].impulse);
-          add_v3_v3(verts[i].dcvel, verts[i].impulse);
-          zero_v3(verts[i].impulse);
-          verts[i].impulse_count = 0;
-
-          ret++;
-        }
-      }
+      ret += cloth_collision_apply_impulses(cloth);
     }
 
     if (!result) {
@@ -1580,24 +1580,29 @@ int cloth_bvh_collision(
       coll_counts_obj = MEM_calloc_arrayN<uint>(numcollobj, "CollCounts");
       overlap_obj = MEM_calloc_arrayN<BVHTreeOverlap *>(numcollobj, "BVHOverlap");
 
-      for (i = 0; i < numcollobj; i++) {
-        Object *collob = collobjs[i];
-        CollisionModifierData *collmd = (CollisionModifierData *)BKE_modifiers_findby_type(
-            collob, eModifierType_Collision);
-
-        if (!collmd->bvhtree) {
-          continue;
-        }
-
-        /* Move object to position (step) in time. */
-        collision_move_object(collmd, step + dt, step, false);
-
-        overlap_obj[i] = BLI_bvhtree_overlap(cloth_bvh,
-                                             collmd->bvhtree,
-                                             &coll_counts_obj[i],
-                                             is_hair ? nullptr : cloth_bvh_obj_overlap_cb,
-                                             clmd);
-      }
+      /* Every collider only updates its own tree, so the broadphase of all colliders can run
+       * at the same time. */
+      blender::threading::parallel_for(
+          blender::IndexRange(numcollobj), 1, [&](const blender::IndexRange range) {
+            for (const int i : range) {
+              Object *collob = collobjs[i];
+              CollisionModifierData *collmd = (CollisionModifierData *)BKE_modifiers_findby_type(
+                  collob, eModifierType_Collision);
+
+              if (!collmd->bvhtree) {
+                continue;
+              }
+
+              /* Move object to position (step) in time. */
+              collision_move_object(collmd, step + dt, step, false);
+
+              overlap_obj[i] = BLI_bvhtree_overlap(cloth_bvh,
+                                                   collmd->bvhtree,
+                                                   &coll_counts_obj[i],
+                                                   is_hair ? nullptr : cloth_bvh_obj_overlap_cb,
+                                                   clmd);
+            }
+          });
     }
   }
 
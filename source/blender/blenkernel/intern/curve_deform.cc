@@ -14,6 +14,7 @@
 #include "BLI_math_matrix.h"
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "DNA_curve_types.h"
@@ -28,6 +29,11 @@
 
 #include "BKE_deform.hh"
 
+using namespace blender;
+
+/** Evaluating the curve path is relatively expensive, so small chunks are worth threading. */
+#define CURVE_DEFORM_GRAIN_SIZE 512
+
 /* -------------------------------------------------------------------- */
 /** \name Curve Deform Internal Utilities
  * \{ */
@@ -212,6 +218,9 @@ static void curve_deform_coords_impl(const Object *ob_curve,
   const bool invert_vgroup = (flag & MOD_CURVE_INVERT_VGROUP) != 0;
   bool use_dverts = false;
   int cd_dvert_offset;
+  /* Without an edit-mesh vertices are deformed in parallel, #CurveDeform is read-only
+   * once the bounds have been calculated. */
+  const IndexRange vert_range(vert_coords_len);
 
   if (ob_curve->type != OB_CURVES_LEGACY) {
     return;
@@ -253,7 +262,7 @@ static void curve_deform_coords_impl(const Object *ob_curve,
   if (use_dverts) {
     if (cu->flag & CU_DEFORM_BOUNDS_OFF) {
 
-#define DEFORM_OP(dvert) \
+#define DEFORM_OP(dvert, a) \
   { \
     const float weight = invert_vgroup ? 1.0f - BKE_defvert_find_weight(dvert, defgrp_index) : \
                                          BKE_defvert_find_weight(dvert, defgrp_index); \
@@ -273,20 +282,22 @@ static void curve_deform_coords_impl(const Object *ob_curve,
         BMVert *v;
         BM_ITER_MESH_INDEX (v, &iter, em_target->bm, BM_VERTS_OF_MESH, a) {
           dvert = static_cast<const MDeformVert *>(BM_ELEM_CD_GET_VOID_P(v, cd_dvert_offset));
-          DEFORM_OP(dvert);
+          DEFORM_OP(dvert, a);
         }
       }
       else {
-        for (a = 0; a < vert_coords_len; a++) {
-          DEFORM_OP(&dvert[a]);
-        }
+        threading::parallel_for(vert_range, CURVE_DEFORM_GRAIN_SIZE, [&](const IndexRange range) {
+          for (const int i : range) {
+            DEFORM_OP(&dvert[i], i);
+          }
+        });
       }
 
 #undef DEFORM_OP
     }
     else {
 
-#define DEFORM_OP_MINMAX(dvert) \
+#define DEFORM_OP_MINMAX(dvert, a) \
   { \
     const float weight = invert_vgroup ? 1.0f - BKE_defvert_find_weight(dvert, defgrp_index) : \
                                          BKE_defvert_find_weight(dvert, defgrp_index); \
@@ -298,7 +309,7 @@ static void curve_deform_coords_impl(const Object *ob_curve,
   ((void)0)
 
 /* Already in 'cd.curvespace', previous for loop. */
-#define DEFORM_OP_CLAMPED(dvert) \
+#define DEFORM_OP_CLAMPED(dvert, a) \
   { \
     const float weight = invert_vgroup ? 1.0f - BKE_defvert_find_weight(dvert, defgrp_index) : \
                                          BKE_defvert_find_weight(dvert, defgrp_index); \
@@ -317,23 +328,25 @@ static void curve_deform_coords_impl(const Object *ob_curve,
         BMVert *v;
         BM_ITER_MESH_INDEX (v, &iter, em_target->bm, BM_VERTS_OF_MESH, a) {
           dvert = static_cast<const MDeformVert *>(BM_ELEM_CD_GET_VOID_P(v, cd_dvert_offset));
-          DEFORM_OP_MINMAX(dvert);
+          DEFORM_OP_MINMAX(dvert, a);
         }
 
         BM_ITER_MESH_INDEX (v, &iter, em_target->bm, BM_VERTS_OF_MESH, a) {
           dvert = static_cast<const MDeformVert *>(BM_ELEM_CD_GET_VOID_P(v, cd_dvert_offset));
-          DEFORM_OP_CLAMPED(dvert);
+          DEFORM_OP_CLAMPED(dvert, a);
         }
       }
       else {
 
         for (a = 0; a < vert_coords_len; a++) {
-          DEFORM_OP_MINMAX(&dvert[a]);
+          DEFORM_OP_MINMAX(&dvert[a], a);
         }
 
-        for (a = 0; a < vert_coords_len; a++) {
-          DEFORM_OP_CLAMPED(&dvert[a]);
-        }
+        threading::parallel_for(vert_range, CURVE_DEFORM_GRAIN_SIZE, [&](const IndexRange range) {
+          for (const int i : range) {
+            DEFORM_OP_CLAMPED(&dvert[i], i);
+          }
+        });
       }
     }
 
@@ -342,11 +355,13 @@ static void curve_deform_coords_impl(const Object *ob_curve,
   }
   else {
     if (cu->flag & CU_DEFORM_BOUNDS_OFF) {
-      for (a = 0; a < vert_coords_len; a++) {
-        mul_m4_v3(cd.curvespace, vert_coords[a]);
-        calc_curve_deform(ob_curve, vert_coords[a], defaxis, &cd, nullptr);
-        mul_m4_v3(cd.objectspace, vert_coords[a]);
-      }
+      threading::parallel_for(vert_range, CURVE_DEFORM_GRAIN_SIZE, [&](const IndexRange range) {
+        for (const int i : range) {
+          mul_m4_v3(cd.curvespace, vert_coords[i]);
+          calc_curve_deform(ob_curve, vert_coords[i], defaxis, &cd, nullptr);
+          mul_m4_v3(cd.objectspace, vert_coords[i]);
+        }
+      });
     }
     else {
       for (a = 0; a < vert_coords_len; a++) {
@@ -354,11 +369,13 @@ static void curve_deform_coords_impl(const Object *ob_curve,
         minmax_v3v3_v3(cd.dmin, cd.dmax, vert_coords[a]);
       }
 
-      for (a = 0; a < vert_coords_len; a++) {
-        /* Already in 'cd.curvespace', previous for loop. */
-        calc_curve_deform(ob_curve, vert_coords[a], defaxis, &cd, nullptr);
-        mul_m4_v3(cd.objectspace, vert_coords[a]);
-      }
+      threading::parallel_for(vert_range, CURVE_DEFORM_GRAIN_SIZE, [&](const IndexRange range) {
+        for (const int i : range) {
+          /* Already in 'cd.curvespace', previous for loop. */
+          calc_curve_deform(ob_curve, vert_coords[i], defaxis, &cd, nullptr);
+          mul_m4_v3(cd.objectspace, vert_coords[i]);
+        }
+      });
     }
   }
 }
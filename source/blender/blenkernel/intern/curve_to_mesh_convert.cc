@@ -25,6 +25,16 @@ static int segments_num_no_duplicate_edge(const int points_num, const bool cycli
   return curves::segments_num(points_num, cyclic);
 }
 
+/**
+ * Combinations are already processed in parallel, but a few long curves (ropes, cables)
+ * would otherwise be filled on a single thread. Split the rings of a single combination
+ * into chunks of roughly constant size instead.
+ */
+static int ring_grain_size(const int elements_per_ring)
+{
+  return std::max(1, 2048 / std::max(1, elements_per_ring));
+}
+
 static void fill_mesh_topology(const int vert_offset,
                                const int edge_offset,
                                const int face_offset,
@@ -59,70 +69,80 @@ static void fill_mesh_topology(const int vert_offset,
 
   /* Add the edges running along the length of the curve, starting at each profile vertex. */
   const int main_edges_start = edge_offset;
-  for (const int i_profile : IndexRange(profile_point_num)) {
-    const int profile_edge_offset = main_edges_start + i_profile * main_segment_num;
-    for (const int i_ring : IndexRange(main_segment_num)) {
-      const int i_next_ring = (i_ring == main_point_num - 1) ? 0 : i_ring + 1;
-
-      const int ring_vert_offset = vert_offset + profile_point_num * i_ring;
-      const int next_ring_vert_offset = vert_offset + profile_point_num * i_next_ring;
-
-      int2 &edge = edges[profile_edge_offset + i_ring];
-      edge[0] = ring_vert_offset + i_profile;
-      edge[1] = next_ring_vert_offset + i_profile;
-    }
-  }
+  threading::parallel_for(
+      IndexRange(profile_point_num),
+      ring_grain_size(main_segment_num),
+      [&](const IndexRange profile_range) {
+        for (const int i_profile : profile_range) {
+          const int profile_edge_offset = main_edges_start + i_profile * main_segment_num;
+          for (const int i_ring : IndexRange(main_segment_num)) {
+            const int i_next_ring = (i_ring == main_point_num - 1) ? 0 : i_ring + 1;
+
+            const int ring_vert_offset = vert_offset + profile_point_num * i_ring;
+            const int next_ring_vert_offset = vert_offset + profile_point_num * i_next_ring;
+
+            int2 &edge = edges[profile_edge_offset + i_ring];
+            edge[0] = ring_vert_offset + i_profile;
+            edge[1] = next_ring_vert_offset + i_profile;
+          }
+        }
+      });
 
   /* Add the edges running along each profile ring. */
   const int profile_edges_start = main_edges_start + profile_point_num * main_segment_num;
-  for (const int i_ring : IndexRange(main_point_num)) {
-    const int ring_vert_offset = vert_offset + profile_point_num * i_ring;
+  const int grain_size = ring_grain_size(profile_segment_num);
+  threading::parallel_for(IndexRange(main_point_num), grain_size, [&](const IndexRange rings) {
+    for (const int i_ring : rings) {
+      const int ring_vert_offset = vert_offset + profile_point_num * i_ring;
 
-    const int ring_edge_offset = profile_edges_start + i_ring * profile_segment_num;
-    for (const int i_profile : IndexRange(profile_segment_num)) {
-      const int i_next_profile = (i_profile == profile_point_num - 1) ? 0 : i_profile + 1;
+      const int ring_edge_offset = profile_edges_start + i_ring * profile_segment_num;
+      for (const int i_profile : IndexRange(profile_segment_num)) {
+        const int i_next_profile = (i_profile == profile_point_num - 1) ? 0 : i_profile + 1;
 
-      int2 &edge = edges[ring_edge_offset + i_profile];
-      edge[0] = ring_vert_offset + i_profile;
-      edge[1] = ring_vert_offset + i_next_profile;
+        int2 &edge = edges[ring_edge_offset + i_profile];
+        edge[0] = ring_vert_offset + i_profile;
+        edge[1] = ring_vert_offset + i_next_profile;
+      }
     }
-  }
+  });
 
   /* Calculate face and corner indices. */
-  for (const int i_ring : IndexRange(main_segment_num)) {
-    const int i_next_ring = (i_ring == main_point_num - 1) ? 0 : i_ring + 1;
+  threading::parallel_for(IndexRange(main_segment_num), grain_size, [&](const IndexRange rings) {
+    for (const int i_ring : rings) {
+      const int i_next_ring = (i_ring == main_point_num - 1) ? 0 : i_ring + 1;
 
-    const int ring_vert_offset = vert_offset + profile_point_num * i_ring;
-    const int next_ring_vert_offset = vert_offset + profile_point_num * i_next_ring;
+      const int ring_vert_offset = vert_offset + profile_point_num * i_ring;
+      const int next_ring_vert_offset = vert_offset + profile_point_num * i_next_ring;
 
-    const int ring_edge_start = profile_edges_start + profile_segment_num * i_ring;
-    const int next_ring_edge_offset = profile_edges_start + profile_segment_num * i_next_ring;
+      const int ring_edge_start = profile_edges_start + profile_segment_num * i_ring;
+      const int next_ring_edge_offset = profile_edges_start + profile_segment_num * i_next_ring;
 
-    const int ring_face_offset = face_offset + i_ring * profile_segment_num;
-    const int ring_loop_offset = loop_offset + i_ring * profile_segment_num * 4;
+      const int ring_face_offset = face_offset + i_ring * profile_segment_num;
+      const int ring_loop_offset = loop_offset + i_ring * profile_segment_num * 4;
 
-    for (const int i_profile : IndexRange(profile_segment_num)) {
-      const int ring_segment_loop_offset = ring_loop_offset + i_profile * 4;
-      const int i_next_profile = (i_profile == profile_point_num - 1) ? 0 : i_profile + 1;
+      for (const int i_profile : IndexRange(profile_segment_num)) {
+        const int ring_segment_loop_offset = ring_loop_offset + i_profile * 4;
+        const int i_next_profile = (i_profile == profile_point_num - 1) ? 0 : i_profile + 1;
 
-      const int main_edge_start = main_edges_start + main_segment_num * i_profile;
-      const int next_main_edge_start = main_edges_start + main_segment_num * i_next_profile;
+        const int main_edge_start = main_edges_start + main_segment_num * i_profile;
+        const int next_main_edge_start = main_edges_start + main_segment_num * i_next_profile;
 
-      face_offsets[ring_face_offset + i_profile] = ring_segment_loop_offset;
+        face_offsets[ring_face_offset + i_profile] = ring_segment_loop_offset;
 
-      corner_verts[ring_segment_loop_offset] = ring_vert_offset + i_profile;
-      corner_edges[ring_segment_loop_offset] = ring_edge_start + i_profile;
+        corner_verts[ring_segment_loop_offset] = ring_vert_offset + i_profile;
+        corner_edges[ring_segment_loop_offset] = ring_edge_start + i_profile;
 
-      corner_verts[ring_segment_loop_offset + 1] = ring_vert_offset + i_next_profile;
-      corner_edges[ring_segment_loop_offset + 1] = next_main_edge_start + i_ring;
+        corner_verts[ring_segment_loop_offset + 1] = ring_vert_offset + i_next_profile;
+        corner_edges[ring_segment_loop_offset + 1] = next_main_edge_start + i_ring;
 
-      corner_verts[ring_segment_loop_offset + 2] = next_ring_vert_offset + i_next_profile;
-      corner_edges[ring_segment_loop_offset + 2] = next_ring_edge_offset + i_profile;
+        corner_verts[ring_segment_loop_offset + 2] = next_ring_vert_offset + i_next_profile;
+        corner_edges[ring_segment_loop_offset + 2] = next_ring_edge_offset + i_profile;
 
-      corner_verts[ring_segment_loop_offset + 3] = next_ring_vert_offset + i_profile;
-      corner_edges[ring_segment_loop_offset + 3] = main_edge_start + i_ring;
+        corner_verts[ring_segment_loop_offset + 3] = next_ring_vert_offset + i_profile;
+        corner_edges[ring_segment_loop_offset + 3] = main_edge_start + i_ring;
+      }
     }
-  }
+  });
 
   const bool has_caps = fill_caps && !main_cyclic && profile_cyclic && profile_point_num > 2;
   if (has_caps) {
@@ -192,31 +212,34 @@ static void fill_mesh_positions(const int main_point_num,
                                 const Span<float> scales,
                                 MutableSpan<float3> mesh_positions)
 {
-  if (profile_point_num == 1) {
-    for (const int i_ring : IndexRange(main_point_num)) {
-      float4x4 point_matrix = build_point_matrix(
-          main_positions[i_ring], normals[i_ring], tangents[i_ring]);
-      if (!scales.is_empty()) {
-        point_matrix = math::scale(point_matrix, float3(scales[i_ring]));
+  const int grain_size = ring_grain_size(profile_point_num);
+  threading::parallel_for(IndexRange(main_point_num), grain_size, [&](const IndexRange rings) {
+    if (profile_point_num == 1) {
+      for (const int i_ring : rings) {
+        float4x4 point_matrix = build_point_matrix(
+            main_positions[i_ring], normals[i_ring], tangents[i_ring]);
+        if (!scales.is_empty()) {
+          point_matrix = math::scale(point_matrix, float3(scales[i_ring]));
+        }
+        mesh_positions[i_ring] = math::transform_point(point_matrix, profile_positions.first());
       }
-      mesh_positions[i_ring] = math::transform_point(point_matrix, profile_positions.first());
     }
-  }
-  else {
-    for (const int i_ring : IndexRange(main_point_num)) {
-      float4x4 point_matrix = build_point_matrix(
-          main_positions[i_ring], normals[i_ring], tangents[i_ring]);
-      if (!scales.is_empty()) {
-        point_matrix = math::scale(point_matrix, float3(scales[i_ring]));
-      }
+    else {
+      for (const int i_ring : rings) {
+        float4x4 point_matrix = build_point_matrix(
+            main_positions[i_ring], normals[i_ring], tangents[i_ring]);
+        if (!scales.is_empty()) {
+          point_matrix = math::scale(point_matrix, float3(scales[i_ring]));
+        }
 
-      const int ring_vert_start = i_ring * profile_point_num;
-      for (const int i_profile : IndexRange(profile_point_num)) {
-        mesh_positions[ring_vert_start + i_profile] = math::transform_point(
-            point_matrix, profile_positions[i_profile]);
+        const int ring_vert_start = i_ring * profile_point_num;
+        for (const int i_profile : IndexRange(profile_point_num)) {
+          mesh_positions[ring_vert_start + i_profile] = math::transform_point(
+              point_matrix, profile_positions[i_profile]);
+        }
       }
     }
-  }
+  });
 }
 
 struct CurvesInfo {
@@ -28,6 +28,7 @@
 #include "BLI_math_vector.hh"
 #include "BLI_memory_counter.hh"
 #include "BLI_mempool.h"
+#include "BLI_offset_indices.hh"
 #include "BLI_path_utils.hh"
 #include "BLI_set.hh"
 #include "BLI_span.hh"
@@ -35,7 +36,9 @@
 #include "BLI_string_ref.hh"
 #include "BLI_string_utf8.h"
 #include "BLI_string_utils.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #ifndef NDEBUG
 #  include "BLI_dynstr.h"
@@ -66,9 +69,11 @@
 using blender::Array;
 using blender::BitVector;
 using blender::float2;
+using blender::float3;
 using blender::ImplicitSharingInfo;
 using blender::IndexRange;
 using blender::MutableSpan;
+using blender::OffsetIndices;
 using blender::Set;
 using blender::Span;
 using blender::StringRef;
@@ -206,24 +211,24 @@ struct LayerTypeInfo {
 
 static void layerCopy_mdeformvert(const void *source, void *dest, const int count)
 {
-  int i, size = sizeof(MDeformVert);
-
-  memcpy(dest, source, count * size);
-
-  for (i = 0; i < count; i++) {
-    MDeformVert *dvert = static_cast<MDeformVert *>(POINTER_OFFSET(dest, i * size));
-
-    if (dvert->totweight) {
-      MDeformWeight *dw = static_cast<MDeformWeight *>(
-          MEM_malloc_arrayN(dvert->totweight, sizeof(*dw), __func__));
-
-      memcpy(dw, dvert->dw, dvert->totweight * sizeof(*dw));
-      dvert->dw = dw;
-    }
-    else {
-      dvert->dw = nullptr;
+  const Span<MDeformVert> src(static_cast<const MDeformVert *>(source), count);
+  MutableSpan<MDeformVert> dst(static_cast<MDeformVert *>(dest), count);
+
+  /* Every vertex owns a separate weight array, so copying large layers is dominated by the
+   * allocations, which benefit from being spread over multiple threads. */
+  blender::threading::parallel_for(src.index_range(), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      dst[i] = src[i];
+      if (src[i].totweight) {
+        dst[i].dw = static_cast<MDeformWeight *>(
+            MEM_malloc_arrayN(src[i].totweight, sizeof(MDeformWeight), __func__));
+        std::copy_n(src[i].dw, src[i].totweight, dst[i].dw);
+      }
+      else {
+        dst[i].dw = nullptr;
+      }
     }
-  }
+  });
 }
 
 static void layerFree_mdeformvert(void *data, const int count)
@@ -243,52 +248,33 @@ static void layerInterp_mdeformvert(const void **sources,
                                     const int count,
                                     void *dest)
 {
-  /* A single linked list of #MDeformWeight's.
-   * use this to avoid double allocations (which #LinkNode would do). */
-  struct MDeformWeight_Link {
-    MDeformWeight_Link *next;
-    MDeformWeight dw;
-  };
-
   MDeformVert *dvert = static_cast<MDeformVert *>(dest);
-  MDeformWeight_Link *dest_dwlink = nullptr;
-  MDeformWeight_Link *node;
 
-  /* build a list of unique def_nrs for dest */
-  int totweight = 0;
+  /* Build an array of unique def_nrs for dest. Elements rarely have more than a few weights, so
+   * a linear search in an inline buffer is faster than any kind of map. */
+  Vector<MDeformWeight, 16> dest_dw;
   for (int i = 0; i < count; i++) {
     const MDeformVert *source = static_cast<const MDeformVert *>(sources[i]);
-    float interp_weight = weights[i];
-
-    for (int j = 0; j < source->totweight; j++) {
-      MDeformWeight *dw = &source->dw[j];
-      float weight = dw->weight * interp_weight;
+    const float interp_weight = weights[i];
+    if (interp_weight == 0.0f) {
+      continue;
+    }
 
+    for (const MDeformWeight &dw : Span(source->dw, source->totweight)) {
+      const float weight = dw.weight * interp_weight;
       if (weight == 0.0f) {
         continue;
       }
 
-      for (node = dest_dwlink; node; node = node->next) {
-        MDeformWeight *tmp_dw = &node->dw;
-
-        if (tmp_dw->def_nr == dw->def_nr) {
-          tmp_dw->weight += weight;
-          break;
-        }
+      MDeformWeight *tmp_dw = std::find_if(
+          dest_dw.begin(), dest_dw.end(), [&](const MDeformWeight &other) {
+            return other.def_nr == dw.def_nr;
+          });
+      if (tmp_dw != dest_dw.end()) {
+        tmp_dw->weight += weight;
       }
-
-      /* if this def_nr is not in the list, add it */
-      if (!node) {
-        MDeformWeight_Link *tmp_dwlink = static_cast<MDeformWeight_Link *>(
-            alloca(sizeof(*tmp_dwlink)));
-        tmp_dwlink->dw.def_nr = dw->def_nr;
-        tmp_dwlink->dw.weight = weight;
-
-        /* Inline linked-list. */
-        tmp_dwlink->next = dest_dwlink;
-        dest_dwlink = tmp_dwlink;
-
-        totweight++;
+      else {
+        dest_dw.append({dw.def_nr, weight});
       }
     }
   }
@@ -296,6 +282,7 @@ static void layerInterp_mdeformvert(const void **sources,
   /* Delay writing to the destination in case dest is in sources. */
 
   /* now we know how many unique deform weights there are, so realloc */
+  const int totweight = dest_dw.size();
   if (dvert->dw && (dvert->totweight == totweight)) {
     /* pass (fast-path if we don't need to realloc). */
   }
@@ -312,10 +299,8 @@ static void layerInterp_mdeformvert(const void **sources,
 
   if (totweight) {
     dvert->totweight = totweight;
-    int i = 0;
-    for (node = dest_dwlink; node; node = node->next, i++) {
-      node->dw.weight = std::min(node->dw.weight, 1.0f);
-      dvert->dw[i] = node->dw;
+    for (const int i : dest_dw.index_range()) {
+      dvert->dw[i] = {dest_dw[i].def_nr, std::min(dest_dw[i].weight, 1.0f)};
     }
   }
   else {
@@ -3409,39 +3394,59 @@ void CustomData_copy_data_named(const CustomData *source,
   }
 }
 
-void CustomData_copy_data(const CustomData *source,
-                          CustomData *dest,
-                          const int source_index,
-                          const int dest_index,
-                          const int count)
+/**
+ * Pair every source layer with the destination layer it is copied or interpolated to. Layers are
+ * ordered by type, when there are multiple layers of the same type they are matched in order.
+ */
+static Vector<std::pair<int, int>, 16> customdata_matching_layers(const CustomData *source,
+                                                                  const CustomData *dest,
+                                                                  const bool only_interp)
 {
-  /* copies a layer at a time */
+  Vector<std::pair<int, int>, 16> layer_pairs;
   int dest_i = 0;
   for (int src_i = 0; src_i < source->totlayer; src_i++) {
-
-    /* find the first dest layer with type >= the source type
-     * (this should work because layers are ordered by type)
-     */
-    while (dest_i < dest->totlayer && dest->layers[dest_i].type < source->layers[src_i].type) {
+    const eCustomDataType type = eCustomDataType(source->layers[src_i].type);
+    if (only_interp && !layerType_getInfo(type)->interp) {
+      continue;
+    }
+    while (dest_i < dest->totlayer && dest->layers[dest_i].type < type) {
       dest_i++;
     }
-
-    /* if there are no more dest layers, we're done */
     if (dest_i >= dest->totlayer) {
-      return;
+      break;
     }
-
-    /* if we found a matching layer, copy the data */
-    if (dest->layers[dest_i].type == source->layers[src_i].type) {
-      CustomData_copy_data_layer(source, dest, src_i, dest_i, source_index, dest_index, count);
-
-      /* if there are multiple source & dest layers of the same type,
-       * we don't want to copy all source layers to the same dest, so
-       * increment dest_i
-       */
+    if (dest->layers[dest_i].type == type) {
+      layer_pairs.append({src_i, dest_i});
       dest_i++;
     }
   }
+  return layer_pairs;
+}
+
+void CustomData_copy_data(const CustomData *source,
+                          CustomData *dest,
+                          const int source_index,
+                          const int dest_index,
+                          const int count)
+{
+  const Vector<std::pair<int, int>, 16> layer_pairs = customdata_matching_layers(
+      source, dest, false);
+
+  /* Large copies of several layers are memory bound, copy the layers in parallel. */
+  if (count >= 4096 && layer_pairs.size() > 1) {
+    blender::threading::parallel_for(layer_pairs.index_range(), 1, [&](const IndexRange range) {
+      for (const int i : range) {
+        const auto [src_i, dest_i] = layer_pairs[i];
+        CustomData_copy_data_layer(source, dest, src_i, dest_i, source_index, dest_index, count);
+      }
+    });
+    return;
+  }
+
+  /* copies a layer at a time */
+  for (const auto [src_i, dest_i] : layer_pairs) {
+    CustomData_copy_data_layer(source, dest, src_i, dest_i, source_index, dest_index, count);
+  }
 }
 
 void CustomData_copy_layer_type_data(const CustomData *source,
@@ -3567,6 +3572,131 @@ void CustomData_interp(const CustomData *source,
   }
 }
 
+template<typename T>
+static void interp_batch_typed(const Span<T> src,
+                               MutableSpan<T> dst,
+                               const OffsetIndices<int> src_groups,
+                               const Span<int> src_indices,
+                               const Span<float> weights)
+{
+  blender::threading::parallel_for(dst.index_range(), 2048, [&](const IndexRange range) {
+    for (const int i : range) {
+      const IndexRange group = src_groups[i];
+      if (group.is_empty()) {
+        continue;
+      }
+      T result(0.0f);
+      if (weights.is_empty()) {
+        const float weight = 1.0f / float(group.size());
+        for (const int src_index : src_indices.slice(group)) {
+          result += src[src_index] * weight;
+        }
+      }
+      else {
+        for (const int j : group) {
+          result += src[src_indices[j]] * weights[j];
+        }
+      }
+      dst[i] = result;
+    }
+  });
+}
+
+static void interp_batch_generic(const LayerTypeInfo &type_info,
+                                 const void *src_data,
+                                 void *dst_data,
+                                 const OffsetIndices<int> src_groups,
+                                 const Span<int> src_indices,
+                                 const Span<float> weights)
+{
+  blender::threading::parallel_for(src_groups.index_range(), 1024, [&](const IndexRange range) {
+    Vector<const void *, 16> sources;
+    Vector<float, 16> default_weights;
+    for (const int i : range) {
+      const IndexRange group = src_groups[i];
+      if (group.is_empty()) {
+        continue;
+      }
+      sources.clear();
+      for (const int src_index : src_indices.slice(group)) {
+        sources.append(POINTER_OFFSET(src_data, size_t(src_index) * type_info.size));
+      }
+      const float *group_weights;
+      if (weights.is_empty()) {
+        default_weights.clear();
+        default_weights.append_n_times(1.0f / float(group.size()), group.size());
+        group_weights = default_weights.data();
+      }
+      else {
+        group_weights = &weights[group.start()];
+      }
+      type_info.interp(sources.data(),
+                       group_weights,
+                       nullptr,
+                       int(group.size()),
+                       POINTER_OFFSET(dst_data, size_t(i) * type_info.size));
+    }
+  });
+}
+
+void CustomData_interp_batch(const CustomData *source,
+                             CustomData *dest,
+                             const OffsetIndices<int> src_groups,
+                             const Span<int> src_indices,
+                             const Span<float> weights,
+                             const int dest_start)
+{
+  BLI_assert(weights.is_empty() || weights.size() == src_indices.size());
+  if (src_groups.is_empty()) {
+    return;
+  }
+  const int dest_num = src_groups.size();
+  const Vector<std::pair<int, int>, 16> layer_pairs = customdata_matching_layers(
+      source, dest, true);
+  const int src_num = src_indices.is_empty() ?
+                          0 :
+                          *std::max_element(src_indices.begin(), src_indices.end()) + 1;
+
+  blender::threading::parallel_for(layer_pairs.index_range(), 1, [&](const IndexRange range) {
+    for (const int layer_i : range) {
+      const auto [src_i, dest_i] = layer_pairs[layer_i];
+      const eCustomDataType type = eCustomDataType(source->layers[src_i].type);
+      const LayerTypeInfo &type_info = *layerType_getInfo(type);
+      const void *src_data = source->layers[src_i].data;
+      void *dst_data = POINTER_OFFSET(dest->layers[dest_i].data,
+                                      size_t(dest_start) * type_info.size);
+      /* Use typed kernels for the common types that are interpolated as a plain weighted sum,
+       * avoiding the per-element indirection of the generic callbacks. */
+      switch (type) {
+        case CD_PROP_FLOAT:
+          interp_batch_typed(Span(static_cast<const float *>(src_data), src_num),
+                             MutableSpan(static_cast<float *>(dst_data), dest_num),
+                             src_groups,
+                             src_indices,
+                             weights);
+          break;
+        case CD_PROP_FLOAT2:
+          interp_batch_typed(Span(static_cast<const float2 *>(src_data), src_num),
+                             MutableSpan(static_cast<float2 *>(dst_data), dest_num),
+                             src_groups,
+                             src_indices,
+                             weights);
+          break;
+        case CD_PROP_FLOAT3:
+          interp_batch_typed(Span(static_cast<const float3 *>(src_data), src_num),
+                             MutableSpan(static_cast<float3 *>(dst_data), dest_num),
+                             src_groups,
+                             src_indices,
+                             weights);
+          break;
+        default:
+          interp_batch_generic(type_info, src_data, dst_data, src_groups, src_indices, weights);
+          break;
+      }
+    }
+  });
+}
+
 void CustomData_swap_corners(CustomData *data, const int index, const int *corner_indices)
 {
   for (int i = 0; i < data->totlayer; i++) {
@@ -5355,6 +5485,23 @@ static void blend_read_layer_data(BlendDataReader *reader, CustomDataLayer &laye
   }
 }
 
+/**
+ * Plain data layers may be referenced directly in the memory-mapped file instead of being copied.
+ */
+static const ImplicitSharingInfo *blend_read_layer_data_mapped(BlendDataReader *reader,
+                                                               CustomDataLayer &layer,
+                                                               const int count)
+{
+  const LayerTypeInfo *typeInfo = layerType_getInfo(eCustomDataType(layer.type));
+  if (!typeInfo || typeInfo->copy || typeInfo->free || (layer.flag & CD_FLAG_EXTERNAL)) {
+    return nullptr;
+  }
+  return BLO_read_mapped_data(reader,
+                              int64_t(typeInfo->size) * count,
+                              std::max(typeInfo->alignment, 1),
+                              const_cast<const void **>(&layer.data));
+}
+
 void CustomData_blend_read(BlendDataReader *reader, CustomData *data, const int count)
 {
   BLO_read_struct_array(reader, CustomDataLayer, data->totlayer, &data->layers);
@@ -5380,6 +5527,11 @@ void CustomData_blend_read(BlendDataReader *reader, CustomData *data, const int
     if (CustomData_verify_versions(data, i)) {
       layer->sharing_info = BLO_read_shared(
           reader, &layer->data, [&]() -> const ImplicitSharingInfo * {
+            if (const ImplicitSharingInfo *sharing_info = blend_read_layer_data_mapped(
+                    reader, *layer, count))
+            {
+              return sharing_info;
+            }
             blend_read_layer_data(reader, *layer, count);
             if (layer->data == nullptr) {
               return nullptr;
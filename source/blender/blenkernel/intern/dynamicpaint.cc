@@ -24,6 +24,7 @@
 #include "BLI_string_utf8.h"
 #include "BLI_string_utils.hh"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
@@ -5005,10 +5006,17 @@ static void dynamicPaint_doSmudge(DynamicPaintSurface *surface,
   }
 
   /* find max velocity */
-  for (int index = 0; index < sData->total_points; index++) {
-    float vel = bData->brush_velocity[index * 4 + 3];
-    CLAMP_MIN(max_velocity, vel);
-  }
+  max_velocity = blender::threading::parallel_reduce(
+      blender::IndexRange(sData->total_points),
+      4096,
+      0.0f,
+      [&](const blender::IndexRange range, float max_vel) {
+        for (const int index : range) {
+          max_vel = std::max(max_vel, bData->brush_velocity[index * 4 + 3]);
+        }
+        return max_vel;
+      },
+      [](const float a, const float b) { return std::max(a, b); });
 
   int steps = int(ceil(double(max_velocity) / bData->average_dist * double(timescale)));
   CLAMP(steps, 0, 12);
@@ -5742,15 +5750,12 @@ static void dynamic_paint_wave_step_cb(void *__restrict userdata,
 static void dynamicPaint_doWaveStep(DynamicPaintSurface *surface, float timescale)
 {
   PaintSurfaceData *sData = surface->data;
-  BakeAdjPoint *bNeighs = sData->bData->bNeighs;
-  int index;
   int steps, ss;
   float dt, min_dist, damp_factor;
   const float wave_speed = surface->wave_speed;
   const float wave_max_slope = (surface->wave_smoothness >= 0.01f) ?
                                    (0.5f / surface->wave_smoothness) :
                                    0.0f;
-  double average_dist = 0.0f;
   const float canvas_size = getSurfaceDimension(sData);
   const float wave_scale = CANVAS_REL_SIZE / canvas_size;
 
@@ -5761,15 +5766,8 @@ static void dynamicPaint_doWaveStep(DynamicPaintSurface *surface, float timescal
     return;
   }
 
-  /* calculate average neigh distance (single thread) */
-  for (index = 0; index < sData->total_points; index++) {
-    int numOfNeighs = sData->adj_data->n_num[index];
-
-    for (int i = 0; i < numOfNeighs; i++) {
-      average_dist += double(bNeighs[sData->adj_data->n_index[index] + i].dist);
-    }
-  }
-  average_dist *= double(wave_scale) / sData->adj_data->total_targets;
+  /* Average neighbor distance, already calculated when preparing the adjacency data. */
+  const double average_dist = sData->bData->average_dist * double(wave_scale);
 
   /* determine number of required steps */
   steps = int(ceil(double(WAVE_TIME_FAC * timescale * surface->wave_timescale) /
@@ -6,6 +6,7 @@
  * \ingroup bke
  */
 
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <cstddef>
@@ -50,6 +51,8 @@
 
 #include "CLG_log.h"
 
+#include "atomic_ops.h"
+
 #define SMALL -1.0e-10
 #define SELECT 1
 
@@ -2008,6 +2011,47 @@ static float fcurve_eval_keyframes_extrapolate(const FCurve *fcu,
   return endpoint_bezt->vec[1][1] - (fac * dx);
 }
 
+/**
+ * Same as #BKE_fcurve_bezt_binarysearch_index_ex(), but first checks the segment found by the
+ * previous evaluation of the curve and the one following it. During playback the evaluation time
+ * advances in small steps, so most evaluations do not need the search.
+ *
+ * The hint is only accepted when the evaluation time is strictly inside the segment, further than
+ * the threshold from both of its keyframes. In that case the binary search gives the same result.
+ */
+static int fcurve_eval_keyframe_index(const FCurve *fcu,
+                                      const BezTriple *bezts,
+                                      const float evaltime,
+                                      const float threshold,
+                                      bool *r_exact)
+{
+  const int totvert = int(fcu->totvert);
+  /* The curve can be evaluated from multiple threads when its action is shared between IDs. The
+   * hint is not required to be consistent between them, only to be read and written atomically. */
+  int32_t *hint_p = const_cast<int32_t *>(&fcu->eval_segment_hint);
+  const int hint = atomic_load_int32(hint_p);
+
+  for (int a = std::max(hint, 1); a <= hint + 1 && a < totvert; a++) {
+    /* Same comparison as #IS_EQT, so that the result matches the binary search exactly. */
+    if ((evaltime - bezts[a - 1].vec[1][0]) > threshold &&
+        (bezts[a].vec[1][0] - evaltime) > threshold)
+    {
+      if (a != hint) {
+        atomic_store_int32(hint_p, a);
+      }
+      *r_exact = false;
+      return a;
+    }
+  }
+
+  const int a = BKE_fcurve_bezt_binarysearch_index_ex(
+      bezts, evaltime, totvert, threshold, r_exact);
+  if (a != hint) {
+    atomic_store_int32(hint_p, a);
+  }
+  return a;
+}
+
 static float fcurve_eval_keyframes_interpolate(const FCurve *fcu,
                                                const BezTriple *bezts,
                                                float evaltime)
@@ -2028,7 +2072,7 @@ static float fcurve_eval_keyframes_interpolate(const FCurve *fcu,
    *   Weird errors, like selecting the wrong keyframe range (see #39207), occur.
    *   This lower bound was established in b888a32eee8147b028464336ad2404d8155c64dd.
    */
-  a = BKE_fcurve_bezt_binarysearch_index_ex(bezts, evaltime, fcu->totvert, 0.0001, &exact);
+  a = fcurve_eval_keyframe_index(fcu, bezts, evaltime, 0.0001f, &exact);
   const BezTriple *bezt = bezts + a;
 
   if (exact) {
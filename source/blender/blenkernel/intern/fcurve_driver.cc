@@ -1197,6 +1197,11 @@ static bool driver_compile_simple_expr(ChannelDriver *driver)
   if (atomic_cas_ptr((void **)&driver->expr_simple, nullptr, expr) != nullptr) {
     BLI_expr_pylike_free(expr);
   }
+  else if (!BLI_expr_pylike_is_valid(expr) && driver->expression[0] != '\0') {
+    /* Reported once per compiled expression, so running with `--log "bke.fcurve"`
+     * lists the drivers that still need Python (and hold the GIL) to evaluate. */
+    CLOG_INFO(&LOG, 1, "driver expression requires Python: '%s'", driver->expression);
+  }
 
   return true;
 }
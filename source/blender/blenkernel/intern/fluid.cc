@@ -18,6 +18,7 @@
 #include "BLI_path_utils.hh"
 #include "BLI_string.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "DNA_defaults.h"
@@ -1331,42 +1332,43 @@ static void update_obstacles(Depsgraph *depsgraph,
   float *phi_guide_in = manta_get_phiguide_in(fds->fluid);
   float *num_obstacles = manta_get_num_obstacle(fds->fluid);
   float *num_guides = manta_get_num_guide(fds->fluid);
-  uint z;
-
   bool use_adaptivedomain = (fds->flags & FLUID_DOMAIN_USE_ADAPTIVE_DOMAIN);
 
   /* Grid reset before writing again. */
-  for (z = 0; z < fds->res[0] * fds->res[1] * fds->res[2]; z++) {
-
-    /* Use big value that's not inf to initialize levelset grids. */
-    if (phi_obs_in) {
-      phi_obs_in[z] = PHI_MAX;
-    }
-    /* Only reset static effectors on first frame. Only use static effectors without adaptive
-     * domains. */
-    if (phi_obsstatic_in && (is_first_frame || use_adaptivedomain)) {
-      phi_obsstatic_in[z] = PHI_MAX;
-    }
-    if (phi_guide_in) {
-      phi_guide_in[z] = PHI_MAX;
-    }
-    if (num_obstacles) {
-      num_obstacles[z] = 0;
-    }
-    if (num_guides) {
-      num_guides[z] = 0;
-    }
-    if (vel_x && vel_y && vel_z) {
-      vel_x[z] = 0.0f;
-      vel_y[z] = 0.0f;
-      vel_z[z] = 0.0f;
-    }
-    if (vel_x_guide && vel_y_guide && vel_z_guide) {
-      vel_x_guide[z] = 0.0f;
-      vel_y_guide[z] = 0.0f;
-      vel_z_guide[z] = 0.0f;
-    }
-  }
+  const int64_t cells_num = int64_t(fds->res[0]) * fds->res[1] * fds->res[2];
+  blender::threading::parallel_for(
+      blender::IndexRange(cells_num), 4096, [&](const blender::IndexRange range) {
+        for (const int64_t z : range) {
+          /* Use big value that's not inf to initialize levelset grids. */
+          if (phi_obs_in) {
+            phi_obs_in[z] = PHI_MAX;
+          }
+          /* Only reset static effectors on first frame. Only use static effectors without
+           * adaptive domains. */
+          if (phi_obsstatic_in && (is_first_frame || use_adaptivedomain)) {
+            phi_obsstatic_in[z] = PHI_MAX;
+          }
+          if (phi_guide_in) {
+            phi_guide_in[z] = PHI_MAX;
+          }
+          if (num_obstacles) {
+            num_obstacles[z] = 0;
+          }
+          if (num_guides) {
+            num_guides[z] = 0;
+          }
+          if (vel_x && vel_y && vel_z) {
+            vel_x[z] = 0.0f;
+            vel_y[z] = 0.0f;
+            vel_z[z] = 0.0f;
+          }
+          if (vel_x_guide && vel_y_guide && vel_z_guide) {
+            vel_x_guide[z] = 0.0f;
+            vel_y_guide[z] = 0.0f;
+            vel_z_guide[z] = 0.0f;
+          }
+        }
+      });
 
   /* Prepare grids from effector objects. */
   for (int effec_index = 0; effec_index < numeffecobjs; effec_index++) {
@@ -1398,60 +1400,66 @@ static void update_obstacles(Depsgraph *depsgraph,
       float *numobjs_map = bb->numobjs;
       float *distance_map = bb->distances;
 
-      int gx, gy, gz, ex, ey, ez, dx, dy, dz;
-      size_t e_index, d_index;
-
-      /* Loop through every emission map cell. */
-      for (gx = bb->min[0]; gx < bb->max[0]; gx++) {
-        for (gy = bb->min[1]; gy < bb->max[1]; gy++) {
-          for (gz = bb->min[2]; gz < bb->max[2]; gz++) {
-            /* Compute emission map index. */
-            ex = gx - bb->min[0];
-            ey = gy - bb->min[1];
-            ez = gz - bb->min[2];
-            e_index = manta_get_index(ex, bb->res[0], ey, bb->res[1], ez);
-
-            /* Get domain index. */
-            dx = gx - fds->res_min[0];
-            dy = gy - fds->res_min[1];
-            dz = gz - fds->res_min[2];
-            d_index = manta_get_index(dx, fds->res[0], dy, fds->res[1], dz);
-            /* Make sure emission cell is inside the new domain boundary. */
-            if (dx < 0 || dy < 0 || dz < 0 || dx >= fds->res[0] || dy >= fds->res[1] ||
-                dz >= fds->res[2])
-            {
-              continue;
-            }
+      /* Loop through every emission map cell. Each cell maps to a different domain cell, so
+       * the cells can be processed in parallel. */
+      blender::threading::parallel_for(
+          blender::IndexRange(bb->min[0], bb->max[0] - bb->min[0]),
+          1,
+          [&](const blender::IndexRange x_range) {
+            for (const int gx : x_range) {
+              int ex, ey, ez, dx, dy, dz;
+              size_t e_index, d_index;
+              for (int gy = bb->min[1]; gy < bb->max[1]; gy++) {
+                for (int gz = bb->min[2]; gz < bb->max[2]; gz++) {
+                  /* Compute emission map index. */
+                  ex = gx - bb->min[0];
+                  ey = gy - bb->min[1];
+                  ez = gz - bb->min[2];
+                  e_index = manta_get_index(ex, bb->res[0], ey, bb->res[1], ez);
+
+                  /* Get domain index. */
+                  dx = gx - fds->res_min[0];
+                  dy = gy - fds->res_min[1];
+                  dz = gz - fds->res_min[2];
+                  d_index = manta_get_index(dx, fds->res[0], dy, fds->res[1], dz);
+                  /* Make sure emission cell is inside the new domain boundary. */
+                  if (dx < 0 || dy < 0 || dz < 0 || dx >= fds->res[0] || dy >= fds->res[1] ||
+                      dz >= fds->res[2])
+                  {
+                    continue;
+                  }
 
-            if (fes->type == FLUID_EFFECTOR_TYPE_COLLISION) {
-              float *levelset = ((is_first_frame || is_resume) && is_static) ? phi_obsstatic_in :
-                                                                               phi_obs_in;
-              apply_effector_fields(fes,
-                                    d_index,
-                                    distance_map[e_index],
-                                    levelset,
-                                    numobjs_map[e_index],
-                                    num_obstacles,
-                                    &velocity_map[e_index * 3],
-                                    vel_x,
-                                    vel_y,
-                                    vel_z);
-            }
-            if (fes->type == FLUID_EFFECTOR_TYPE_GUIDE) {
-              apply_effector_fields(fes,
-                                    d_index,
-                                    distance_map[e_index],
-                                    phi_guide_in,
-                                    numobjs_map[e_index],
-                                    num_guides,
-                                    &velocity_map[e_index * 3],
-                                    vel_x_guide,
-                                    vel_y_guide,
-                                    vel_z_guide);
+                  if (fes->type == FLUID_EFFECTOR_TYPE_COLLISION) {
+                    float *levelset = ((is_first_frame || is_resume) && is_static) ?
+                                          phi_obsstatic_in :
+                                          phi_obs_in;
+                    apply_effector_fields(fes,
+                                          d_index,
+                                          distance_map[e_index],
+                                          levelset,
+                                          numobjs_map[e_index],
+                                          num_obstacles,
+                                          &velocity_map[e_index * 3],
+                                          vel_x,
+                                          vel_y,
+                                          vel_z);
+                  }
+                  if (fes->type == FLUID_EFFECTOR_TYPE_GUIDE) {
+                    apply_effector_fields(fes,
+                                          d_index,
+                                          distance_map[e_index],
+                                          phi_guide_in,
+                                          numobjs_map[e_index],
+                                          num_guides,
+                                          &velocity_map[e_index * 3],
+                                          vel_x_guide,
+                                          vel_y_guide,
+                                          vel_z_guide);
+                  }
+                }
+              }
             }
-          }
-        }
-      } /* End of effector map loop. */
+          }); /* End of effector map loop. */
       bb_freeData(bb);
     } /* End of effector object loop. */
   }
@@ -2862,52 +2870,56 @@ static void update_flowsfluids(Depsgraph *depsgraph,
   BLI_assert((velx_initial && vely_initial && velz_initial) ||
              (!velx_initial && !vely_initial && !velz_initial));
 
-  uint z;
   /* Grid reset before writing again. */
-  for (z = 0; z < fds->res[0] * fds->res[1] * fds->res[2]; z++) {
-    /* Only reset static phi on first frame, dynamic phi gets reset every time. */
-    if (phistatic_in && is_first_frame) {
-      phistatic_in[z] = PHI_MAX;
-    }
-    if (phi_in) {
-      phi_in[z] = PHI_MAX;
-    }
-    /* Only reset static phi on first frame, dynamic phi gets reset every time. */
-    if (phioutstatic_in && is_first_frame) {
-      phioutstatic_in[z] = PHI_MAX;
-    }
-    if (phiout_in) {
-      phiout_in[z] = PHI_MAX;
-    }
-    /* Sync smoke inflow grids with their counterparts (simulation grids). */
-    if (density_in) {
-      density_in[z] = density[z];
-    }
-    if (heat_in) {
-      heat_in[z] = heat[z];
-    }
-    if (color_r_in && color_g_in && color_b_in) {
-      color_r_in[z] = color_r[z];
-      color_g_in[z] = color_b[z];
-      color_b_in[z] = color_g[z];
-    }
-    if (fuel_in) {
-      fuel_in[z] = fuel[z];
-      react_in[z] = react[z];
-    }
-    if (emission_in) {
-      emission_in[z] = 0.0f;
-    }
-    if (velx_initial && vely_initial && velz_initial) {
-      velx_initial[z] = 0.0f;
-      vely_initial[z] = 0.0f;
-      velz_initial[z] = 0.0f;
-    }
-    /* Reset forces here as update_effectors() is skipped when no external forces are present. */
-    forcex[z] = 0.0f;
-    forcey[z] = 0.0f;
-    forcez[z] = 0.0f;
-  }
+  const int64_t cells_num = int64_t(fds->res[0]) * fds->res[1] * fds->res[2];
+  blender::threading::parallel_for(
+      blender::IndexRange(cells_num), 4096, [&](const blender::IndexRange range) {
+        for (const int64_t z : range) {
+          /* Only reset static phi on first frame, dynamic phi gets reset every time. */
+          if (phistatic_in && is_first_frame) {
+            phistatic_in[z] = PHI_MAX;
+          }
+          if (phi_in) {
+            phi_in[z] = PHI_MAX;
+          }
+          /* Only reset static phi on first frame, dynamic phi gets reset every time. */
+          if (phioutstatic_in && is_first_frame) {
+            phioutstatic_in[z] = PHI_MAX;
+          }
+          if (phiout_in) {
+            phiout_in[z] = PHI_MAX;
+          }
+          /* Sync smoke inflow grids with their counterparts (simulation grids). */
+          if (density_in) {
+            density_in[z] = density[z];
+          }
+          if (heat_in) {
+            heat_in[z] = heat[z];
+          }
+          if (color_r_in && color_g_in && color_b_in) {
+            color_r_in[z] = color_r[z];
+            color_g_in[z] = color_b[z];
+            color_b_in[z] = color_g[z];
+          }
+          if (fuel_in) {
+            fuel_in[z] = fuel[z];
+            react_in[z] = react[z];
+          }
+          if (emission_in) {
+            emission_in[z] = 0.0f;
+          }
+          if (velx_initial && vely_initial && velz_initial) {
+            velx_initial[z] = 0.0f;
+            vely_initial[z] = 0.0f;
+            velz_initial[z] = 0.0f;
+          }
+          /* Reset forces here as update_effectors() is skipped when no external forces are
+           * present. */
+          forcex[z] = 0.0f;
+          forcey[z] = 0.0f;
+          forcez[z] = 0.0f;
+        }
+      });
 
   /* Apply emission data for every flow object. */
   for (int flow_index = 0; flow_index < numflowobjs; flow_index++) {
@@ -2935,113 +2947,120 @@ static void update_flowsfluids(Depsgraph *depsgraph,
       float *emission_map = bb->influence;
       float *distance_map = bb->distances;
 
-      int gx, gy, gz, ex, ey, ez, dx, dy, dz;
-      size_t e_index, d_index;
-
-      /* Loop through every emission map cell. */
-      for (gx = bb->min[0]; gx < bb->max[0]; gx++) {
-        for (gy = bb->min[1]; gy < bb->max[1]; gy++) {
-          for (gz = bb->min[2]; gz < bb->max[2]; gz++) {
-            /* Compute emission map index. */
-            ex = gx - bb->min[0];
-            ey = gy - bb->min[1];
-            ez = gz - bb->min[2];
-            e_index = manta_get_index(ex, bb->res[0], ey, bb->res[1], ez);
-
-            /* Get domain index. */
-            dx = gx - fds->res_min[0];
-            dy = gy - fds->res_min[1];
-            dz = gz - fds->res_min[2];
-            d_index = manta_get_index(dx, fds->res[0], dy, fds->res[1], dz);
-            /* Make sure emission cell is inside the new domain boundary. */
-            if (dx < 0 || dy < 0 || dz < 0 || dx >= fds->res[0] || dy >= fds->res[1] ||
-                dz >= fds->res[2])
-            {
-              continue;
-            }
+      /* Loop through every emission map cell. Each cell maps to a different domain cell, so
+       * the cells can be processed in parallel. */
+      blender::threading::parallel_for(
+          blender::IndexRange(bb->min[0], bb->max[0] - bb->min[0]),
+          1,
+          [&](const blender::IndexRange x_range) {
+            for (const int gx : x_range) {
+              int ex, ey, ez, dx, dy, dz;
+              size_t e_index, d_index;
+              for (int gy = bb->min[1]; gy < bb->max[1]; gy++) {
+                for (int gz = bb->min[2]; gz < bb->max[2]; gz++) {
+                  /* Compute emission map index. */
+                  ex = gx - bb->min[0];
+                  ey = gy - bb->min[1];
+                  ez = gz - bb->min[2];
+                  e_index = manta_get_index(ex, bb->res[0], ey, bb->res[1], ez);
+
+                  /* Get domain index. */
+                  dx = gx - fds->res_min[0];
+                  dy = gy - fds->res_min[1];
+                  dz = gz - fds->res_min[2];
+                  d_index = manta_get_index(dx, fds->res[0], dy, fds->res[1], dz);
+                  /* Make sure emission cell is inside the new domain boundary. */
+                  if (dx < 0 || dy < 0 || dz < 0 || dx >= fds->res[0] || dy >= fds->res[1] ||
+                      dz >= fds->res[2])
+                  {
+                    continue;
+                  }
 
-            /* Delete fluid in outflow regions. */
-            if (is_outflow) {
-              float *levelset = ((is_first_frame || is_resume) && is_static) ? phioutstatic_in :
-                                                                               phiout_in;
-              apply_outflow_fields(d_index,
-                                   distance_map[e_index],
-                                   density_in,
-                                   heat_in,
-                                   fuel_in,
-                                   react_in,
-                                   color_r_in,
-                                   color_g_in,
-                                   color_b_in,
-                                   levelset);
-            }
-            /* Do not apply inflow after the first frame when in geometry mode. */
-            else if (is_geometry && !is_first_frame) {
-              apply_inflow_fields(ffs,
-                                  0.0f,
-                                  PHI_MAX,
-                                  d_index,
-                                  density_in,
-                                  density,
-                                  heat_in,
-                                  heat,
-                                  fuel_in,
-                                  fuel,
-                                  react_in,
-                                  react,
-                                  color_r_in,
-                                  color_r,
-                                  color_g_in,
-                                  color_g,
-                                  color_b_in,
-                                  color_b,
-                                  phi_in,
-                                  emission_in);
-            }
-            /* Main inflow application. */
-            else if (is_geometry || is_inflow) {
-              float *levelset = ((is_first_frame || is_resume) && is_static && !is_geometry) ?
-                                    phistatic_in :
-                                    phi_in;
-              apply_inflow_fields(ffs,
-                                  emission_map[e_index],
-                                  distance_map[e_index],
-                                  d_index,
-                                  density_in,
-                                  density,
-                                  heat_in,
-                                  heat,
-                                  fuel_in,
-                                  fuel,
-                                  react_in,
-                                  react,
-                                  color_r_in,
-                                  color_r,
-                                  color_g_in,
-                                  color_g,
-                                  color_b_in,
-                                  color_b,
-                                  levelset,
-                                  emission_in);
-              if (ffs->flags & FLUID_FLOW_INITVELOCITY) {
-                /* Use the initial velocity from the inflow object with the highest velocity for
-                 * now. */
-                float vel_initial[3];
-                vel_initial[0] = velx_initial[d_index];
-                vel_initial[1] = vely_initial[d_index];
-                vel_initial[2] = velz_initial[d_index];
-                float vel_initial_strength = len_squared_v3(vel_initial);
-                float vel_map_strength = len_squared_v3(velocity_map + 3 * e_index);
-                if (vel_map_strength > vel_initial_strength) {
-                  velx_initial[d_index] = velocity_map[e_index * 3];
-                  vely_initial[d_index] = velocity_map[e_index * 3 + 1];
-                  velz_initial[d_index] = velocity_map[e_index * 3 + 2];
+                  /* Delete fluid in outflow regions. */
+                  if (is_outflow) {
+                    float *levelset = ((is_first_frame || is_resume) && is_static) ?
+                                          phioutstatic_in :
+                                          phiout_in;
+                    apply_outflow_fields(d_index,
+                                         distance_map[e_index],
+                                         density_in,
+                                         heat_in,
+                                         fuel_in,
+                                         react_in,
+                                         color_r_in,
+                                         color_g_in,
+                                         color_b_in,
+                                         levelset);
+                  }
+                  /* Do not apply inflow after the first frame when in geometry mode. */
+                  else if (is_geometry && !is_first_frame) {
+                    apply_inflow_fields(ffs,
+                                        0.0f,
+                                        PHI_MAX,
+                                        d_index,
+                                        density_in,
+                                        density,
+                                        heat_in,
+                                        heat,
+                                        fuel_in,
+                                        fuel,
+                                        react_in,
+                                        react,
+                                        color_r_in,
+                                        color_r,
+                                        color_g_in,
+                                        color_g,
+                                        color_b_in,
+                                        color_b,
+                                        phi_in,
+                                        emission_in);
+                  }
+                  /* Main inflow application. */
+                  else if (is_geometry || is_inflow) {
+                    float *levelset =
+                        ((is_first_frame || is_resume) && is_static && !is_geometry) ?
+                            phistatic_in :
+                            phi_in;
+                    apply_inflow_fields(ffs,
+                                        emission_map[e_index],
+                                        distance_map[e_index],
+                                        d_index,
+                                        density_in,
+                                        density,
+                                        heat_in,
+                                        heat,
+                                        fuel_in,
+                                        fuel,
+                                        react_in,
+                                        react,
+                                        color_r_in,
+                                        color_r,
+                                        color_g_in,
+                                        color_g,
+                                        color_b_in,
+                                        color_b,
+                                        levelset,
+                                        emission_in);
+                    if (ffs->flags & FLUID_FLOW_INITVELOCITY) {
+                      /* Use the initial velocity from the inflow object with the highest velocity
+                       * for now. */
+                      float vel_initial[3];
+                      vel_initial[0] = velx_initial[d_index];
+                      vel_initial[1] = vely_initial[d_index];
+                      vel_initial[2] = velz_initial[d_index];
+                      float vel_initial_strength = len_squared_v3(vel_initial);
+                      float vel_map_strength = len_squared_v3(velocity_map + 3 * e_index);
+                      if (vel_map_strength > vel_initial_strength) {
+                        velx_initial[d_index] = velocity_map[e_index * 3];
+                        vely_initial[d_index] = velocity_map[e_index * 3 + 1];
+                        velz_initial[d_index] = velocity_map[e_index * 3 + 2];
+                      }
+                    }
+                  }
                 }
               }
             }
-          }
-        }
-      } /* End of flow emission map loop. */
+          }); /* End of flow emission map loop. */
       bb_freeData(bb);
     } /* End of flow object loop. */
   }
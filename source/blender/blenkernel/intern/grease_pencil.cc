@@ -4184,8 +4184,11 @@ static void read_drawing_array(GreasePencil &grease_pencil, BlendDataReader *rea
   BLO_read_pointer_array(reader,
                          grease_pencil.drawing_array_num,
                          reinterpret_cast<void **>(&grease_pencil.drawing_array));
+  BLO_read_struct_pointer_array_items(reader,
+                                      GreasePencilDrawingBase,
+                                      grease_pencil.drawing_array_num,
+                                      grease_pencil.drawing_array);
   for (int i = 0; i < grease_pencil.drawing_array_num; i++) {
-    BLO_read_struct(reader, GreasePencilDrawingBase, &grease_pencil.drawing_array[i]);
     GreasePencilDrawingBase *drawing_base = grease_pencil.drawing_array[i];
     switch (GreasePencilDrawingType(drawing_base->type)) {
       case GP_DRAWING: {
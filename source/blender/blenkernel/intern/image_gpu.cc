@@ -15,6 +15,7 @@
 #include "BLI_rect.h"
 #include "BLI_threads.h"
 #include "BLI_time.h"
+#include "BLI_vector.hh"
 
 #include "DNA_image_types.h"
 #include "DNA_userdef_types.h"
@@ -38,7 +39,8 @@ using namespace blender::bke::image::partial_update;
 static void gpu_free_unused_buffers();
 static void image_free_gpu(Image *ima, const bool immediate);
 static void image_update_gputexture_ex(
-    Image *ima, ImageTile *tile, ImBuf *ibuf, int x, int y, int w, int h);
+    Image *ima, ImageTile *tile, ImBuf *ibuf, int x, int y, int w, int h, bool r_updated[2]);
+static void image_update_gputexture_mipmaps(Image *ima, const bool updated[2]);
 
 bool BKE_image_has_gpu_texture_premultiplied_alpha(Image *image, ImBuf *ibuf)
 {
@@ -140,11 +142,16 @@ static GPUTexture *gpu_texture_create_tile_array(Image *ima, ImBuf *main_ibuf)
 
   int planes = 0;
 
+  /* Keep the tile buffers acquired until they are uploaded. Otherwise, when the tiles don't fit in
+   * the image cache, tiles loaded for measuring get freed and are loaded again for the upload. */
+  blender::Vector<ImBuf *> tile_ibufs;
+
   LISTBASE_FOREACH (ImageTile *, tile, &ima->tiles) {
     ImageUser iuser;
     BKE_imageuser_default(&iuser);
     iuser.tile = tile->tile_number;
     ImBuf *ibuf = BKE_image_acquire_ibuf(ima, &iuser, nullptr);
+    tile_ibufs.append(ibuf);
 
     if (ibuf) {
       PackTile *packtile = MEM_callocN<PackTile>(__func__);
@@ -164,7 +171,6 @@ static GPUTexture *gpu_texture_create_tile_array(Image *ima, ImBuf *main_ibuf)
       float w = packtile->boxpack.w, h = packtile->boxpack.h;
       packtile->pack_score = max_ff(w, h) / min_ff(w, h) * w * h;
 
-      BKE_image_release_ibuf(ima, ibuf, nullptr);
       BLI_addtail(&boxes, packtile);
       planes = max_ii(planes, ibuf->planes);
     }
@@ -209,22 +215,15 @@ static GPUTexture *gpu_texture_create_tile_array(Image *ima, ImBuf *main_ibuf)
                                           use_grayscale);
 
   /* Upload each tile one by one. */
-  LISTBASE_FOREACH (ImageTile *, tile, &ima->tiles) {
+  int tile_index = 0;
+  LISTBASE_FOREACH_INDEX (ImageTile *, tile, &ima->tiles, tile_index) {
     const ImageTile_Runtime *tile_runtime = &tile->runtime;
     const int tilelayer = tile_runtime->tilearray_layer;
     const int *tileoffset = tile_runtime->tilearray_offset;
     const int *tilesize = tile_runtime->tilearray_size;
+    ImBuf *ibuf = tile_ibufs[tile_index];
 
-    if (tilesize[0] == 0 || tilesize[1] == 0) {
-      continue;
-    }
-
-    ImageUser iuser;
-    BKE_imageuser_default(&iuser);
-    iuser.tile = tile->tile_number;
-    ImBuf *ibuf = BKE_image_acquire_ibuf(ima, &iuser, nullptr);
-
-    if (ibuf) {
+    if (ibuf && tilesize[0] != 0 && tilesize[1] != 0) {
       const bool store_premultiplied = BKE_image_has_gpu_texture_premultiplied_alpha(ima, ibuf);
       IMB_update_gpu_texture_sub(tex,
                                  ibuf,
@@ -290,6 +289,9 @@ static GPUTexture *image_gpu_texture_error_create(eGPUTextureTarget textarget)
 static void image_gpu_texture_partial_update_changes_available(
     Image *image, PartialUpdateChecker<ImageTileData>::CollectResult &changes)
 {
+  /* The mipmaps are updated once after all changes are uploaded, as a paint stroke can change
+   * many regions of a large image at once. */
+  bool updated[2] = {false, false};
   while (changes.get_next_change() == ePartialUpdateIterResult::ChangeAvailable) {
     /* Calculate the clipping region with the tile buffer.
      * TODO(jbakker): should become part of ImageTileData to deduplicate with image engine. */
@@ -309,8 +311,10 @@ static void image_gpu_texture_partial_update_changes_available(
                                clipped_update_region.xmin,
                                clipped_update_region.ymin,
                                BLI_rcti_size_x(&clipped_update_region),
-                               BLI_rcti_size_y(&clipped_update_region));
+                               BLI_rcti_size_y(&clipped_update_region),
+                               updated);
   }
+  image_update_gputexture_mipmaps(image, updated);
 }
 
 static void image_gpu_texture_try_partial_update(Image *image, ImageUser *iuser)
@@ -855,30 +859,47 @@ static void gpu_texture_update_from_ibuf(
     MEM_freeN(rect_float);
   }
 
-  if (GPU_mipmap_enabled()) {
-    GPU_texture_update_mipmap_chain(tex);
-  }
-  else {
-    ima->gpuflag &= ~IMA_GPU_MIPMAP_COMPLETE;
-  }
-
   GPU_texture_unbind(tex);
 }
 
+/**
+ * Upload a changed region. The mipmaps are not updated, \a r_updated is set for the textures
+ * (2D and 2D array) that need a mipmap update afterwards.
+ */
 static void image_update_gputexture_ex(
-    Image *ima, ImageTile *tile, ImBuf *ibuf, int x, int y, int w, int h)
+    Image *ima, ImageTile *tile, ImBuf *ibuf, int x, int y, int w, int h, bool r_updated[2])
 {
   const int eye = 0;
   GPUTexture *tex = ima->gputexture[TEXTARGET_2D][eye];
   /* Check if we need to update the main gputexture. */
   if (tex != nullptr && tile == ima->tiles.first) {
     gpu_texture_update_from_ibuf(tex, ima, ibuf, nullptr, x, y, w, h);
+    r_updated[0] = true;
   }
 
   /* Check if we need to update the array gputexture. */
   tex = ima->gputexture[TEXTARGET_2D_ARRAY][eye];
   if (tex != nullptr) {
     gpu_texture_update_from_ibuf(tex, ima, ibuf, tile, x, y, w, h);
+    r_updated[1] = true;
+  }
+}
+
+static void image_update_gputexture_mipmaps(Image *ima, const bool updated[2])
+{
+  if (!updated[0] && !updated[1]) {
+    return;
+  }
+  if (!GPU_mipmap_enabled()) {
+    ima->gpuflag &= ~IMA_GPU_MIPMAP_COMPLETE;
+    return;
+  }
+  const int eye = 0;
+  if (updated[0]) {
+    GPU_texture_update_mipmap_chain(ima->gputexture[TEXTARGET_2D][eye]);
+  }
+  if (updated[1]) {
+    GPU_texture_update_mipmap_chain(ima->gputexture[TEXTARGET_2D_ARRAY][eye]);
   }
 }
 
@@ -6,6 +6,7 @@
  * \ingroup bke
  */
 
+#include <atomic>
 #include <cerrno>
 #include <cstring>
 
@@ -643,16 +644,40 @@ bool BKE_image_save(
   }
   else {
     /* Save all the tiles. */
+    Vector<ImageTile *> tiles;
     LISTBASE_FOREACH (ImageTile *, tile, &ima->tiles) {
+      tiles.append(tile);
+    }
+
+    auto save_tile = [&](ImageTile &tile, ImageUser &tile_iuser, bool *r_colorspace_changed) {
       ImageSaveOptions tile_opts = *opts;
       BKE_image_set_filepath_from_tile_number(
-          tile_opts.filepath, udim_pattern, tile_format, tile->tile_number);
+          tile_opts.filepath, udim_pattern, tile_format, tile.tile_number);
 
-      iuser->tile = tile->tile_number;
-      ok = image_save_single(reports, ima, iuser, &tile_opts, &colorspace_changed);
-      if (!ok) {
-        break;
-      }
+      tile_iuser.tile = tile.tile_number;
+      return image_save_single(reports, ima, &tile_iuser, &tile_opts, r_colorspace_changed);
+    };
+
+    /* The first tile is saved on its own, because it may update the color space of the image.
+     * The remaining tiles then only read it, and since encoding and writing every tile is
+     * independent, they are saved in parallel. */
+    if (!tiles.is_empty()) {
+      ok = save_tile(*tiles[0], *iuser, &colorspace_changed);
+    }
+    if (ok && tiles.size() > 1) {
+      std::atomic<bool> all_ok = true;
+      const ImageUser base_iuser = *iuser;
+      blender::threading::parallel_for(
+          tiles.index_range().drop_front(1), 1, [&](const blender::IndexRange range) {
+            for (const int i : range) {
+              ImageUser tile_iuser = base_iuser;
+              bool tile_colorspace_changed = false;
+              if (!save_tile(*tiles[i], tile_iuser, &tile_colorspace_changed)) {
+                all_ok = false;
+              }
+            }
+          });
+      ok = all_ok;
     }
 
     /* Set the image path and clear the per-tile generated flag only if all tiles were ok. */
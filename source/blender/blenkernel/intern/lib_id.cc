@@ -24,8 +24,11 @@
 #include "DNA_ID.h"
 #include "DNA_anim_types.h"
 #include "DNA_collection_types.h"
+#include "DNA_curves_types.h"
 #include "DNA_key_types.h"
+#include "DNA_mesh_types.h"
 #include "DNA_node_types.h"
+#include "DNA_pointcloud_types.h"
 #include "DNA_workspace_types.h"
 
 #include "BLI_listbase.h"
@@ -47,7 +50,9 @@
 #include "BKE_asset.hh"
 #include "BKE_bpath.hh"
 #include "BKE_context.hh"
+#include "BKE_curves.hh"
 #include "BKE_global.hh"
+#include "BKE_grease_pencil.hh"
 #include "BKE_gpencil_legacy.h"
 #include "BKE_idprop.hh"
 #include "BKE_idtype.hh"
@@ -61,6 +66,7 @@
 #include "BKE_main_namemap.hh"
 #include "BKE_node.hh"
 #include "BKE_rigidbody.h"
+#include "BKE_volume.hh"
 
 #include "DEG_depsgraph.hh"
 #include "DEG_depsgraph_build.hh"
@@ -2630,3 +2636,26 @@ void BKE_id_blend_write(BlendWriter *writer, ID *id)
     }
   }
 }
+
+bool BKE_id_count_memory(const ID &id, blender::MemoryCounter &memory)
+{
+  switch (GS(id.name)) {
+    case ID_ME:
+      reinterpret_cast<const Mesh &>(id).count_memory(memory);
+      return true;
+    case ID_CV:
+      reinterpret_cast<const Curves &>(id).geometry.wrap().count_memory(memory);
+      return true;
+    case ID_PT:
+      reinterpret_cast<const PointCloud &>(id).count_memory(memory);
+      return true;
+    case ID_GP:
+      reinterpret_cast<const GreasePencil &>(id).count_memory(memory);
+      return true;
+    case ID_VO:
+      BKE_volume_count_memory(reinterpret_cast<const Volume &>(id), memory);
+      return true;
+    default:
+      return false;
+  }
+}
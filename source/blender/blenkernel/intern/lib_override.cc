@@ -2333,10 +2333,11 @@ static bool lib_override_library_resync(Main *bmain,
     return success;
   }
 
-  /* Get a mapping of all missing linked IDs that were liboverrides, to search for 'old
-   * liboverrides' for newly created ones that do not already have one, in next step. */
-  LibOverrideMissingIDsData missing_ids_data = lib_override_library_resync_build_missing_ids_data(
-      bmain);
+  /* Mapping of all missing linked IDs that were liboverrides, to search for 'old liboverrides'
+   * for newly created ones that do not already have one, in next step. Only built when first
+   * needed, since it requires going over the whole Main database for every resynced hierarchy,
+   * while it is only used for linked overrides. */
+  std::optional<LibOverrideMissingIDsData> missing_ids_data;
   /* Vector of pairs of reference IDs, and their new override IDs. */
   blender::Vector<std::pair<ID *, ID *>> references_and_new_overrides;
 
@@ -2371,7 +2372,10 @@ static bool lib_override_library_resync(Main *bmain,
        * not actually exist in the original library file, on next file read it is lost and marked
        * as missing ID. */
       if (id_override_old == nullptr && ID_IS_LINKED(id_override_new)) {
-        id_override_old = lib_override_library_resync_search_missing_ids_data(missing_ids_data,
+        if (!missing_ids_data) {
+          missing_ids_data = lib_override_library_resync_build_missing_ids_data(bmain);
+        }
+        id_override_old = lib_override_library_resync_search_missing_ids_data(*missing_ids_data,
                                                                               id_override_new);
         BLI_assert(id_override_old == nullptr || id_override_old->lib == id_override_new->lib);
         if (id_override_old != nullptr) {
@@ -17,6 +17,7 @@
 #include "BLI_linklist_stack.h"
 #include "BLI_listbase.h"
 #include "BLI_set.hh"
+#include "BLI_vector.hh"
 
 #include "BKE_anim_data.hh"
 #include "BKE_idprop.hh"
@@ -1071,12 +1072,20 @@ void BKE_lib_query_unused_ids_tag(Main *bmain, const int tag, LibQueryUnusedIDsD
   BKE_main_relations_free(bmain);
 }
 
+struct UsedLinkedDataTagClearData {
+  /** IDs known as used (not tagged with #ID_TAG_DOIT), whose own usages remain to be checked. */
+  blender::Vector<ID *> ids_to_check;
+  /** Only check the usages from linked IDs. */
+  bool linked_only;
+};
+
 static int foreach_libblock_used_linked_data_tag_clear_cb(LibraryIDLinkCallbackData *cb_data)
 {
   ID *self_id = cb_data->self_id;
   ID **id_p = cb_data->id_pointer;
   const LibraryForeachIDCallbackFlag cb_flag = cb_data->cb_flag;
-  bool *is_changed = static_cast<bool *>(cb_data->user_data);
+  UsedLinkedDataTagClearData *data = static_cast<UsedLinkedDataTagClearData *>(
+      cb_data->user_data);
 
   if (*id_p) {
     /* The infamous 'from' pointers (Key.from, ...).
@@ -1089,13 +1098,29 @@ static int foreach_libblock_used_linked_data_tag_clear_cb(LibraryIDLinkCallbackD
      * then it is also used and not part of any linked archipelago. */
     if (!(self_id->tag & ID_TAG_DOIT) && ((*id_p)->tag & ID_TAG_DOIT)) {
       (*id_p)->tag &= ~ID_TAG_DOIT;
-      *is_changed = true;
+      if (!data->linked_only || ID_IS_LINKED(*id_p)) {
+        data->ids_to_check.append(*id_p);
+      }
     }
   }
 
   return IDWALK_RET_NOP;
 }
 
+/**
+ * Propagate the 'used' status (cleared #ID_TAG_DOIT) from the IDs in \a data to all the IDs they
+ * use, recursively. Each newly untagged ID is checked only once, instead of looping over the
+ * whole Main database until nothing changes anymore.
+ */
+static void library_used_data_tag_clear(Main *bmain, UsedLinkedDataTagClearData &data)
+{
+  while (!data.ids_to_check.is_empty()) {
+    ID *id = data.ids_to_check.pop_last();
+    BKE_library_foreach_ID_link(
+        bmain, id, foreach_libblock_used_linked_data_tag_clear_cb, &data, IDWALK_READONLY);
+  }
+}
+
 void BKE_library_unused_linked_data_set_tag(Main *bmain, const bool do_init_tag)
 {
   ID *id;
@@ -1112,36 +1137,32 @@ void BKE_library_unused_linked_data_set_tag(Main *bmain, const bool do_init_tag)
     FOREACH_MAIN_ID_END;
   }
 
-  for (bool do_loop = true; do_loop;) {
-    do_loop = false;
-    FOREACH_MAIN_ID_BEGIN (bmain, id) {
-      /* We only want to check that ID if it is currently known as used... */
-      if ((id->tag & ID_TAG_DOIT) == 0) {
-        BKE_library_foreach_ID_link(
-            bmain, id, foreach_libblock_used_linked_data_tag_clear_cb, &do_loop, IDWALK_READONLY);
-      }
+  UsedLinkedDataTagClearData data;
+  data.linked_only = false;
+  FOREACH_MAIN_ID_BEGIN (bmain, id) {
+    /* We only want to check that ID if it is currently known as used... */
+    if ((id->tag & ID_TAG_DOIT) == 0) {
+      data.ids_to_check.append(id);
     }
-    FOREACH_MAIN_ID_END;
   }
+  FOREACH_MAIN_ID_END;
+
+  library_used_data_tag_clear(bmain, data);
 }
 
 void BKE_library_indirectly_used_data_tag_clear(Main *bmain)
 {
-  bool do_loop = true;
-  while (do_loop) {
-    MainListsArray lb_array = BKE_main_lists_get(*bmain);
-    int i = lb_array.size();
-    do_loop = false;
-
-    while (i--) {
-      LISTBASE_FOREACH (ID *, id, lb_array[i]) {
-        if (!ID_IS_LINKED(id) || id->tag & ID_TAG_DOIT) {
-          /* Local or non-indirectly-used ID (so far), no need to check it further. */
-          continue;
-        }
-        BKE_library_foreach_ID_link(
-            bmain, id, foreach_libblock_used_linked_data_tag_clear_cb, &do_loop, IDWALK_READONLY);
-      }
+  UsedLinkedDataTagClearData data;
+  data.linked_only = true;
+  ID *id;
+  FOREACH_MAIN_ID_BEGIN (bmain, id) {
+    if (!ID_IS_LINKED(id) || id->tag & ID_TAG_DOIT) {
+      /* Local or non-indirectly-used ID (so far), no need to check it further. */
+      continue;
     }
+    data.ids_to_check.append(id);
   }
+  FOREACH_MAIN_ID_END;
+
+  library_used_data_tag_clear(bmain, data);
 }
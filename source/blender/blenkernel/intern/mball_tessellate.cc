@@ -6,6 +6,7 @@
  * \ingroup bke
  */
 
+#include <array>
 #include <cctype>
 #include <cfloat>
 #include <cmath>
@@ -19,6 +20,7 @@
 #include "DNA_object_types.h"
 #include "DNA_scene_types.h"
 
+#include "BLI_array.hh"
 #include "BLI_listbase.h"
 #include "BLI_math_geom.h"
 #include "BLI_math_matrix.h"
@@ -27,7 +29,9 @@
 #include "BLI_math_vector.hh"
 #include "BLI_memarena.h"
 #include "BLI_string_utils.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BKE_global.hh"
 #include "BKE_mball_tessellate.hh" /* own include */
@@ -41,8 +45,6 @@
 #include "BLI_strict_flags.h" /* IWYU pragma: keep. Keep last. */
 
 /* experimental (faster) normal calculation (see #103021) */
-#define USE_ACCUM_NORMAL
-
 #define MBALL_ARRAY_LEN_INIT 4096
 
 /* Data types */
@@ -51,6 +53,7 @@
 struct CORNER {
   int i, j, k;        /* (i, j, k) is index within lattice */
   float co[3], value; /* location and function value */
+  bool is_evaluated;  /* false while the value is waiting for #evaluate_pending_corners */
   CORNER *next;
 };
 
@@ -126,8 +129,10 @@ struct PROCESS {
   uint totindex;     /* size of memory allocated for indices */
   uint curindex;     /* number of currently added indices */
 
-  blender::Vector<blender::float3> co; /* surface vertices positions */
-  blender::Vector<blender::float3> no; /* surface vertex normals */
+  /* Corners whose function value is evaluated in parallel before processing the next cubes. */
+  blender::Vector<CORNER *> pending_corners;
+  /* Pairs of corners that each surface vertex lies between, positions are computed at the end. */
+  blender::Vector<std::array<const CORNER *, 2>> vert_corners;
 
   /* memory allocation from common pool */
   MemArena *pgn_elements;
@@ -137,7 +142,11 @@ struct PROCESS {
 static int vertid(PROCESS *process, const CORNER *c1, const CORNER *c2);
 static void add_cube(PROCESS *process, int i, int j, int k);
 static void make_face(PROCESS *process, int i1, int i2, int i3, int i4);
-static void converge(PROCESS *process, const CORNER *c1, const CORNER *c2, float r_p[3]);
+static void converge(const PROCESS *process,
+                     MetaballBVHNode **bvh_queue,
+                     const CORNER *c1,
+                     const CORNER *c2,
+                     float r_p[3]);
 
 /* ******************* SIMPLE BVH ********************* */
 
@@ -403,25 +412,27 @@ static float densfunc(const MetaElem *ball, float x, float y, float z)
 
 /**
  * Computes density at given position form all meta-balls which contain this point in their box.
- * Traverses BVH using a queue.
+ * Traverses BVH using a queue, which has to hold #PROCESS.bvh_queue_size nodes. Every thread needs
+ * its own queue.
  */
-static float metaball(PROCESS *process, float x, float y, float z)
+static float metaball(
+    const PROCESS *process, MetaballBVHNode **bvh_queue, float x, float y, float z)
 {
   float dens = 0.0f;
   uint front = 0, back = 0;
-  MetaballBVHNode *node;
+  const MetaballBVHNode *node;
 
-  process->bvh_queue[front++] = &process->metaball_bvh;
+  bvh_queue[front++] = const_cast<MetaballBVHNode *>(&process->metaball_bvh);
 
   while (front != back) {
-    node = process->bvh_queue[back++];
+    node = bvh_queue[back++];
 
     for (int i = 0; i < 2; i++) {
       if ((node->bb[i].min[0] <= x) && (node->bb[i].max[0] >= x) && (node->bb[i].min[1] <= y) &&
           (node->bb[i].max[1] >= y) && (node->bb[i].min[2] <= z) && (node->bb[i].max[2] >= z))
       {
         if (node->child[i]) {
-          process->bvh_queue[front++] = node->child[i];
+          bvh_queue[front++] = node->child[i];
         }
         else {
           dens += densfunc(node->bb[i].ml, x, y, z);
@@ -438,10 +449,6 @@ static float metaball(PROCESS *process, float x, float y, float z)
  */
 static void make_face(PROCESS *process, int i1, int i2, int i3, int i4)
 {
-#ifdef USE_ACCUM_NORMAL
-  float n[3];
-#endif
-
   if (UNLIKELY(process->totindex == process->curindex)) {
     process->totindex = process->totindex ? (process->totindex * 2) : MBALL_ARRAY_LEN_INIT;
     process->indices = static_cast<int(*)[4]>(
@@ -455,33 +462,6 @@ static void make_face(PROCESS *process, int i1, int i2, int i3, int i4)
   cur[1] = i2;
   cur[2] = i3;
   cur[3] = i4;
-
-#ifdef USE_ACCUM_NORMAL
-  if (i4 == i3) {
-    normal_tri_v3(n, process->co[i1], process->co[i2], process->co[i3]);
-    accumulate_vertex_normals_v3(process->no[i1],
-                                 process->no[i2],
-                                 process->no[i3],
-                                 nullptr,
-                                 n,
-                                 process->co[i1],
-                                 process->co[i2],
-                                 process->co[i3],
-                                 nullptr);
-  }
-  else {
-    normal_quad_v3(n, process->co[i1], process->co[i2], process->co[i3], process->co[i4]);
-    accumulate_vertex_normals_v3(process->no[i1],
-                                 process->no[i2],
-                                 process->no[i3],
-                                 process->no[i4],
-                                 n,
-                                 process->co[i1],
-                                 process->co[i2],
-                                 process->co[i3],
-                                 process->co[i4]);
-  }
-#endif
 }
 
 /* Frees allocated memory */
@@ -664,11 +644,38 @@ static void docube(PROCESS *process, CUBE *cube)
   }
 }
 
+static void corner_evaluate(const PROCESS *process, MetaballBVHNode **bvh_queue, CORNER *c)
+{
+  c->value = metaball(process, bvh_queue, c->co[0], c->co[1], c->co[2]);
+  c->is_evaluated = true;
+}
+
+/**
+ * Evaluate the function values of all corners added since the last call, on multiple threads.
+ */
+static void evaluate_pending_corners(PROCESS *process)
+{
+  using namespace blender;
+  const Span<CORNER *> corners = process->pending_corners;
+  threading::parallel_for(corners.index_range(), 256, [&](const IndexRange range) {
+    Array<MetaballBVHNode *, 64> bvh_queue(process->bvh_queue_size);
+    for (CORNER *c : corners.slice(range)) {
+      if (!c->is_evaluated) {
+        corner_evaluate(process, bvh_queue.data(), c);
+      }
+    }
+  });
+  process->pending_corners.clear();
+}
+
 /**
  * return corner with the given lattice location
  * set (and cache) its function value
+ *
+ * \param evaluate: Calculate the function value immediately. Otherwise it is deferred to
+ * #evaluate_pending_corners.
  */
-static CORNER *setcorner(PROCESS *process, int i, int j, int k)
+static CORNER *setcorner(PROCESS *process, int i, int j, int k, const bool evaluate)
 {
   /* for speed, do corner value caching here */
   CORNER *c;
@@ -680,6 +687,9 @@ static CORNER *setcorner(PROCESS *process, int i, int j, int k)
 
   for (; c != nullptr; c = c->next) {
     if (c->i == i && c->j == j && c->k == k) {
+      if (evaluate && !c->is_evaluated) {
+        corner_evaluate(process, process->bvh_queue, c);
+      }
       return c;
     }
   }
@@ -693,7 +703,13 @@ static CORNER *setcorner(PROCESS *process, int i, int j, int k)
   c->k = k;
   c->co[2] = (float(k) - 0.5f) * process->size;
 
-  c->value = metaball(process, c->co[0], c->co[1], c->co[2]);
+  c->is_evaluated = false;
+  if (evaluate) {
+    corner_evaluate(process, process->bvh_queue, c);
+  }
+  else {
+    process->pending_corners.append(c);
+  }
 
   c->next = process->corners[index];
   process->corners[index] = c;
@@ -936,56 +952,22 @@ static int getedge(EDGELIST *table[], int i1, int j1, int k1, int i2, int j2, in
   return -1;
 }
 
-/**
- * Adds a vertex, expands memory if needed.
- */
-static void addtovertices(PROCESS *process, const float v[3], const float no[3])
-{
-  process->co.append(v);
-  process->no.append(no);
-}
-
-#ifndef USE_ACCUM_NORMAL
-/**
- * Computes normal from density field at given point.
- *
- * \note Doesn't do normalization!
- */
-static void vnormal(PROCESS *process, const float point[3], float r_no[3])
-{
-  const float delta = process->delta;
-  const float f = metaball(process, point[0], point[1], point[2]);
-
-  r_no[0] = metaball(process, point[0] + delta, point[1], point[2]) - f;
-  r_no[1] = metaball(process, point[0], point[1] + delta, point[2]) - f;
-  r_no[2] = metaball(process, point[0], point[1], point[2] + delta) - f;
-}
-#endif /* !USE_ACCUM_NORMAL */
-
 /**
  * \return the id of vertex between two corners.
  *
- * If it wasn't previously computed, does #converge() and adds vertex to process.
+ * If it wasn't previously added, adds vertex to process. Its position is computed with
+ * #converge() for all vertices at once after polygonization.
  */
 static int vertid(PROCESS *process, const CORNER *c1, const CORNER *c2)
 {
-  float v[3], no[3];
   int vid = getedge(process->edges, c1->i, c1->j, c1->k, c2->i, c2->j, c2->k);
 
   if (vid != -1) {
     return vid; /* previously computed */
   }
 
-  converge(process, c1, c2, v); /* position */
-
-#ifdef USE_ACCUM_NORMAL
-  zero_v3(no);
-#else
-  vnormal(process, v, no);
-#endif
-
-  addtovertices(process, v, no); /* save vertex */
-  vid = int(process->co.size()) - 1;
+  process->vert_corners.append({c1, c2});
+  vid = int(process->vert_corners.size()) - 1;
   setedge(process, c1->i, c1->j, c1->k, c2->i, c2->j, c2->k, vid);
 
   return vid;
@@ -995,7 +977,11 @@ static int vertid(PROCESS *process, const CORNER *c1, const CORNER *c2)
  * Given two corners, computes approximation of surface intersection point between them.
  * In case of small threshold, do bisection.
  */
-static void converge(PROCESS *process, const CORNER *c1, const CORNER *c2, float r_p[3])
+static void converge(const PROCESS *process,
+                     MetaballBVHNode **bvh_queue,
+                     const CORNER *c1,
+                     const CORNER *c2,
+                     float r_p[3])
 {
   float c1_value, c1_co[3];
   float c2_value, c2_co[3];
@@ -1015,7 +1001,7 @@ static void converge(PROCESS *process, const CORNER *c1, const CORNER *c2, float
 
   for (uint i = 0; i < process->converge_res; i++) {
     interp_v3_v3v3(r_p, c1_co, c2_co, 0.5f);
-    float dens = metaball(process, r_p[0], r_p[1], r_p[2]);
+    float dens = metaball(process, bvh_queue, r_p[0], r_p[1], r_p[2]);
 
     if (dens > 0.0f) {
       c1_value = dens;
@@ -1053,7 +1039,7 @@ static void add_cube(PROCESS *process, int i, int j, int k)
     /* set corners of initial cube: */
     for (n = 0; n < 8; n++) {
       ncube->cube.corners[n] = setcorner(
-          process, i + MB_BIT(n, 2), j + MB_BIT(n, 1), k + MB_BIT(n, 0));
+          process, i + MB_BIT(n, 2), j + MB_BIT(n, 1), k + MB_BIT(n, 0), false);
     }
   }
 }
@@ -1103,13 +1089,13 @@ static void find_first_points(PROCESS *process, const uint em)
 
         copy_v3_v3_int(it, center);
 
-        b = setcorner(process, it[0], it[1], it[2])->value;
+        b = setcorner(process, it[0], it[1], it[2], true)->value;
         do {
           it[0] += dir[0];
           it[1] += dir[1];
           it[2] += dir[2];
           a = b;
-          b = setcorner(process, it[0], it[1], it[2])->value;
+          b = setcorner(process, it[0], it[1], it[2], true)->value;
 
           if (a * b < 0.0f) {
             add[0] = it[0] - dir[0];
@@ -1134,7 +1120,6 @@ static void find_first_points(PROCESS *process, const uint em)
  */
 static void polygonize(PROCESS *process)
 {
-  CUBE c;
 
   process->centers = static_cast<CENTERLIST **>(
       MEM_callocN(HASHSIZE * sizeof(CENTERLIST *), "mbproc->centers"));
@@ -1151,14 +1136,40 @@ static void polygonize(PROCESS *process)
     find_first_points(process, i);
   }
 
+  /* Process the cubes in waves, so that the function values at their corners can be evaluated on
+   * multiple threads. Processing a wave adds the neighboring cubes for the next one. */
+  blender::Vector<CUBE> wave;
   while (process->cubes != nullptr) {
-    c = process->cubes->cube;
-    process->cubes = process->cubes->next;
+    wave.clear();
+    for (const CUBES *cubes = process->cubes; cubes; cubes = cubes->next) {
+      wave.append(cubes->cube);
+    }
+    process->cubes = nullptr;
 
-    docube(process, &c);
+    evaluate_pending_corners(process);
+    for (CUBE &c : wave) {
+      docube(process, &c);
+    }
   }
 }
 
+/**
+ * Compute the positions of all surface vertices on the edges between their corners.
+ */
+static blender::Array<blender::float3> calc_vert_positions(const PROCESS *process)
+{
+  using namespace blender;
+  const Span<std::array<const CORNER *, 2>> vert_corners = process->vert_corners;
+  Array<float3> positions(vert_corners.size());
+  threading::parallel_for(vert_corners.index_range(), 256, [&](const IndexRange range) {
+    Array<MetaballBVHNode *, 64> bvh_queue(process->bvh_queue_size);
+    for (const int64_t i : range) {
+      converge(process, bvh_queue.data(), vert_corners[i][0], vert_corners[i][1], positions[i]);
+    }
+  });
+  return positions;
+}
+
 static bool object_has_zero_axis_matrix(const Object *bob)
 {
   if (has_zero_axis_m4(bob->object_to_world().ptr())) {
@@ -1400,8 +1411,7 @@ Mesh *BKE_mball_polygonize(Depsgraph *depsgraph, Scene *scene, Object *ob)
 
   process.delta = process.size * 0.001f;
 
-  process.co.reserve(MBALL_ARRAY_LEN_INIT);
-  process.no.reserve(MBALL_ARRAY_LEN_INIT);
+  process.vert_corners.reserve(MBALL_ARRAY_LEN_INIT);
   process.pgn_elements = BLI_memarena_new(BLI_MEMARENA_STD_BUFSIZE, "Metaball memarena");
 
   /* initialize all mainb (MetaElems) */
@@ -1430,6 +1440,8 @@ Mesh *BKE_mball_polygonize(Depsgraph *depsgraph, Scene *scene, Object *ob)
     return nullptr;
   }
 
+  const blender::Array<blender::float3> positions = calc_vert_positions(&process);
+
   freepolygonize(&process);
 
   int corners_num = 0;
@@ -1439,8 +1451,8 @@ Mesh *BKE_mball_polygonize(Depsgraph *depsgraph, Scene *scene, Object *ob)
     corners_num += count;
   }
 
-  Mesh *mesh = BKE_mesh_new_nomain(int(process.co.size()), 0, int(process.curindex), corners_num);
-  mesh->vert_positions_for_write().copy_from(process.co);
+  Mesh *mesh = BKE_mesh_new_nomain(int(positions.size()), 0, int(process.curindex), corners_num);
+  mesh->vert_positions_for_write().copy_from(positions);
   blender::MutableSpan<int> face_offsets = mesh->face_offsets_for_write();
   blender::MutableSpan<int> corner_verts = mesh->corner_verts_for_write();
 
@@ -1462,11 +1474,6 @@ Mesh *BKE_mball_polygonize(Depsgraph *depsgraph, Scene *scene, Object *ob)
   }
   MEM_freeN(process.indices);
 
-  for (int i = 0; i < mesh->verts_num; i++) {
-    normalize_v3(process.no[i]);
-  }
-  blender::bke::mesh_vert_normals_assign(*mesh, std::move(process.no));
-
   blender::bke::mesh_calc_edges(*mesh, false, false);
 
   return mesh;
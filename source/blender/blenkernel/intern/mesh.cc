@@ -430,7 +430,12 @@ static void mesh_blend_read_data(BlendDataReader *reader, ID *id)
 
   if (mesh->face_offset_indices) {
     mesh->runtime->face_offsets_sharing_info = BLO_read_shared(
-        reader, &mesh->face_offset_indices, [&]() {
+        reader, &mesh->face_offset_indices, [&]() -> const blender::ImplicitSharingInfo * {
+          if (const blender::ImplicitSharingInfo *sharing_info = BLO_read_mapped_array(
+                  reader, mesh->faces_num + 1, &mesh->face_offset_indices))
+          {
+            return sharing_info;
+          }
           BLO_read_int32_array(reader, mesh->faces_num + 1, &mesh->face_offset_indices);
           return blender::implicit_sharing::info_for_mem_free(mesh->face_offset_indices);
         });
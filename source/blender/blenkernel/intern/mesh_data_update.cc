@@ -279,6 +279,12 @@ static Mesh *modifier_modify_mesh_and_geometry_set(ModifierData *md,
     }
   }
 
+  if (mesh_output && mesh_output != input_mesh) {
+    /* Avoid recalculating topology maps when the modifier output references the same topology
+     * as its input, as is the case for many deform-like node groups. */
+    mesh_share_topology_caches(*input_mesh, *mesh_output);
+  }
+
   return mesh_output;
 }
 
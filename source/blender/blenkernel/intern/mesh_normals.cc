@@ -19,6 +19,7 @@
 
 #include "BLI_array_utils.hh"
 #include "BLI_bit_vector.hh"
+#include "BLI_index_mask.hh"
 #include "BLI_linklist.h"
 #include "BLI_math_base.hh"
 #include "BLI_math_vector.hh"
@@ -31,6 +32,7 @@
 #include "BKE_global.hh"
 #include "BKE_mesh.hh"
 #include "BKE_mesh_mapping.hh"
+#include "BKE_mesh_types.hh"
 
 // #define DEBUG_TIME
 
@@ -154,6 +156,31 @@ void normals_calc_faces(const Span<float3> positions,
   });
 }
 
+static float3 vert_normal_calc(const Span<float3> positions,
+                               const OffsetIndices<int> faces,
+                               const Span<int> corner_verts,
+                               const GroupedSpan<int> vert_to_face_map,
+                               const Span<float3> face_normals,
+                               const int vert)
+{
+  const Span<int> vert_faces = vert_to_face_map[vert];
+  if (vert_faces.is_empty()) {
+    return math::normalize(positions[vert]);
+  }
+
+  float3 vert_normal(0);
+  for (const int face : vert_faces) {
+    const int2 adjacent_verts = face_find_adjacent_verts(faces[face], corner_verts, vert);
+    const float3 dir_prev = math::normalize(positions[adjacent_verts[0]] - positions[vert]);
+    const float3 dir_next = math::normalize(positions[adjacent_verts[1]] - positions[vert]);
+    const float factor = math::safe_acos_approx(math::dot(dir_prev, dir_next));
+
+    vert_normal += face_normals[face] * factor;
+  }
+
+  return math::normalize(vert_normal);
+}
+
 void normals_calc_verts(const Span<float3> vert_positions,
                         const OffsetIndices<int> faces,
                         const Span<int> corner_verts,
@@ -164,23 +191,8 @@ void normals_calc_verts(const Span<float3> vert_positions,
   const Span<float3> positions = vert_positions;
   threading::parallel_for(positions.index_range(), 1024, [&](const IndexRange range) {
     for (const int vert : range) {
-      const Span<int> vert_faces = vert_to_face_map[vert];
-      if (vert_faces.is_empty()) {
-        vert_normals[vert] = math::normalize(positions[vert]);
-        continue;
-      }
-
-      float3 vert_normal(0);
-      for (const int face : vert_faces) {
-        const int2 adjacent_verts = face_find_adjacent_verts(faces[face], corner_verts, vert);
-        const float3 dir_prev = math::normalize(positions[adjacent_verts[0]] - positions[vert]);
-        const float3 dir_next = math::normalize(positions[adjacent_verts[1]] - positions[vert]);
-        const float factor = math::safe_acos_approx(math::dot(dir_prev, dir_next));
-
-        vert_normal += face_normals[face] * factor;
-      }
-
-      vert_normals[vert] = math::normalize(vert_normal);
+      vert_normals[vert] = vert_normal_calc(
+          positions, faces, corner_verts, vert_to_face_map, face_normals, vert);
     }
   });
 }
@@ -241,6 +253,62 @@ blender::bke::MeshNormalDomain Mesh::normals_domain(const bool support_sharp_fac
   return MeshNormalDomain::Corner;
 }
 
+void Mesh::tag_positions_changed(const blender::IndexMask &changed_verts)
+{
+  using namespace blender;
+  using namespace blender::bke;
+  MeshRuntime &runtime = *this->runtime;
+  /* Vertex normals depend on the normals of all surrounding faces, so a partial update is only
+   * possible when face normals are cached. Past a certain fraction of moved vertices, finding the
+   * affected elements costs about as much as recalculating everything. */
+  if (!runtime.face_normals_cache.is_cached() || changed_verts.size() > this->verts_num / 4) {
+    this->tag_positions_changed();
+    return;
+  }
+
+  const Span<float3> positions = this->vert_positions();
+  const OffsetIndices faces = this->faces();
+  const Span<int> corner_verts = this->corner_verts();
+  const GroupedSpan<int> vert_to_face = this->vert_to_face_map();
+
+  /* Faces that use a moved vertex have a new normal. The normals of all vertices of those faces
+   * change in turn, because they are weighted by the face normals and corner angles. */
+  IndexMaskMemory memory;
+  Array<bool> faces_changed(faces.size(), false);
+  changed_verts.foreach_index([&](const int vert) {
+    faces_changed.as_mutable_span().fill_indices(vert_to_face[vert], true);
+  });
+  const IndexMask affected_faces = IndexMask::from_bools(faces_changed, memory);
+
+  runtime.corner_normals_cache.tag_dirty();
+  this->tag_positions_changed_no_normals();
+
+  runtime.face_normals_cache.update([&](Vector<float3> &r_data) {
+    affected_faces.foreach_index(GrainSize(1024), [&](const int face) {
+      r_data[face] = mesh::face_normal_calc(positions, corner_verts.slice(faces[face]));
+    });
+  });
+
+  if (!runtime.vert_normals_cache.is_cached()) {
+    runtime.vert_normals_cache.tag_dirty();
+    return;
+  }
+
+  Array<bool> verts_changed(this->verts_num, false);
+  affected_faces.foreach_index([&](const int face) {
+    verts_changed.as_mutable_span().fill_indices(corner_verts.slice(faces[face]), true);
+  });
+  const IndexMask affected_verts = IndexMask::from_bools(verts_changed, memory);
+
+  const Span<float3> face_normals = runtime.face_normals_cache.data();
+  runtime.vert_normals_cache.update([&](Vector<float3> &r_data) {
+    affected_verts.foreach_index(GrainSize(1024), [&](const int vert) {
+      r_data[vert] = mesh::vert_normal_calc(
+          positions, faces, corner_verts, vert_to_face, face_normals, vert);
+    });
+  });
+}
+
 blender::Span<blender::float3> Mesh::vert_normals() const
 {
   using namespace blender;
@@ -57,6 +57,24 @@ static void free_bvh_caches(MeshRuntime &mesh_runtime)
   mesh_runtime.bvh_cache_loose_verts_no_hidden.tag_dirty();
   mesh_runtime.bvh_cache_loose_edges.tag_dirty();
   mesh_runtime.bvh_cache_loose_edges_no_hidden.tag_dirty();
+  mesh_runtime.bvh_cache_verts_refit.only_positions_changed = false;
+  mesh_runtime.bvh_cache_corner_tris_refit.only_positions_changed = false;
+}
+
+/**
+ * Like #free_bvh_caches, but allows refitting the trees that only depend on the vertex positions
+ * and the topology. A tree can only be refit if it was valid before, or if it has only been
+ * invalidated by position changes since then.
+ */
+static void tag_bvh_caches_positions_changed(MeshRuntime &mesh_runtime)
+{
+  const bool refit_verts = mesh_runtime.bvh_cache_verts.is_cached() ||
+                           mesh_runtime.bvh_cache_verts_refit.only_positions_changed;
+  const bool refit_corner_tris = mesh_runtime.bvh_cache_corner_tris.is_cached() ||
+                                 mesh_runtime.bvh_cache_corner_tris_refit.only_positions_changed;
+  free_bvh_caches(mesh_runtime);
+  mesh_runtime.bvh_cache_verts_refit.only_positions_changed = refit_verts;
+  mesh_runtime.bvh_cache_corner_tris_refit.only_positions_changed = refit_corner_tris;
 }
 
 MeshRuntime::MeshRuntime() = default;
@@ -335,6 +353,55 @@ void BKE_mesh_runtime_clear_geometry(Mesh *mesh)
   mesh->flag &= ~ME_NO_OVERLAPPING_TOPOLOGY;
 }
 
+namespace blender::bke {
+
+static bool same_topology_arrays(const Mesh &a, const Mesh &b)
+{
+  /* Comparing pointers is enough, since both meshes are alive and own or share the arrays. */
+  if (a.verts_num != b.verts_num || a.edges_num != b.edges_num || a.faces_num != b.faces_num ||
+      a.corners_num != b.corners_num)
+  {
+    return false;
+  }
+  return a.edges().data() == b.edges().data() &&
+         a.face_offsets().data() == b.face_offsets().data() &&
+         a.corner_verts().data() == b.corner_verts().data() &&
+         a.corner_edges().data() == b.corner_edges().data();
+}
+
+template<typename T>
+static void share_cache_if_missing(const SharedCache<T> &src, SharedCache<T> &dst)
+{
+  if (!dst.is_cached()) {
+    dst = src;
+  }
+}
+
+bool mesh_share_topology_caches(const Mesh &src, Mesh &dst)
+{
+  if (&src == &dst || src.runtime->wrapper_type != ME_WRAPPER_TYPE_MDATA ||
+      dst.runtime->wrapper_type != ME_WRAPPER_TYPE_MDATA || !same_topology_arrays(src, dst))
+  {
+    return false;
+  }
+  const MeshRuntime &src_runtime = *src.runtime;
+  MeshRuntime &dst_runtime = *dst.runtime;
+  share_cache_if_missing(src_runtime.vert_to_face_offset_cache,
+                         dst_runtime.vert_to_face_offset_cache);
+  share_cache_if_missing(src_runtime.vert_to_face_map_cache, dst_runtime.vert_to_face_map_cache);
+  share_cache_if_missing(src_runtime.vert_to_corner_map_cache,
+                         dst_runtime.vert_to_corner_map_cache);
+  share_cache_if_missing(src_runtime.corner_to_face_map_cache,
+                         dst_runtime.corner_to_face_map_cache);
+  share_cache_if_missing(src_runtime.loose_edges_cache, dst_runtime.loose_edges_cache);
+  share_cache_if_missing(src_runtime.loose_verts_cache, dst_runtime.loose_verts_cache);
+  share_cache_if_missing(src_runtime.verts_no_face_cache, dst_runtime.verts_no_face_cache);
+  share_cache_if_missing(src_runtime.corner_tri_faces_cache, dst_runtime.corner_tri_faces_cache);
+  return true;
+}
+
+}  // namespace blender::bke
+
 void Mesh::tag_edges_split()
 {
   /* Triangulation didn't change because vertex positions and loop vertex indices didn't change. */
@@ -394,7 +461,7 @@ void Mesh::tag_positions_changed()
 
 void Mesh::tag_positions_changed_no_normals()
 {
-  free_bvh_caches(*this->runtime);
+  tag_bvh_caches_positions_changed(*this->runtime);
   this->runtime->corner_tris_cache.tag_dirty();
   this->runtime->bounds_cache.tag_dirty();
   this->runtime->shrinkwrap_boundary_cache.tag_dirty();
@@ -403,7 +470,7 @@ void Mesh::tag_positions_changed_no_normals()
 void Mesh::tag_positions_changed_uniformly()
 {
   /* The normals and triangulation didn't change, since all verts moved by the same amount. */
-  free_bvh_caches(*this->runtime);
+  tag_bvh_caches_positions_changed(*this->runtime);
   this->runtime->bounds_cache.tag_dirty();
 }
 
@@ -13,6 +13,7 @@
 #include "BLI_stack.hh"
 #include "BLI_string.h"
 #include "BLI_string_utf8_symbols.h"
+#include "BLI_task.hh"
 #include "BLI_vector_set.hh"
 
 #include "DNA_anim_types.h"
@@ -505,14 +506,28 @@ class NodeTreeMainUpdater {
       if (this->propagate_enum_definitions(ntree)) {
         result.interface_changed = true;
       }
-      if (node_field_inferencing::update_field_inferencing(ntree)) {
-        result.interface_changed = true;
-      }
-      this->update_from_field_inference(ntree);
-      if (node_tree_reference_lifetimes::analyse_reference_lifetimes(ntree)) {
-        result.interface_changed = true;
-      }
-      if (nodes::gizmos::update_tree_gizmo_propagation(ntree)) {
+      /* Gizmo propagation only depends on the tree topology, so it can be computed while the
+       * field inferencing and the reference lifetime analysis that depends on it are running.
+       * Ensure the shared caches up front, so that both tasks only read them. */
+      ntree.ensure_topology_cache();
+      ntree.ensure_interface_cache();
+      bool field_interface_changed = false;
+      bool gizmo_interface_changed = false;
+      threading::parallel_invoke(
+          ntree.all_nodes().size() > 256,
+          [&]() {
+            if (node_field_inferencing::update_field_inferencing(ntree)) {
+              field_interface_changed = true;
+            }
+            this->update_from_field_inference(ntree);
+            if (node_tree_reference_lifetimes::analyse_reference_lifetimes(ntree)) {
+              field_interface_changed = true;
+            }
+          },
+          [&]() {
+            gizmo_interface_changed = nodes::gizmos::update_tree_gizmo_propagation(ntree);
+          });
+      if (field_interface_changed || gizmo_interface_changed) {
         result.interface_changed = true;
       }
       this->update_socket_shapes(ntree);
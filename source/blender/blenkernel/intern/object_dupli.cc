@@ -94,6 +94,11 @@ struct DupliContext {
   Scene *scene;
   /** Root parent object at the scene level. */
   Object *root_object;
+  /**
+   * Hash of the root object name, mixed into the random id of every instance. Computed once
+   * because hashing the name per instance is noticeable with millions of instances.
+   */
+  uint root_object_hash;
   /** Immediate parent object in the context. */
   Object *object;
   float space_mat[4][4];
@@ -157,6 +162,7 @@ static void init_context(DupliContext *r_ctx,
   r_ctx->collection = nullptr;
 
   r_ctx->root_object = ob;
+  r_ctx->root_object_hash = BLI_hash_int(BLI_hash_string(ob->id.name + 2));
   r_ctx->object = ob;
   r_ctx->obedit = OBEDIT_FROM_OBACT(ob);
   r_ctx->instance_stack = &instance_stack;
@@ -324,7 +330,7 @@ static DupliObject *make_dupli(const DupliContext *ctx,
   }
 
   if (ctx->root_object != ob) {
-    dob->random_id ^= BLI_hash_int(BLI_hash_string(ctx->root_object->id.name + 2));
+    dob->random_id ^= ctx->root_object_hash;
   }
 
   return dob;
@@ -171,14 +171,6 @@ static void conj_complex(fftw_complex res, const fftw_complex cmpl1)
   res[1] = -cmpl1[1];
 }
 
-static void exp_complex(fftw_complex res, fftw_complex cmpl)
-{
-  float r = expf(cmpl[0]);
-
-  res[0] = cosf(cmpl[1]) * r;
-  res[1] = sinf(cmpl[1]) * r;
-}
-
 float BKE_ocean_jminus_to_foam(float jminus, float coverage)
 {
   float foam = jminus * -0.005f + coverage;
@@ -423,10 +415,13 @@ static void ocean_compute_htilda(void *__restrict userdata,
     fftw_complex exp_param2;
     fftw_complex conj_param;
 
-    init_complex(exp_param1, 0.0, omega(o->_k[i * (1 + o->_N / 2) + j], o->_depth) * t);
-    init_complex(exp_param2, 0.0, -omega(o->_k[i * (1 + o->_N / 2) + j], o->_depth) * t);
-    exp_complex(exp_param1, exp_param1);
-    exp_complex(exp_param2, exp_param2);
+    /* `exp(i * theta)` and `exp(-i * theta)` are complex conjugates, so evaluate the dispersion
+     * relation and the trigonometric functions only once. */
+    const float theta = omega(o->_k[i * (1 + o->_N / 2) + j], o->_depth) * t;
+    const float cos_theta = cosf(theta);
+    const float sin_theta = sinf(theta);
+    init_complex(exp_param1, cos_theta, sin_theta);
+    init_complex(exp_param2, cos_theta, -sin_theta);
     conj_complex(conj_param, o->_h0_minus[i * o->_N + j]);
 
     mul_complex_c(exp_param1, o->_h0[i * o->_N + j], exp_param1);
@@ -3832,6 +3832,51 @@ static void dynamics_step_sph_classical_integrate_task_cb_ex(void *__restrict us
   }
 }
 
+static void dynamics_step_newton_task_cb_ex(void *__restrict userdata,
+                                            const int p,
+                                            const TaskParallelTLS *__restrict /*tls*/)
+{
+  DynamicStepSolverTaskData *data = static_cast<DynamicStepSolverTaskData *>(userdata);
+  ParticleSimulationData *sim = data->sim;
+  ParticleSystem *psys = sim->psys;
+
+  ParticleData *pa;
+
+  if ((pa = psys->particles + p)->state.time <= 0.0f) {
+    return;
+  }
+
+  /* do global forces & effectors */
+  basic_integrate(sim, p, pa->state.time, data->cfra);
+
+  /* rotations */
+  basic_rotate(psys->part, pa, pa->state.time, data->timestep);
+}
+
+/**
+ * The newtonian step can only be evaluated in parallel when it does not draw from the shared
+ * random number generators, otherwise the result would depend on the order of evaluation.
+ */
+static bool dynamics_step_newton_use_threading(ParticleSimulationData *sim)
+{
+  ParticleSystem *psys = sim->psys;
+  if (psys->totpart <= 100) {
+    return false;
+  }
+  /* Collision responses use #ParticleSimulationData.rng for damping and friction. */
+  if (sim->colliders || psys->part->brownfac != 0.0f) {
+    return false;
+  }
+  if (psys->effectors) {
+    LISTBASE_FOREACH (const EffectorCache *, eff, psys->effectors) {
+      if (eff->pd && eff->pd->f_noise > 0.0f) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 /* unbaked particles are calculated dynamically */
 static void dynamics_step(ParticleSimulationData *sim, float cfra)
 {
@@ -3963,6 +4008,19 @@ static void dynamics_step(ParticleSimulationData *sim, float cfra)
 
   switch (part->phystype) {
     case PART_PHYS_NEWTON: {
+      if (dynamics_step_newton_use_threading(sim)) {
+        DynamicStepSolverTaskData task_data{};
+        task_data.sim = sim;
+        task_data.cfra = cfra;
+        task_data.timestep = timestep;
+        task_data.dtime = dtime;
+
+        TaskParallelSettings settings;
+        BLI_parallel_range_settings_defaults(&settings);
+        BLI_task_parallel_range(
+            0, psys->totpart, &task_data, dynamics_step_newton_task_cb_ex, &settings);
+        break;
+      }
       LOOP_DYNAMIC_PARTICLES
       {
         /* do global forces & effectors */
@@ -6,6 +6,7 @@
  * \ingroup bke
  */
 
+#include "BLI_array.hh"
 #include "BLI_bounds.hh"
 #include "BLI_heap_simple.h"
 #include "BLI_map.hh"
@@ -14,6 +15,7 @@
 #include "BLI_math_vector.hh"
 #include "BLI_memarena.h"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 #include "BLI_time.h"
 #include "BLI_utildefines.h"
 
@@ -931,46 +933,80 @@ static void short_edge_queue_edge_add(EdgeQueueContext *eq_ctx, BMEdge *e)
   }
 }
 
-static void long_edge_queue_face_add(EdgeQueueContext *eq_ctx, BMFace *f)
+/** Return true if the face passes the view normal test and intersects the brush region. */
+static bool edge_queue_face_in_range(const EdgeQueue *q, BMFace *f)
 {
-  if (eq_ctx->q->use_view_normal) {
-    if (dot_v3v3(f->no, eq_ctx->q->view_normal) < 0.0f) {
-      return;
+  if (q->use_view_normal) {
+    if (dot_v3v3(f->no, q->view_normal) < 0.0f) {
+      return false;
     }
   }
 
-  if (eq_ctx->q->edge_queue_tri_in_range(eq_ctx->q, f)) {
-    /* Check each edge of the face. */
-    BMLoop *l_first = BM_FACE_FIRST_LOOP(f);
-    BMLoop *l_iter = l_first;
-    do {
-      const float len_sq = BM_edge_calc_length_squared(l_iter->e);
-      if (len_sq > eq_ctx->q->limit_len_squared) {
-        long_edge_queue_edge_add_recursive(
-            eq_ctx, l_iter->radial_next, l_iter, len_sq, eq_ctx->q->limit_len);
+  return q->edge_queue_tri_in_range(q, f);
+}
+
+/**
+ * Gather the faces of leaf nodes marked for topology update which are in range of the brush.
+ * The range tests only read the mesh, so they are done for all nodes in parallel. The faces are
+ * returned in node order, so that the queue is filled in the same order as before.
+ */
+static Vector<BMFace *> edge_queue_faces_in_range(const EdgeQueue *q,
+                                                  const Span<BMeshNode> nodes)
+{
+  Array<Vector<BMFace *>> faces_by_node(nodes.size());
+  threading::parallel_for(nodes.index_range(), 1, [&](const IndexRange range) {
+    for (const int i : range) {
+      const BMeshNode &node = nodes[i];
+      if ((node.flag_ & Node::Leaf) && (node.flag_ & Node::UpdateTopology) &&
+          !(node.flag_ & Node::FullyHidden))
+      {
+        for (BMFace *f : node.bm_faces_) {
+          if (edge_queue_face_in_range(q, f)) {
+            faces_by_node[i].append(f);
+          }
+        }
       }
-    } while ((l_iter = l_iter->next) != l_first);
+    }
+  });
+
+  Vector<BMFace *> faces;
+  for (const Vector<BMFace *> &node_faces : faces_by_node) {
+    faces.extend(node_faces);
   }
+  return faces;
 }
 
-static void short_edge_queue_face_add(EdgeQueueContext *eq_ctx, BMFace *f)
+static void long_edge_queue_face_edges_add(EdgeQueueContext *eq_ctx, BMFace *f)
 {
-  if (eq_ctx->q->use_view_normal) {
-    if (dot_v3v3(f->no, eq_ctx->q->view_normal) < 0.0f) {
-      return;
+  /* Check each edge of the face. */
+  BMLoop *l_first = BM_FACE_FIRST_LOOP(f);
+  BMLoop *l_iter = l_first;
+  do {
+    const float len_sq = BM_edge_calc_length_squared(l_iter->e);
+    if (len_sq > eq_ctx->q->limit_len_squared) {
+      long_edge_queue_edge_add_recursive(
+          eq_ctx, l_iter->radial_next, l_iter, len_sq, eq_ctx->q->limit_len);
     }
+  } while ((l_iter = l_iter->next) != l_first);
+}
+
+static void long_edge_queue_face_add(EdgeQueueContext *eq_ctx, BMFace *f)
+{
+  if (edge_queue_face_in_range(eq_ctx->q, f)) {
+    long_edge_queue_face_edges_add(eq_ctx, f);
   }
+}
 
-  if (eq_ctx->q->edge_queue_tri_in_range(eq_ctx->q, f)) {
-    BMLoop *l_iter;
-    BMLoop *l_first;
+static void short_edge_queue_face_edges_add(EdgeQueueContext *eq_ctx, BMFace *f)
+{
+  BMLoop *l_iter;
+  BMLoop *l_first;
 
-    /* Check each edge of the face. */
-    l_iter = l_first = BM_FACE_FIRST_LOOP(f);
-    do {
-      short_edge_queue_edge_add(eq_ctx, l_iter->e);
-    } while ((l_iter = l_iter->next) != l_first);
-  }
+  /* Check each edge of the face. */
+  l_iter = l_first = BM_FACE_FIRST_LOOP(f);
+  do {
+    short_edge_queue_edge_add(eq_ctx, l_iter->e);
+  } while ((l_iter = l_iter->next) != l_first);
 }
 
 /**
@@ -1014,15 +1050,9 @@ static void long_edge_queue_create(EdgeQueueContext *eq_ctx,
   pbvh_bmesh_edge_tag_verify(pbvh);
 #endif
 
-  for (BMeshNode &node : nodes) {
-    /* Check leaf nodes marked for topology update. */
-    if ((node.flag_ & Node::Leaf) && (node.flag_ & Node::UpdateTopology) &&
-        !(node.flag_ & Node::FullyHidden))
-    {
-      for (BMFace *f : node.bm_faces_) {
-        long_edge_queue_face_add(eq_ctx, f);
-      }
-    }
+  /* Check leaf nodes marked for topology update. */
+  for (BMFace *f : edge_queue_faces_in_range(eq_ctx->q, nodes)) {
+    long_edge_queue_face_edges_add(eq_ctx, f);
   }
 }
 
@@ -1063,15 +1093,9 @@ static void short_edge_queue_create(EdgeQueueContext *eq_ctx,
     eq_ctx->q->edge_queue_tri_in_range = edge_queue_tri_in_sphere;
   }
 
-  for (BMeshNode &node : nodes) {
-    /* Check leaf nodes marked for topology update */
-    if ((node.flag_ & Node::Leaf) && (node.flag_ & Node::UpdateTopology) &&
-        !(node.flag_ & Node::FullyHidden))
-    {
-      for (BMFace *f : node.bm_faces_) {
-        short_edge_queue_face_add(eq_ctx, f);
-      }
-    }
+  /* Check leaf nodes marked for topology update. */
+  for (BMFace *f : edge_queue_faces_in_range(eq_ctx->q, nodes)) {
+    short_edge_queue_face_edges_add(eq_ctx, f);
   }
 }
 
@@ -41,6 +41,7 @@
 #include "BLI_math_vector.h"
 #include "BLI_path_utils.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_time.h"
 #include "BLI_utildefines.h"
 
@@ -878,6 +879,7 @@ void BKE_ptcache_id_from_softbody(PTCacheID *pid, Object *ob, SoftBody *sb)
   pid->error = ptcache_softbody_error;
 
   pid->write_point = ptcache_softbody_write;
+  pid->flag |= PTCACHE_INDEPENDENT_POINTS;
   pid->read_point = ptcache_softbody_read;
   pid->interpolate_point = ptcache_softbody_interpolate;
 
@@ -979,6 +981,7 @@ void BKE_ptcache_id_from_cloth(PTCacheID *pid, Object *ob, ClothModifierData *cl
   pid->error = ptcache_cloth_error;
 
   pid->write_point = ptcache_cloth_write;
+  pid->flag |= PTCACHE_INDEPENDENT_POINTS;
   pid->read_point = ptcache_cloth_read;
   pid->interpolate_point = ptcache_cloth_interpolate;
 
@@ -1071,6 +1074,7 @@ void BKE_ptcache_id_from_rigidbody(PTCacheID *pid, Object *ob, RigidBodyWorld *r
   pid->error = ptcache_rigidbody_error;
 
   pid->write_point = ptcache_rigidbody_write;
+  pid->flag |= PTCACHE_INDEPENDENT_POINTS;
   pid->read_point = ptcache_rigidbody_read;
   pid->interpolate_point = ptcache_rigidbody_interpolate;
 
@@ -1311,6 +1315,9 @@ static int ptcache_frame_from_filename(const char *filename, const char *ext)
 #define MAX_PTCACHE_PATH FILE_MAX
 #define MAX_PTCACHE_FILE (FILE_MAX * 2)
 
+#define PTCACHE_FILE_READ_BUFFER_SIZE (16 * 1024 * 1024)
+#define PTCACHE_FILE_WRITE_BUFFER_SIZE (1024 * 1024)
+
 static int ptcache_path(PTCacheID *pid, char dirname[MAX_PTCACHE_PATH])
 {
   const char *blendfile_path = BKE_main_blendfile_path_from_global();
@@ -1491,15 +1498,36 @@ static PTCacheFile *ptcache_file_open(PTCacheID *pid, int mode, int cfra)
 
   pf = static_cast<PTCacheFile *>(MEM_mallocN(sizeof(PTCacheFile), "PTCacheFile"));
   pf->fp = fp;
+  pf->io_buffer = nullptr;
   pf->old_format = 0;
   pf->frame = cfra;
 
+  /* Frames are read and written as many small values, the default stream buffer turns that
+   * into a large number of small requests which is very slow on network file systems. Read the
+   * whole frame at once instead (up to a limit), and write in large chunks. */
+  size_t buffer_size = PTCACHE_FILE_WRITE_BUFFER_SIZE;
+  if (mode == PTCACHE_FILE_READ) {
+    const size_t file_size = BLI_file_size(filepath);
+    if (file_size != size_t(-1)) {
+      buffer_size = std::clamp(file_size, size_t(BUFSIZ), size_t(PTCACHE_FILE_READ_BUFFER_SIZE));
+    }
+  }
+  pf->io_buffer = MEM_mallocN(buffer_size, "PTCacheFile buffer");
+  if (setvbuf(fp, static_cast<char *>(pf->io_buffer), _IOFBF, buffer_size) != 0) {
+    MEM_freeN(pf->io_buffer);
+    pf->io_buffer = nullptr;
+  }
+
   return pf;
 }
 static void ptcache_file_close(PTCacheFile *pf)
 {
   if (pf) {
     fclose(pf->fp);
+    /* Only free the buffer after closing, the stream still uses it while flushing. */
+    if (pf->io_buffer) {
+      MEM_freeN(pf->io_buffer);
+    }
     MEM_freeN(pf);
   }
 }
@@ -2167,11 +2195,44 @@ static int ptcache_read_stream(PTCacheID *pid, int cfra)
   return error == 0;
 }
 
+/**
+ * Call `fn(index, cur)` for the first `totpoint` points stored in `pm`, where `index` is the
+ * simulation point index and `cur` points to the data of that point.
+ */
+template<typename Fn>
+static void ptcache_mem_foreach_point(PTCacheID *pid, PTCacheMem *pm, int totpoint, const Fn &fn)
+{
+  if ((pid->flag & PTCACHE_INDEPENDENT_POINTS) == 0) {
+    void *cur[BPHYS_TOT_DATA];
+    BKE_ptcache_mem_pointers_init(pm, cur);
+    for (int i = 0; i < totpoint; i++) {
+      const int index = cur[BPHYS_DATA_INDEX] ? *static_cast<int *>(cur[BPHYS_DATA_INDEX]) : i;
+      fn(index, cur);
+      BKE_ptcache_mem_pointers_incr(cur);
+    }
+    return;
+  }
+
+  blender::threading::parallel_for(
+      blender::IndexRange(totpoint), 1024, [&](const blender::IndexRange range) {
+        void *cur[BPHYS_TOT_DATA];
+        for (int i = 0; i < BPHYS_TOT_DATA; i++) {
+          cur[i] = (pm->data_types & (1 << i)) ?
+                       (char *)pm->data[i] + range.start() * ptcache_data_size[i] :
+                       nullptr;
+        }
+        for (const int i : range) {
+          const int index = cur[BPHYS_DATA_INDEX] ? *static_cast<int *>(cur[BPHYS_DATA_INDEX]) :
+                                                    i;
+          fn(index, cur);
+          BKE_ptcache_mem_pointers_incr(cur);
+        }
+      });
+}
+
 static int ptcache_read(PTCacheID *pid, int cfra)
 {
   PTCacheMem *pm = nullptr;
-  int i;
-  int *index = &i;
 
   /* get a memory cache to read from */
   if (pid->cache->flag & PTCACHE_DISK_CACHE) {
@@ -2198,18 +2259,9 @@ static int ptcache_read(PTCacheID *pid, int cfra)
       }
     }
 
-    void *cur[BPHYS_TOT_DATA];
-    BKE_ptcache_mem_pointers_init(pm, cur);
-
-    for (i = 0; i < totpoint; i++) {
-      if (pm->data_types & (1 << BPHYS_DATA_INDEX)) {
-        index = static_cast<int *>(cur[BPHYS_DATA_INDEX]);
-      }
-
-      pid->read_point(*index, pid->calldata, cur, float(pm->frame), nullptr);
-
-      BKE_ptcache_mem_pointers_incr(cur);
-    }
+    ptcache_mem_foreach_point(pid, pm, totpoint, [&](const int index, void **cur) {
+      pid->read_point(index, pid->calldata, cur, float(pm->frame), nullptr);
+    });
 
     if (pid->read_extra_data && pm->extradata.first) {
       pid->read_extra_data(pid->calldata, pm, float(pm->frame));
@@ -2227,8 +2279,6 @@ static int ptcache_read(PTCacheID *pid, int cfra)
 static int ptcache_interpolate(PTCacheID *pid, float cfra, int cfra1, int cfra2)
 {
   PTCacheMem *pm = nullptr;
-  int i;
-  int *index = &i;
 
   /* get a memory cache to read from */
   if (pid->cache->flag & PTCACHE_DISK_CACHE) {
@@ -2255,18 +2305,9 @@ static int ptcache_interpolate(PTCacheID *pid, float cfra, int cfra1, int cfra2)
       }
     }
 
-    void *cur[BPHYS_TOT_DATA];
-    BKE_ptcache_mem_pointers_init(pm, cur);
-
-    for (i = 0; i < totpoint; i++) {
-      if (pm->data_types & (1 << BPHYS_DATA_INDEX)) {
-        index = static_cast<int *>(cur[BPHYS_DATA_INDEX]);
-      }
-
-      pid->interpolate_point(
-          *index, pid->calldata, cur, cfra, float(cfra1), float(cfra2), nullptr);
-      BKE_ptcache_mem_pointers_incr(cur);
-    }
+    ptcache_mem_foreach_point(pid, pm, totpoint, [&](const int index, void **cur) {
+      pid->interpolate_point(index, pid->calldata, cur, cfra, float(cfra1), float(cfra2), nullptr);
+    });
 
     if (pid->interpolate_extra_data && pm->extradata.first) {
       pid->interpolate_extra_data(pid->calldata, pm, cfra, float(cfra1), float(cfra2));
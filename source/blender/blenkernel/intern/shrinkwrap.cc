@@ -51,6 +51,15 @@
 /* Util macros */
 #define OUT_OF_MEMORY() ((void)printf("Shrinkwrap: Out of memory\n"))
 
+/**
+ * Every vertex performs at least one BVH query (or several for normal projection),
+ * so threading pays off on much smaller meshes than for plain per-vertex math.
+ * Chunks are kept reasonably large since the per-thread nearest/hit data is used
+ * as a proximity hint for the next vertex.
+ */
+#define SHRINKWRAP_THREADING_MIN_VERTS 1024
+#define SHRINKWRAP_MIN_ITER_PER_THREAD 256
+
 struct ShrinkwrapCalcData {
   ShrinkwrapModifierData *smd; /* shrinkwrap modifier data */
 
@@ -85,6 +94,14 @@ struct ShrinkwrapCalcCBData {
   SpaceTransform *local2aux;
 };
 
+static void shrinkwrap_parallel_range_settings(const ShrinkwrapCalcData *calc,
+                                               TaskParallelSettings *settings)
+{
+  BLI_parallel_range_settings_defaults(settings);
+  settings->use_threading = (calc->numVerts > SHRINKWRAP_THREADING_MIN_VERTS);
+  settings->min_iter_per_thread = SHRINKWRAP_MIN_ITER_PER_THREAD;
+}
+
 bool BKE_shrinkwrap_needs_normals(int shrinkType, int shrinkMode)
 {
   return (shrinkType == MOD_SHRINKWRAP_TARGET_PROJECT) ||
@@ -374,8 +391,7 @@ static void shrinkwrap_calc_nearest_vertex(ShrinkwrapCalcData *calc)
   data.calc = calc;
   data.tree = calc->tree;
   TaskParallelSettings settings;
-  BLI_parallel_range_settings_defaults(&settings);
-  settings.use_threading = (calc->numVerts > 10000);
+  shrinkwrap_parallel_range_settings(calc, &settings);
   settings.userdata_chunk = &nearest;
   settings.userdata_chunk_size = sizeof(nearest);
   BLI_task_parallel_range(
@@ -656,8 +672,7 @@ static void shrinkwrap_calc_normal_projection(ShrinkwrapCalcData *calc)
   data.proj_axis = proj_axis;
   data.local2aux = &local2aux;
   TaskParallelSettings settings;
-  BLI_parallel_range_settings_defaults(&settings);
-  settings.use_threading = (calc->numVerts > 10000);
+  shrinkwrap_parallel_range_settings(calc, &settings);
   settings.userdata_chunk = &hit;
   settings.userdata_chunk_size = sizeof(hit);
   BLI_task_parallel_range(
@@ -1327,8 +1342,7 @@ static void shrinkwrap_calc_nearest_surface_point(ShrinkwrapCalcData *calc)
   data.calc = calc;
   data.tree = calc->tree;
   TaskParallelSettings settings;
-  BLI_parallel_range_settings_defaults(&settings);
-  settings.use_threading = (calc->numVerts > 10000);
+  shrinkwrap_parallel_range_settings(calc, &settings);
   settings.userdata_chunk = &nearest;
   settings.userdata_chunk_size = sizeof(nearest);
   BLI_task_parallel_range(
@@ -6,11 +6,15 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "DNA_customdata_types.h"
 #include "DNA_mesh_types.h"
 #include "DNA_modifier_types.h"
 #include "DNA_object_types.h"
 #include "DNA_userdef_types.h"
 
+#include "BLI_implicit_sharing_ptr.hh"
+#include "BLI_vector.hh"
+
 #include "BKE_attribute.hh"
 #include "BKE_mesh.hh"
 #include "BKE_modifier.hh"
@@ -166,6 +170,96 @@ bool BKE_subsurf_modifier_has_gpu_subdiv(const Mesh *mesh)
 
 void (*BKE_subsurf_modifier_free_gpu_cache_cb)(subdiv::Subdiv *subdiv) = nullptr;
 
+namespace blender::bke::subdiv {
+
+/**
+ * Identifies the mesh data that the topology of a subdivision descriptor depends on, without
+ * looking at the values. Arrays are identified by their #ImplicitSharingInfo and its version.
+ * An evaluated mesh shares these arrays with the original mesh, so for deforming meshes
+ * the key stays the same across frames. Comparing the key is constant time. Comparing the
+ * topology through a converter is linear and also builds UV vertex maps.
+ */
+struct MeshTopologyKey {
+  int verts_num = 0;
+  int edges_num = 0;
+  int faces_num = 0;
+  int corners_num = 0;
+  Vector<ImplicitSharingVersion> arrays;
+
+  BLI_STRUCT_EQUALITY_OPERATORS_5(
+      MeshTopologyKey, verts_num, edges_num, faces_num, corners_num, arrays)
+};
+
+/**
+ * Gather the arrays read by the mesh converter. Returns none when one of them is not implicitly
+ * shared, in which case the topology has to be compared the regular way.
+ */
+static std::optional<MeshTopologyKey> make_topology_key(const Settings &settings, const Mesh &mesh)
+{
+  MeshTopologyKey key;
+  key.verts_num = mesh.verts_num;
+  key.edges_num = mesh.edges_num;
+  key.faces_num = mesh.faces_num;
+  key.corners_num = mesh.corners_num;
+
+  const auto add_array = [&](const ImplicitSharingInfo *sharing_info, const bool exists) {
+    if (exists && sharing_info == nullptr) {
+      return false;
+    }
+    key.arrays.append(ImplicitSharingVersion(sharing_info));
+    return true;
+  };
+  const auto add_attribute = [&](const StringRef name) {
+    const GAttributeReader attribute = mesh.attributes().lookup(name);
+    if (attribute && !attribute.varray.is_span()) {
+      return false;
+    }
+    return add_array(attribute ? attribute.sharing_info : nullptr, bool(attribute));
+  };
+
+  if (!add_attribute(".edge_verts") || !add_attribute(".corner_vert") ||
+      !add_attribute(".corner_edge"))
+  {
+    return std::nullopt;
+  }
+  if (!add_array(mesh.runtime->face_offsets_sharing_info, mesh.faces_num > 0)) {
+    return std::nullopt;
+  }
+  if (settings.use_creases) {
+    if (!add_attribute("crease_vert") || !add_attribute("crease_edge")) {
+      return std::nullopt;
+    }
+  }
+  /* The converter uses all UV maps for face-varying topology. */
+  for (const CustomDataLayer &layer : Span(mesh.corner_data.layers, mesh.corner_data.totlayer)) {
+    if (layer.type == CD_PROP_FLOAT2) {
+      if (!add_array(layer.sharing_info, true)) {
+        return std::nullopt;
+      }
+    }
+  }
+  return key;
+}
+
+static Subdiv *descriptor_ensure(Subdiv *subdiv,
+                                 MeshTopologyKey *&key,
+                                 const Settings &settings,
+                                 const Mesh &mesh)
+{
+  std::optional<MeshTopologyKey> new_key = make_topology_key(settings, mesh);
+  if (subdiv != nullptr && subdiv->topology_refiner != nullptr && key != nullptr && new_key &&
+      *key == *new_key && settings_equal(&subdiv->settings, &settings))
+  {
+    return subdiv;
+  }
+  subdiv = update_from_mesh(subdiv, &settings, &mesh);
+  MEM_delete(key);
+  key = new_key ? MEM_new<MeshTopologyKey>(__func__, std::move(*new_key)) : nullptr;
+  return subdiv;
+}
+
+}  // namespace blender::bke::subdiv
+
 subdiv::Subdiv *BKE_subsurf_modifier_subdiv_descriptor_ensure(SubsurfRuntimeData *runtime_data,
                                                               const Mesh *mesh,
                                                               const bool for_draw_code)
@@ -173,12 +267,29 @@ subdiv::Subdiv *BKE_subsurf_modifier_subdiv_descriptor_ensure(SubsurfRuntimeData
   if (for_draw_code) {
     runtime_data->used_gpu = 2; /* countdown in frames */
 
-    return runtime_data->subdiv_gpu = subdiv::update_from_mesh(
-               runtime_data->subdiv_gpu, &runtime_data->settings, mesh);
+    return runtime_data->subdiv_gpu = subdiv::descriptor_ensure(runtime_data->subdiv_gpu,
+                                                                runtime_data->subdiv_gpu_key,
+                                                                runtime_data->settings,
+                                                                *mesh);
   }
   runtime_data->used_cpu = 2;
-  return runtime_data->subdiv_cpu = subdiv::update_from_mesh(
-             runtime_data->subdiv_cpu, &runtime_data->settings, mesh);
+  return runtime_data->subdiv_cpu = subdiv::descriptor_ensure(runtime_data->subdiv_cpu,
+                                                              runtime_data->subdiv_cpu_key,
+                                                              runtime_data->settings,
+                                                              *mesh);
+}
+
+void BKE_subsurf_modifier_runtime_free(SubsurfRuntimeData *runtime_data)
+{
+  if (runtime_data->subdiv_cpu != nullptr) {
+    subdiv::free(runtime_data->subdiv_cpu);
+  }
+  if (runtime_data->subdiv_gpu != nullptr) {
+    subdiv::free(runtime_data->subdiv_gpu);
+  }
+  MEM_delete(runtime_data->subdiv_cpu_key);
+  MEM_delete(runtime_data->subdiv_gpu_key);
+  MEM_freeN(runtime_data);
 }
 
 int BKE_subsurf_modifier_eval_required_mode(bool is_final_render, bool is_edit_mode)
@@ -130,6 +130,15 @@ struct AutoTrackContext {
   int synchronized_scene_frame;
 
   SpinLock spin_lock;
+
+  /* Background tasks reading the frame which follows the one being tracked to into the movie
+   * cache, so that reading and decoding of frames overlaps with the tracking itself. */
+  TaskPool *prefetch_pool;
+};
+
+struct AutoTrackPrefetchData {
+  MovieClip *clip;
+  int clip_frame;
 };
 
 /* -------------------------------------------------------------------- */
@@ -689,6 +698,52 @@ static void autotrack_context_step_cb(void *__restrict userdata,
   BLI_addtail(&autotrack_tls->results, autotrack_result);
 }
 
+static void autotrack_prefetch_frame_cb(TaskPool *__restrict /*pool*/, void *taskdata)
+{
+  const AutoTrackPrefetchData *prefetch_data = static_cast<AutoTrackPrefetchData *>(taskdata);
+
+  const int scene_frame = BKE_movieclip_remap_clip_to_scene_frame(prefetch_data->clip,
+                                                                  prefetch_data->clip_frame);
+  MovieClipUser user{};
+  BKE_movieclip_user_set_frame(&user, scene_frame);
+  user.render_size = MCLIP_PROXY_RENDER_SIZE_FULL;
+  user.render_flag = 0;
+
+  /* Only the side effect of the frame being stored in the movie cache is needed here. */
+  ImBuf *ibuf = BKE_movieclip_get_ibuf(prefetch_data->clip, &user);
+  if (ibuf != nullptr) {
+    IMB_freeImBuf(ibuf);
+  }
+}
+
+/* Start reading the frames of the step which follows the current one in the background. */
+static void autotrack_context_prefetch_next_frames(AutoTrackContext *context)
+{
+  if (context->prefetch_pool == nullptr) {
+    context->prefetch_pool = BLI_task_pool_create_background(nullptr, TASK_PRIORITY_LOW);
+  }
+
+  /* Wait for the frames of the current step, so that only one frame is read ahead. */
+  BLI_task_pool_work_and_wait(context->prefetch_pool);
+
+  const int frame_delta = context->is_backwards ? -1 : 1;
+  bool clip_prefetched[MAX_ACCESSOR_CLIP] = {false};
+  for (int i = 0; i < context->num_autotrack_markers; ++i) {
+    const libmv_Marker &libmv_marker = context->autotrack_markers[i].libmv_marker;
+    if (clip_prefetched[libmv_marker.clip]) {
+      continue;
+    }
+    clip_prefetched[libmv_marker.clip] = true;
+
+    /* The current step tracks markers to `frame + frame_delta`, prefetch the frame after it. */
+    AutoTrackPrefetchData *prefetch_data = MEM_callocN<AutoTrackPrefetchData>(__func__);
+    prefetch_data->clip = context->autotrack_clips[libmv_marker.clip].clip;
+    prefetch_data->clip_frame = libmv_marker.frame + 2 * frame_delta;
+    BLI_task_pool_push(
+        context->prefetch_pool, autotrack_prefetch_frame_cb, prefetch_data, true, nullptr);
+  }
+}
+
 static void autotrack_context_reduce(const void *__restrict /*userdata*/,
                                      void *__restrict chunk_join,
                                      void *__restrict chunk)
@@ -709,6 +764,8 @@ bool BKE_autotrack_context_step(AutoTrackContext *context)
     return false;
   }
 
+  autotrack_context_prefetch_next_frames(context);
+
   AutoTrackTLS tls;
   BLI_listbase_clear(&tls.results);
 
@@ -877,6 +934,11 @@ static void release_keyframed_image_buffers(AutoTrackContext *context)
 
 void BKE_autotrack_context_free(AutoTrackContext *context)
 {
+  if (context->prefetch_pool != nullptr) {
+    BLI_task_pool_work_and_wait(context->prefetch_pool);
+    BLI_task_pool_free(context->prefetch_pool);
+  }
+
   if (context->autotrack != nullptr) {
     libmv_autoTrackDestroy(context->autotrack);
   }
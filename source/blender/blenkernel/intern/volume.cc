@@ -610,12 +610,18 @@ std::optional<blender::Bounds<blender::float3>> BKE_volume_min_max(const Volume
 {
 #ifdef WITH_OPENVDB
   /* TODO: if we know the volume is going to be displayed, it may be good to
-   * load it as part of dependency graph evaluation for better threading. We
-   * could also share the bounding box computation in the global volume cache. */
+   * load it as part of dependency graph evaluation for better threading. */
   if (BKE_volume_load(const_cast<Volume *>(volume), G.main)) {
     std::optional<blender::Bounds<blender::float3>> result;
     for (const int i : IndexRange(BKE_volume_num_grids(volume))) {
       const blender::bke::VolumeGridData *volume_grid = BKE_volume_grid_get(volume, i);
+      /* Avoid loading the tree from disk when the file already stores the bounds. */
+      if (const std::optional<blender::Bounds<blender::float3>> file_bounds =
+              volume_grid->bounds_from_file_meta_data())
+      {
+        result = blender::bounds::merge(result, *file_bounds);
+        continue;
+      }
       blender::bke::VolumeTreeAccessToken tree_token;
       result = blender::bounds::merge(result,
                                       BKE_volume_grid_bounds(volume_grid->grid_ptr(tree_token)));
@@ -182,6 +182,28 @@ bool VolumeGridData::is_loaded() const
   return tree_loaded_ && transform_loaded_ && meta_data_loaded_;
 }
 
+std::optional<Bounds<float3>> VolumeGridData::bounds_from_file_meta_data() const
+{
+  std::lock_guard lock{mutex_};
+  if (tree_loaded_ || !meta_data_loaded_ || !transform_loaded_) {
+    return std::nullopt;
+  }
+  const openvdb::Vec3IMetadata::ConstPtr min_meta = grid_->getMetadata<openvdb::Vec3IMetadata>(
+      openvdb::GridBase::META_FILE_BBOX_MIN);
+  const openvdb::Vec3IMetadata::ConstPtr max_meta = grid_->getMetadata<openvdb::Vec3IMetadata>(
+      openvdb::GridBase::META_FILE_BBOX_MAX);
+  if (!min_meta || !max_meta) {
+    return std::nullopt;
+  }
+  const openvdb::CoordBBox coord_bbox{openvdb::Coord(min_meta->value()),
+                                      openvdb::Coord(max_meta->value())};
+  if (coord_bbox.empty()) {
+    return std::nullopt;
+  }
+  const openvdb::BBoxd bbox = grid_->transform().indexToWorld(coord_bbox);
+  return Bounds<float3>{float3(bbox.min().asPointer()), float3(bbox.max().asPointer())};
+}
+
 void VolumeGridData::count_memory(MemoryCounter &memory) const
 {
   std::lock_guard lock{mutex_};
@@ -11,6 +11,7 @@
 #include <memory>
 #include <utility>
 
+#include "BLI_hash.hh"
 #include "BLI_implicit_sharing.hh"
 #include "BLI_struct_equality_utils.hh"
 
@@ -162,6 +163,33 @@ template<typename T = ImplicitSharingInfo, bool IsStrong = true> class ImplicitS
 
 using WeakImplicitSharingPtr = ImplicitSharingPtr<ImplicitSharingInfo, false>;
 
+/**
+ * Identifies the data of an implicitly shared array at a specific point in time, without keeping
+ * the data alive. This allows using arrays as keys for derived data cheaply, because the version
+ * of the sharing info is increased whenever the data is modified.
+ */
+struct ImplicitSharingVersion {
+  WeakImplicitSharingPtr sharing_info;
+  int64_t version = 0;
+
+  ImplicitSharingVersion() = default;
+  ImplicitSharingVersion(const ImplicitSharingInfo *info)
+  {
+    if (info != nullptr) {
+      info->add_weak_user();
+      this->sharing_info = WeakImplicitSharingPtr(info);
+      this->version = info->version();
+    }
+  }
+
+  uint64_t hash() const
+  {
+    return get_default_hash(this->sharing_info.get(), this->version);
+  }
+
+  BLI_STRUCT_EQUALITY_OPERATORS_2(ImplicitSharingVersion, sharing_info, version)
+};
+
 /**
  * Utility struct to allow used #ImplicitSharingPtr when it's necessary to type-erase the backing
  * storage for user-exposed data. For example, #blender::Vector, or #std::vector might be used to
@@ -8,6 +8,8 @@
  * \ingroup bli
  */
 
+#include "BLI_span.hh"
+
 #ifdef WITH_TBB
 #  include <tbb/parallel_sort.h>
 #else
@@ -31,4 +33,12 @@ void parallel_sort(RandomAccessIterator begin, RandomAccessIterator end, const C
 }
 #endif
 
+/**
+ * Sort the indices by the key of each index, using a parallel radix sort. The sort is stable, so
+ * indices with equal keys keep their relative order. For float keys, negative and positive zero
+ * are considered equal.
+ */
+void parallel_sort_indices_by_key(Span<float> keys, MutableSpan<int> indices);
+void parallel_sort_indices_by_key(Span<int> keys, MutableSpan<int> indices);
+
 }  // namespace blender
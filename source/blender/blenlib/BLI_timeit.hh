@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <iosfwd>
 #include <string>
 
 #include "BLI_sys_types.h"
@@ -56,6 +58,67 @@ class ScopedTimerAveraged {
   ~ScopedTimerAveraged();
 };
 
+/* -------------------------------------------------------------------- */
+/** \name Tracing
+ *
+ * Records named zones and counters of all threads into per-thread ring buffers, which can be
+ * exported as a trace to get a single timeline across subsystems. Recording is toggled at
+ * runtime, and costs only a relaxed atomic load per zone when it is disabled.
+ *
+ * Names are stored by pointer, so they have to be static strings like string literals.
+ * \{ */
+
+namespace detail {
+extern std::atomic<bool> is_tracing_enabled;
+void trace_zone_record(const char *name, TimePoint start, TimePoint end);
+}  // namespace detail
+
+inline bool trace_is_enabled()
+{
+  return detail::is_tracing_enabled.load(std::memory_order_relaxed);
+}
+
+void trace_enable(bool enable);
+
+/** Record the current value of a counter, if tracing is enabled. */
+void trace_counter(const char *name, int64_t value);
+
+/**
+ * Remove all recorded events. This must not be called while other threads record events.
+ */
+void trace_clear();
+
+/**
+ * Write the recorded events in the Chrome trace event format, which can be opened with
+ * `chrome://tracing`, Perfetto or converted for Tracy. This must not be called while other
+ * threads record events.
+ */
+void trace_write_chrome_json(std::ostream &stream);
+
+class ScopedTraceZone {
+ private:
+  const char *name_;
+  TimePoint start_;
+  bool is_recording_;
+
+ public:
+  ScopedTraceZone(const char *name) : name_(name), is_recording_(trace_is_enabled())
+  {
+    if (is_recording_) {
+      start_ = Clock::now();
+    }
+  }
+
+  ~ScopedTraceZone()
+  {
+    if (is_recording_) {
+      detail::trace_zone_record(name_, start_, Clock::now());
+    }
+  }
+};
+
+/** \} */
+
 }  // namespace blender::timeit
 
 #define SCOPED_TIMER(name) blender::timeit::ScopedTimer scoped_timer(name)
@@ -69,3 +132,8 @@ class ScopedTimerAveraged {
   static blender::timeit::Nanoseconds total_time_; \
   static blender::timeit::Nanoseconds min_time_ = blender::timeit::Nanoseconds::max(); \
   blender::timeit::ScopedTimerAveraged scoped_timer(name, total_count_, total_time_, min_time_)
+
+/**
+ * Record the scope as a named zone in the trace, see #blender::timeit::trace_enable.
+ */
+#define SCOPED_TRACE_ZONE(name) blender::timeit::ScopedTraceZone scoped_trace_zone(name)
@@ -1854,19 +1854,22 @@ static float fast_ray_nearest_hit(const BVHRayCastData *data, const BVHNode *nod
   return max_fff(t1x, t1y, t1z);
 }
 
-static void dfs_raycast(BVHRayCastData *data, BVHNode *node)
+static float ray_node_nearest_hit(const BVHRayCastData *data, const BVHNode *node)
 {
-  int i;
-
-  /* ray-bv is really fast.. and simple tests revealed its worth to test it
-   * before calling the ray-primitive functions */
   /* XXX: temporary solution for particles until fast_ray_nearest_hit supports ray.radius */
-  float dist = (data->ray.radius == 0.0f) ? fast_ray_nearest_hit(data, node) :
-                                            ray_nearest_hit(data, node->bv);
-  if (dist >= data->hit.dist) {
-    return;
-  }
+  return (data->ray.radius == 0.0f) ? fast_ray_nearest_hit(data, node) :
+                                      ray_nearest_hit(data, node->bv);
+}
 
+/**
+ * Visit a node whose bounding volume is hit at distance \a dist.
+ *
+ * The bounding volumes of all children are tested up front and the children are visited from
+ * the nearest to the farthest hit. This way the closest hits are found early, so more of the
+ * remaining children can be skipped without descending into them.
+ */
+static void dfs_raycast_node(BVHRayCastData *data, BVHNode *node, const float dist)
+{
   if (node->node_num == 0) {
     if (data->callback) {
       data->callback(data->userdata, node->index, &data->ray, &data->hit);
@@ -1876,22 +1879,52 @@ static void dfs_raycast(BVHRayCastData *data, BVHNode *node)
       data->hit.dist = dist;
       madd_v3_v3v3fl(data->hit.co, data->ray.origin, data->ray.direction, dist);
     }
+    return;
   }
-  else {
-    /* pick loop direction to dive into the tree (based on ray direction and split axis) */
-    if (data->ray_dot_axis[node->main_axis] > 0.0f) {
-      for (i = 0; i != node->node_num; i++) {
-        dfs_raycast(data, node->children[i]);
-      }
+
+  BVHNode *children[MAX_TREETYPE];
+  float children_dist[MAX_TREETYPE];
+  int children_num = 0;
+
+  /* Pick loop direction based on ray direction and split axis, this order is kept for children
+   * that are hit at the same distance. */
+  const bool forward = data->ray_dot_axis[node->main_axis] > 0.0f;
+  for (int i = 0; i != node->node_num; i++) {
+    BVHNode *child = node->children[forward ? i : node->node_num - 1 - i];
+    const float child_dist = ray_node_nearest_hit(data, child);
+    if (child_dist >= data->hit.dist) {
+      continue;
     }
-    else {
-      for (i = node->node_num - 1; i >= 0; i--) {
-        dfs_raycast(data, node->children[i]);
-      }
+    /* Insertion sort, there are only a few children per node. */
+    int j = children_num++;
+    for (; j > 0 && children_dist[j - 1] > child_dist; j--) {
+      children[j] = children[j - 1];
+      children_dist[j] = children_dist[j - 1];
     }
+    children[j] = child;
+    children_dist[j] = child_dist;
+  }
+
+  for (int i = 0; i < children_num; i++) {
+    /* The hit distance may have become shorter while visiting the previous children. */
+    if (children_dist[i] >= data->hit.dist) {
+      break;
+    }
+    dfs_raycast_node(data, children[i], children_dist[i]);
   }
 }
 
+static void dfs_raycast(BVHRayCastData *data, BVHNode *node)
+{
+  /* ray-bv is really fast.. and simple tests revealed its worth to test it
+   * before calling the ray-primitive functions */
+  const float dist = ray_node_nearest_hit(data, node);
+  if (dist >= data->hit.dist) {
+    return;
+  }
+  dfs_raycast_node(data, node, dist);
+}
+
 /**
  * A version of #dfs_raycast with minor changes to reset the index & dist each ray cast.
  */
@@ -1901,9 +1934,7 @@ static void dfs_raycast_all(BVHRayCastData *data, BVHNode *node)
 
   /* ray-bv is really fast.. and simple tests revealed its worth to test it
    * before calling the ray-primitive functions */
-  /* XXX: temporary solution for particles until fast_ray_nearest_hit supports ray.radius */
-  float dist = (data->ray.radius == 0.0f) ? fast_ray_nearest_hit(data, node) :
-                                            ray_nearest_hit(data, node->bv);
+  float dist = ray_node_nearest_hit(data, node);
   if (dist >= data->hit.dist) {
     return;
   }
@@ -298,6 +298,44 @@ static double op_sub(double a, double b)
   return a - b;
 }
 
+static double op_floordiv(double a, double b)
+{
+  return floor(a / b);
+}
+
+/* Python style modulo: the result has the same sign as the divisor. */
+static double op_mod(double a, double b)
+{
+  if (b == 0.0) {
+    /* Match Python, which raises ZeroDivisionError rather than a domain error. */
+    feraiseexcept(FE_DIVBYZERO);
+    return 0.0;
+  }
+
+  double r = fmod(a, b);
+
+  if (r != 0.0 && ((r < 0.0) != (b < 0.0))) {
+    r += b;
+  }
+
+  return r;
+}
+
+static double op_pow(double a, double b)
+{
+  return pow(a, b);
+}
+
+static double op_float(double arg)
+{
+  return arg;
+}
+
+static double op_bool(double arg)
+{
+  return arg ? 1.0 : 0.0;
+}
+
 static double op_radians(double arg)
 {
   return arg * M_PI / 180.0;
@@ -429,9 +467,18 @@ static BuiltinOpDef builtin_ops[] = {
     {"exp", UnaryOpFunc(exp)},
     {"log", UnaryOpFunc(log)},
     {"log", BinaryOpFunc(op_log2)},
+    {"log2", UnaryOpFunc(log2)},
+    {"log10", UnaryOpFunc(log10)},
     {"sqrt", UnaryOpFunc(sqrt)},
-    {"pow", BinaryOpFunc(pow)},
+    {"pow", BinaryOpFunc(op_pow)},
     {"fmod", BinaryOpFunc(fmod)},
+    {"hypot", BinaryOpFunc(hypot)},
+    {"copysign", BinaryOpFunc(copysign)},
+    {"sinh", UnaryOpFunc(sinh)},
+    {"cosh", UnaryOpFunc(cosh)},
+    {"tanh", UnaryOpFunc(tanh)},
+    {"float", UnaryOpFunc(op_float)},
+    {"bool", UnaryOpFunc(op_bool)},
     {"lerp", TernaryOpFunc(op_lerp)},
     {"clamp", UnaryOpFunc(op_clamp)},
     {"clamp", TernaryOpFunc(op_clamp3)},
@@ -466,6 +513,8 @@ static BuiltinOpDef builtin_ops[] = {
 #define TOKEN_NOT MAKE_CHAR2('N', 'O')
 #define TOKEN_IF MAKE_CHAR2('I', 'F')
 #define TOKEN_ELSE MAKE_CHAR2('E', 'L')
+#define TOKEN_POW MAKE_CHAR2('*', '*')
+#define TOKEN_FLOORDIV MAKE_CHAR2('/', '/')
 
 static const char *token_eq_characters = "!=><";
 static const char *token_characters = "~`!@#$%^&*+-=/\\?:;<>(){}[]|.,\"'";
@@ -677,6 +726,13 @@ static bool parse_next_token(ExprParseState *state)
     return true;
   }
 
+  /* Doubled operator tokens: `**` and `//`. */
+  if (ELEM(state->cur[0], '*', '/') && state->cur[1] == state->cur[0]) {
+    state->token = MAKE_CHAR2(state->cur[0], state->cur[1]);
+    state->cur += 2;
+    return true;
+  }
+
   /* Special characters (single character tokens) */
   if (strchr(token_characters, *state->cur)) {
     state->token = *state->cur++;
@@ -749,19 +805,11 @@ static int parse_function_args(ExprParseState *state)
   }
 }
 
-static bool parse_unary(ExprParseState *state)
+static bool parse_primary(ExprParseState *state)
 {
   int i;
 
   switch (state->token) {
-    case '+':
-      return parse_next_token(state) && parse_unary(state);
-
-    case '-':
-      CHECK_ERROR(parse_next_token(state) && parse_unary(state));
-      parse_add_func(state, op_negate);
-      return true;
-
     case '(':
       return parse_next_token(state) && parse_expr(state) && state->token == ')' &&
              parse_next_token(state);
@@ -835,6 +883,38 @@ static bool parse_unary(ExprParseState *state)
   }
 }
 
+static bool parse_unary(ExprParseState *state);
+
+static bool parse_power(ExprParseState *state)
+{
+  CHECK_ERROR(parse_primary(state));
+
+  /* Exponentiation is right-associative and binds more tightly than a unary
+   * operator on its left, but not on its right: `-2 ** -1 == -(2 ** (-1))`. */
+  if (state->token == TOKEN_POW) {
+    CHECK_ERROR(parse_next_token(state) && parse_unary(state));
+    parse_add_func(state, op_pow);
+  }
+
+  return true;
+}
+
+static bool parse_unary(ExprParseState *state)
+{
+  switch (state->token) {
+    case '+':
+      return parse_next_token(state) && parse_unary(state);
+
+    case '-':
+      CHECK_ERROR(parse_next_token(state) && parse_unary(state));
+      parse_add_func(state, op_negate);
+      return true;
+
+    default:
+      return parse_power(state);
+  }
+}
+
 static bool parse_mul(ExprParseState *state)
 {
   CHECK_ERROR(parse_unary(state));
@@ -851,6 +931,16 @@ static bool parse_mul(ExprParseState *state)
         parse_add_func(state, op_div);
         break;
 
+      case TOKEN_FLOORDIV:
+        CHECK_ERROR(parse_next_token(state) && parse_unary(state));
+        parse_add_func(state, op_floordiv);
+        break;
+
+      case '%':
+        CHECK_ERROR(parse_next_token(state) && parse_unary(state));
+        parse_add_func(state, op_mod);
+        break;
+
       default:
         return true;
     }
@@ -177,6 +177,8 @@ size_t BLI_file_zstd_from_mem_at_pos(
 
   ZSTD_CCtx *ctx = ZSTD_createCCtx();
   ZSTD_CCtx_setParameter(ctx, ZSTD_c_compressionLevel, compression_level);
+  /* The whole input is known up-front, which lets `Zstd` tune its parameters for it. */
+  ZSTD_CCtx_setPledgedSrcSize(ctx, len);
 
   ZSTD_inBuffer input = {buf, len, 0};
 
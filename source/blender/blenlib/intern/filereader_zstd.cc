@@ -10,6 +10,7 @@
 #include <cstring>
 #include <zstd.h>
 
+#include "BLI_assert.h"
 #include "BLI_fileops.hh"
 #include "BLI_filereader.h"
 
@@ -19,6 +20,34 @@
 
 #include "MEM_guardedalloc.h"
 
+/**
+ * Number of frames of a seekable file that are kept in memory. Reading the data of a #BHead
+ * typically jumps to another frame and back, so caching a single frame is not enough.
+ */
+#define ZSTD_FRAME_CACHE_SIZE 4
+/**
+ * Frames are decompressed incrementally, only as far as needed by the read requests, in steps
+ * of at least this size.
+ */
+#define ZSTD_FRAME_DECODE_STEP (1 << 16)
+
+/** A (possibly partially) decompressed frame of a seekable file. */
+struct ZstdFrameCache {
+  /** Index of the frame, -1 when the slot is unused. */
+  int frame;
+  /** Buffer for the whole uncompressed frame, only the first `decoded_size` bytes are valid. */
+  char *content;
+  size_t decoded_size;
+  size_t uncompressed_size;
+  /** Compressed frame data, freed once the frame is fully decompressed. */
+  char *compressed;
+  ZSTD_inBuffer in_buf;
+  /** Decompression context, holds the state to resume decompressing a partial frame. */
+  ZSTD_DCtx *ctx;
+  /** For least-recently-used eviction. */
+  uint64_t last_used;
+};
+
 struct ZstdReader {
   FileReader reader;
 
@@ -33,8 +62,8 @@ struct ZstdReader {
     size_t *compressed_ofs;
     size_t *uncompressed_ofs;
 
-    char *cached_content;
-    int cached_frame;
+    ZstdFrameCache cache[ZSTD_FRAME_CACHE_SIZE];
+    uint64_t cache_clock;
   } seek;
 };
 
@@ -132,7 +161,9 @@ static bool zstd_read_seek_table(ZstdReader *zstd)
     return false;
   }
 
-  zstd->seek.cached_frame = -1;
+  for (ZstdFrameCache &cache : zstd->seek.cache) {
+    cache.frame = -1;
+  }
 
   return true;
 }
@@ -160,42 +191,105 @@ static int zstd_frame_from_pos(ZstdReader *zstd, size_t pos)
   return low;
 }
 
-/* Ensure that the currently loaded frame is the correct one. */
-static const char *zstd_ensure_cache(ZstdReader *zstd, int frame)
+static void zstd_frame_cache_clear(ZstdFrameCache *cache)
 {
-  if (zstd->seek.cached_frame == frame) {
-    /* Cached frame matches, so just return it. */
-    return zstd->seek.cached_content;
-  }
+  MEM_SAFE_FREE(cache->content);
+  MEM_SAFE_FREE(cache->compressed);
+  cache->frame = -1;
+  cache->decoded_size = 0;
+}
 
-  /* Cached frame doesn't match, so discard it and cache the wanted one instead. */
-  MEM_SAFE_FREE(zstd->seek.cached_content);
+static ZstdFrameCache *zstd_frame_cache_load(ZstdReader *zstd, int frame)
+{
+  /* Evict the least recently used frame. */
+  ZstdFrameCache *cache = &zstd->seek.cache[0];
+  for (ZstdFrameCache &other : zstd->seek.cache) {
+    if (other.frame == -1) {
+      cache = &other;
+      break;
+    }
+    if (other.last_used < cache->last_used) {
+      cache = &other;
+    }
+  }
+  zstd_frame_cache_clear(cache);
 
   size_t compressed_size = zstd->seek.compressed_ofs[frame + 1] - zstd->seek.compressed_ofs[frame];
   size_t uncompressed_size = zstd->seek.uncompressed_ofs[frame + 1] -
                              zstd->seek.uncompressed_ofs[frame];
 
-  char *uncompressed_data = static_cast<char *>(MEM_mallocN(uncompressed_size, __func__));
   char *compressed_data = static_cast<char *>(MEM_mallocN(compressed_size, __func__));
   if (zstd->base->seek(zstd->base, zstd->seek.compressed_ofs[frame], SEEK_SET) < 0 ||
       zstd->base->read(zstd->base, compressed_data, compressed_size) < compressed_size)
   {
     MEM_freeN(compressed_data);
-    MEM_freeN(uncompressed_data);
     return nullptr;
   }
 
-  size_t res = ZSTD_decompressDCtx(
-      zstd->ctx, uncompressed_data, uncompressed_size, compressed_data, compressed_size);
-  MEM_freeN(compressed_data);
-  if (ZSTD_isError(res) || res < uncompressed_size) {
-    MEM_freeN(uncompressed_data);
-    return nullptr;
+  if (cache->ctx == nullptr) {
+    cache->ctx = ZSTD_createDCtx();
+  }
+  else {
+    ZSTD_DCtx_reset(cache->ctx, ZSTD_reset_session_only);
+  }
+
+  cache->frame = frame;
+  cache->content = static_cast<char *>(MEM_mallocN(uncompressed_size, __func__));
+  cache->uncompressed_size = uncompressed_size;
+  cache->decoded_size = 0;
+  cache->compressed = compressed_data;
+  cache->in_buf = {compressed_data, compressed_size, 0};
+  return cache;
+}
+
+/**
+ * Ensure that the given frame is cached and decompressed at least up to `end_in_frame`.
+ * Frames are decompressed incrementally, so that reading e.g. a single #BHead at the start of a
+ * frame does not require decompressing the whole frame.
+ */
+static const char *zstd_ensure_cache(ZstdReader *zstd, int frame, size_t end_in_frame)
+{
+  ZstdFrameCache *cache = nullptr;
+  for (ZstdFrameCache &other : zstd->seek.cache) {
+    if (other.frame == frame) {
+      cache = &other;
+      break;
+    }
+  }
+  if (cache == nullptr) {
+    cache = zstd_frame_cache_load(zstd, frame);
+    if (cache == nullptr) {
+      return nullptr;
+    }
+  }
+  cache->last_used = ++zstd->seek.cache_clock;
+
+  BLI_assert(end_in_frame <= cache->uncompressed_size);
+  while (cache->decoded_size < end_in_frame) {
+    const size_t decode_end = std::min(
+        cache->uncompressed_size,
+        std::max(end_in_frame, cache->decoded_size + ZSTD_FRAME_DECODE_STEP));
+    ZSTD_outBuffer output = {cache->content, decode_end, cache->decoded_size};
+    const size_t res = ZSTD_decompressStream(cache->ctx, &output, &cache->in_buf);
+    if (ZSTD_isError(res) || (output.pos == cache->decoded_size)) {
+      /* Corrupted frame, or no progress is made (truncated frame). */
+      zstd_frame_cache_clear(cache);
+      return nullptr;
+    }
+    cache->decoded_size = output.pos;
+    if (res == 0 && cache->decoded_size < cache->uncompressed_size) {
+      /* The frame ended before its size given in the seek table. */
+      zstd_frame_cache_clear(cache);
+      return nullptr;
+    }
+  }
+
+  if (cache->decoded_size == cache->uncompressed_size) {
+    /* Fully decompressed, the compressed data is not needed anymore. */
+    MEM_SAFE_FREE(cache->compressed);
   }
 
-  zstd->seek.cached_frame = frame;
-  zstd->seek.cached_content = uncompressed_data;
-  return uncompressed_data;
+  return cache->content;
 }
 
 static int64_t zstd_read_seekable(FileReader *reader, void *buffer, size_t size)
@@ -210,16 +304,17 @@ static int64_t zstd_read_seekable(FileReader *reader, void *buffer, size_t size)
       break;
     }
 
-    const char *framedata = zstd_ensure_cache(zstd, frame);
+    size_t frame_end_offset = std::min(zstd->seek.uncompressed_ofs[frame + 1], end_offset);
+    size_t frame_read_len = frame_end_offset - zstd->reader.offset;
+
+    size_t offset_in_frame = zstd->reader.offset - zstd->seek.uncompressed_ofs[frame];
+
+    const char *framedata = zstd_ensure_cache(zstd, frame, offset_in_frame + frame_read_len);
     if (framedata == nullptr) {
       /* Error while reading the frame, so return as much as we can. */
       break;
     }
 
-    size_t frame_end_offset = std::min(zstd->seek.uncompressed_ofs[frame + 1], end_offset);
-    size_t frame_read_len = frame_end_offset - zstd->reader.offset;
-
-    size_t offset_in_frame = zstd->reader.offset - zstd->seek.uncompressed_ofs[frame];
     memcpy((char *)buffer + read_len, framedata + offset_in_frame, frame_read_len);
     read_len += frame_read_len;
     zstd->reader.offset = frame_end_offset;
@@ -288,9 +383,11 @@ static void zstd_close(FileReader *reader)
   if (zstd->reader.seek) {
     MEM_freeN(zstd->seek.uncompressed_ofs);
     MEM_freeN(zstd->seek.compressed_ofs);
-    /* When an error has occurred this may be nullptr, see: #99744. */
-    if (zstd->seek.cached_content) {
-      MEM_freeN(zstd->seek.cached_content);
+    for (ZstdFrameCache &cache : zstd->seek.cache) {
+      zstd_frame_cache_clear(&cache);
+      if (cache.ctx) {
+        ZSTD_freeDCtx(cache.ctx);
+      }
     }
   }
   else {
@@ -1155,10 +1155,53 @@ static inline mpq3 tti_interp(
   return a - alpha * ab;
 }
 
+/**
+ * Index of `dot(ad, cross(b - a, c - a))` when all inputs are rounded exact values (index 1).
+ * The differences have index 2, the cross product coordinates index 6 and the dot product
+ * index 10. Use one more to be safe.
+ */
+constexpr int index_tti_above = 11;
+
+static double3 mpq3_to_double3(const mpq3 &v)
+{
+  return double3(v[0].get_d(), v[1].get_d(), v[2].get_d());
+}
+
+/**
+ * Floating point filter for #tti_above, using the double approximations of its arguments.
+ * Return +1 or -1 if the sign is certain, and 0 if exact arithmetic is needed to decide.
+ */
+static int filter_tti_above(const double3 &a,
+                            const double3 &b,
+                            const double3 &c,
+                            const double3 &ad)
+{
+  const double3 ba = b - a;
+  const double3 ca = c - a;
+  const double3 n(ba.y * ca.z - ba.z * ca.y, ba.z * ca.x - ba.x * ca.z, ba.x * ca.y - ba.y * ca.x);
+  const double d = math::dot(ad, n);
+  if (d == 0.0) {
+    return 0;
+  }
+  const double3 abs_a = math::abs(a);
+  const double3 abs_ba = math::abs(b) + abs_a;
+  const double3 abs_ca = math::abs(c) + abs_a;
+  const double3 abs_n(abs_ba.y * abs_ca.z + abs_ba.z * abs_ca.y,
+                      abs_ba.z * abs_ca.x + abs_ba.x * abs_ca.z,
+                      abs_ba.x * abs_ca.y + abs_ba.y * abs_ca.x);
+  const double supremum = math::dot(math::abs(ad), abs_n);
+  const double err_bound = supremum * index_tti_above * DBL_EPSILON;
+  if (fabs(d) > err_bound) {
+    return d > 0 ? 1 : -1;
+  }
+  return 0;
+}
+
 /**
  * Return +1, 0, -1 as a + ad is above, on, or below the oriented plane containing a, b, c in CCW
  * order. This is the same as -oriented(a, b, c, a + ad), but uses fewer arithmetic operations.
- * TODO: change arguments to `const Vert *` and use floating filters.
+ * The double arguments are the approximations of the exact ones, used to try to decide the sign
+ * with #filter_tti_above before falling back to exact arithmetic.
  * The ba, ca, n, and dotbuf arguments are used as temporaries; declaring them
  * in the caller can avoid many allocations and frees of mpq3 and mpq_class structures.
  */
@@ -1166,11 +1209,19 @@ static inline int tti_above(const mpq3 &a,
                             const mpq3 &b,
                             const mpq3 &c,
                             const mpq3 &ad,
+                            const double3 &d_a,
+                            const double3 &d_b,
+                            const double3 &d_c,
+                            const double3 &d_ad,
                             mpq3 &ba,
                             mpq3 &ca,
                             mpq3 &n,
                             mpq3 &dotbuf)
 {
+  const int filter_side = filter_tti_above(d_a, d_b, d_c, d_ad);
+  if (filter_side != 0) {
+    return filter_side;
+  }
   ba = b;
   ba -= a;
   ca = c;
@@ -1226,12 +1277,22 @@ static ITT_value itt_canon2(const mpq3 &p1,
   mpq3 intersect_2;
   mpq3 buf[4];
   bool no_overlap = false;
+  const double3 d_p1 = mpq3_to_double3(p1);
+  const double3 d_q1 = mpq3_to_double3(q1);
+  const double3 d_r1 = mpq3_to_double3(r1);
+  const double3 d_q2 = mpq3_to_double3(q2);
+  const double3 d_r2 = mpq3_to_double3(r2);
+  const double3 d_p1p2 = mpq3_to_double3(p1p2);
+  /* All classification tests are about which side of a plane through p1 the point p2 is on. */
+  auto p2_above = [&](const mpq3 &b, const mpq3 &c, const double3 &d_b, const double3 &d_c) {
+    return tti_above(p1, b, c, p1p2, d_p1, d_b, d_c, d_p1p2, buf[0], buf[1], buf[2], buf[3]);
+  };
   /* Top test in classification tree. */
-  if (tti_above(p1, q1, r2, p1p2, buf[0], buf[1], buf[2], buf[3]) > 0) {
+  if (p2_above(q1, r2, d_q1, d_r2) > 0) {
     /* Middle right test in classification tree. */
-    if (tti_above(p1, r1, r2, p1p2, buf[0], buf[1], buf[2], buf[3]) <= 0) {
+    if (p2_above(r1, r2, d_r1, d_r2) <= 0) {
       /* Bottom right test in classification tree. */
-      if (tti_above(p1, r1, q2, p1p2, buf[0], buf[1], buf[2], buf[3]) > 0) {
+      if (p2_above(r1, q2, d_r1, d_q2) > 0) {
         /* Overlap is [k [i l] j]. */
         if (dbg_level > 0) {
           std::cout << "overlap [k [i l] j]\n";
@@ -1260,7 +1321,7 @@ static ITT_value itt_canon2(const mpq3 &p1,
   }
   else {
     /* Middle left test in classification tree. */
-    if (tti_above(p1, q1, q2, p1p2, buf[0], buf[1], buf[2], buf[3]) < 0) {
+    if (p2_above(q1, q2, d_q1, d_q2) < 0) {
       /* No overlap: [i j] [k l]. */
       if (dbg_level > 0) {
         std::cout << "no overlap: [i j] [k l]\n";
@@ -1269,7 +1330,7 @@ static ITT_value itt_canon2(const mpq3 &p1,
     }
     else {
       /* Bottom left test in classification tree. */
-      if (tti_above(p1, r1, q2, p1p2, buf[0], buf[1], buf[2], buf[3]) >= 0) {
+      if (p2_above(r1, q2, d_r1, d_q2) >= 0) {
         /* Overlap is [k [i j] l]. */
         if (dbg_level > 0) {
           std::cout << "overlap [k [i j] l]\n";
@@ -0,0 +1,142 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup bli
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include "BLI_array.hh"
+#include "BLI_math_base.h"
+#include "BLI_sort.hh"
+#include "BLI_task.hh"
+
+namespace blender {
+
+struct KeyIndex {
+  uint32_t key;
+  int index;
+};
+
+/* Small arrays are sorted with a comparison based sort, which is faster for them. */
+static constexpr int64_t radix_sort_min_size = 2048;
+/* Elements are split into chunks that are counted and scattered in parallel. */
+static constexpr int64_t radix_sort_chunk_size = 16384;
+static constexpr int radix_sort_digit_bits = 8;
+static constexpr int radix_sort_digits_num = 1 << radix_sort_digit_bits;
+
+/**
+ * Map the floats to unsigned integers that have the same order. Negative values have all bits
+ * flipped, positive values only the sign bit.
+ */
+static uint32_t float_to_sortable_bits(float value)
+{
+  if (value == 0.0f) {
+    /* Treat negative zero like positive zero. */
+    value = 0.0f;
+  }
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+static uint32_t int_to_sortable_bits(const int value)
+{
+  return uint32_t(value) ^ 0x80000000u;
+}
+
+/**
+ * Stable least significant digit radix sort. Every pass counts the digits for each chunk, then
+ * every chunk writes its elements to the offsets of the digits in that chunk.
+ */
+template<typename GetKeyFn>
+static void radix_sort_indices(MutableSpan<int> indices, const GetKeyFn &get_key)
+{
+  const int64_t size = indices.size();
+  if (size < radix_sort_min_size) {
+    std::stable_sort(indices.begin(), indices.end(), [&](const int a, const int b) {
+      return get_key(a) < get_key(b);
+    });
+    return;
+  }
+
+  Array<KeyIndex> buffer_a(size, NoInitialization());
+  Array<KeyIndex> buffer_b(size, NoInitialization());
+  threading::parallel_for(indices.index_range(), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      buffer_a[i] = {get_key(indices[i]), indices[i]};
+    }
+  });
+
+  const int64_t chunks_num = divide_ceil_ul(uint64_t(size), uint64_t(radix_sort_chunk_size));
+  const auto chunk_range = [&](const int64_t chunk) {
+    const int64_t start = chunk * radix_sort_chunk_size;
+    return IndexRange(start, std::min(radix_sort_chunk_size, size - start));
+  };
+
+  Array<int64_t> offsets(chunks_num * radix_sort_digits_num);
+  MutableSpan<KeyIndex> src = buffer_a;
+  MutableSpan<KeyIndex> dst = buffer_b;
+  for (int shift = 0; shift < 32; shift += radix_sort_digit_bits) {
+    threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange chunks) {
+      for (const int64_t chunk : chunks) {
+        MutableSpan<int64_t> counts = offsets.as_mutable_span().slice(
+            chunk * radix_sort_digits_num, radix_sort_digits_num);
+        counts.fill(0);
+        for (const KeyIndex &item : src.slice(chunk_range(chunk))) {
+          counts[(item.key >> shift) & (radix_sort_digits_num - 1)]++;
+        }
+      }
+    });
+
+    /* Chunks keep their order for every digit, which makes the sort stable. */
+    bool is_single_digit = false;
+    int64_t offset = 0;
+    for (const int digit : IndexRange(radix_sort_digits_num)) {
+      for (const int64_t chunk : IndexRange(chunks_num)) {
+        int64_t &chunk_offset = offsets[chunk * radix_sort_digits_num + digit];
+        const int64_t count = chunk_offset;
+        is_single_digit |= count == size;
+        chunk_offset = offset;
+        offset += count;
+      }
+    }
+    if (is_single_digit) {
+      /* All keys have the same digit, so this pass wouldn't change the order. This is common
+       * for the exponent bits of floats. */
+      continue;
+    }
+
+    threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange chunks) {
+      for (const int64_t chunk : chunks) {
+        MutableSpan<int64_t> chunk_offsets = offsets.as_mutable_span().slice(
+            chunk * radix_sort_digits_num, radix_sort_digits_num);
+        for (const KeyIndex &item : src.slice(chunk_range(chunk))) {
+          dst[chunk_offsets[(item.key >> shift) & (radix_sort_digits_num - 1)]++] = item;
+        }
+      }
+    });
+    std::swap(src, dst);
+  }
+
+  threading::parallel_for(indices.index_range(), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      indices[i] = src[i].index;
+    }
+  });
+}
+
+void parallel_sort_indices_by_key(const Span<float> keys, MutableSpan<int> indices)
+{
+  radix_sort_indices(indices, [&](const int i) { return float_to_sortable_bits(keys[i]); });
+}
+
+void parallel_sort_indices_by_key(const Span<int> keys, MutableSpan<int> indices)
+{
+  radix_sort_indices(indices, [&](const int i) { return int_to_sortable_bits(keys[i]); });
+}
+
+}  // namespace blender
@@ -121,15 +121,31 @@ void Task::operator()() const
  * Subclass since there seems to be no other way to set priority. */
 
 #ifdef WITH_TBB
+#  if TBB_INTERFACE_VERSION_MAJOR >= 12
+/**
+ * In TBB 2021 priorities are only available as part of task arenas, no longer for task groups.
+ * Tasks of low priority pools are run in this arena, so that worker threads prefer the tasks of
+ * regular pools, like those of the depsgraph evaluation. Nested parallel work inside these tasks
+ * stays in the arena, and thus also keeps the low priority.
+ */
+static tbb::task_arena &low_priority_arena()
+{
+  static tbb::task_arena arena{tbb::task_arena::automatic, 1, tbb::task_arena::priority::low};
+  return arena;
+}
+#  endif
+
 class TBBTaskGroup : public tbb::task_group {
  public:
+  /** Arena to run and wait for the tasks in, uses the arena of the calling thread when null. */
+  tbb::task_arena *arena = nullptr;
+
   TBBTaskGroup(eTaskPriority priority)
   {
 #  if TBB_INTERFACE_VERSION_MAJOR >= 12
-    /* TODO: support priorities in TBB 2021, where they are only available as
-     * part of task arenas, no longer for task groups. Or remove support for
-     * task priorities if they are no longer useful. */
-    UNUSED_VARS(priority);
+    if (priority == TASK_PRIORITY_LOW) {
+      this->arena = &low_priority_arena();
+    }
 #  else
     switch (priority) {
       case TASK_PRIORITY_LOW:
@@ -141,6 +157,16 @@ class TBBTaskGroup : public tbb::task_group {
     }
 #  endif
   }
+
+  template<typename Fn> void execute_in_arena(const Fn &fn)
+  {
+    if (this->arena) {
+      this->arena->execute(fn);
+    }
+    else {
+      fn();
+    }
+  }
 };
 #endif
 
@@ -366,7 +392,7 @@ void TaskPool::tbb_task_pool_run(Task &&task)
 #ifdef WITH_TBB
   else if (this->use_threads) {
     /* Execute in TBB task group. */
-    this->tbb_group->run(std::move(task));
+    this->tbb_group->execute_in_arena([&]() { this->tbb_group->run(std::move(task)); });
   }
 #endif
   else {
@@ -394,7 +420,7 @@ void TaskPool::tbb_task_pool_work_and_wait()
     /* This is called wait(), but internally it can actually do work. This
      * matters because we don't want recursive usage of task pools to run
      * out of threads and get stuck. */
-    this->tbb_group->wait();
+    this->tbb_group->execute_in_arena([&]() { this->tbb_group->wait(); });
   }
 #endif
 }
@@ -405,7 +431,7 @@ void TaskPool::tbb_task_pool_cancel()
 #ifdef WITH_TBB
   if (this->use_threads) {
     this->tbb_group->cancel();
-    this->tbb_group->wait();
+    this->tbb_group->execute_in_arena([&]() { this->tbb_group->wait(); });
   }
 #endif
 }
@@ -2,11 +2,15 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include "BLI_array.hh"
 #include "BLI_string_ref.hh"
 #include "BLI_timeit.hh"
+#include "BLI_vector.hh"
 
 #include <algorithm>
 #include <iostream>
+#include <memory>
+#include <mutex>
 
 #include <fmt/format.h>
 
@@ -77,4 +81,151 @@ ScopedTimerAveraged::~ScopedTimerAveraged()
   std::cout << StringRef(buf.data(), buf.size());
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Tracing
+ * \{ */
+
+namespace detail {
+std::atomic<bool> is_tracing_enabled = false;
+}
+
+struct TraceEvent {
+  const char *name;
+  /** Start time of zones, or the time counters were recorded at. */
+  TimePoint time;
+  /** Duration in nanoseconds for zones, or the value of counters. */
+  int64_t value;
+  bool is_counter;
+};
+
+/* The oldest events are overwritten when more events are recorded on a thread. */
+static constexpr int64_t trace_events_per_thread = 1 << 16;
+
+struct ThreadTraceBuffer {
+  int thread_id;
+  Array<TraceEvent> events{trace_events_per_thread, NoInitialization()};
+  /** Number of events recorded since the last clear, may be larger than the buffer size. */
+  int64_t recorded_num = 0;
+
+  void append(const TraceEvent &event)
+  {
+    events[recorded_num % trace_events_per_thread] = event;
+    recorded_num++;
+  }
+};
+
+struct TraceRecorder {
+  std::mutex mutex;
+  /** Buffers are never freed, so that events of threads that ended stay available. */
+  Vector<std::unique_ptr<ThreadTraceBuffer>> thread_buffers;
+  TimePoint start_time = Clock::now();
+};
+
+static TraceRecorder &trace_recorder()
+{
+  static TraceRecorder recorder;
+  return recorder;
+}
+
+static ThreadTraceBuffer &thread_trace_buffer()
+{
+  thread_local ThreadTraceBuffer *buffer = nullptr;
+  if (buffer == nullptr) {
+    TraceRecorder &recorder = trace_recorder();
+    std::lock_guard lock{recorder.mutex};
+    std::unique_ptr<ThreadTraceBuffer> new_buffer = std::make_unique<ThreadTraceBuffer>();
+    new_buffer->thread_id = int(recorder.thread_buffers.size());
+    buffer = new_buffer.get();
+    recorder.thread_buffers.append(std::move(new_buffer));
+  }
+  return *buffer;
+}
+
+void detail::trace_zone_record(const char *name, const TimePoint start, const TimePoint end)
+{
+  const Nanoseconds duration = end - start;
+  thread_trace_buffer().append({name, start, duration.count(), false});
+}
+
+void trace_enable(const bool enable)
+{
+  /* Make sure the start time is initialized before any event. */
+  trace_recorder();
+  detail::is_tracing_enabled.store(enable);
+}
+
+void trace_counter(const char *name, const int64_t value)
+{
+  if (!trace_is_enabled()) {
+    return;
+  }
+  thread_trace_buffer().append({name, Clock::now(), value, true});
+}
+
+void trace_clear()
+{
+  TraceRecorder &recorder = trace_recorder();
+  std::lock_guard lock{recorder.mutex};
+  for (std::unique_ptr<ThreadTraceBuffer> &buffer : recorder.thread_buffers) {
+    buffer->recorded_num = 0;
+  }
+}
+
+static void format_json_string(const StringRef str, fmt::memory_buffer &buf)
+{
+  buf.push_back('"');
+  for (const char c : str) {
+    if (c == '"' || c == '\\') {
+      buf.push_back('\\');
+    }
+    buf.push_back(c);
+  }
+  buf.push_back('"');
+}
+
+void trace_write_chrome_json(std::ostream &stream)
+{
+  TraceRecorder &recorder = trace_recorder();
+  std::lock_guard lock{recorder.mutex};
+
+  fmt::memory_buffer buf;
+  buf.append(StringRef("{\"traceEvents\":[\n"));
+  bool is_first = true;
+  for (const std::unique_ptr<ThreadTraceBuffer> &buffer : recorder.thread_buffers) {
+    const int64_t events_num = std::min(buffer->recorded_num, trace_events_per_thread);
+    const int64_t first_event = buffer->recorded_num - events_num;
+    for (const int64_t i : IndexRange(first_event, events_num)) {
+      const TraceEvent &event = buffer->events[i % trace_events_per_thread];
+      /* Time stamps are in microseconds. */
+      const double time = (event.time - recorder.start_time).count() / 1.0e3;
+      if (!is_first) {
+        buf.append(StringRef(",\n"));
+      }
+      is_first = false;
+      buf.append(StringRef("{\"name\":"));
+      format_json_string(event.name, buf);
+      if (event.is_counter) {
+        fmt::format_to(fmt::appender(buf),
+                       FMT_STRING(",\"ph\":\"C\",\"ts\":{:.3f},\"pid\":0,\"tid\":{},"
+                                  "\"args\":{{\"value\":{}}}}}"),
+                       time,
+                       buffer->thread_id,
+                       event.value);
+      }
+      else {
+        fmt::format_to(
+            fmt::appender(buf),
+            FMT_STRING(",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":0,\"tid\":{}}}"),
+            time,
+            event.value / 1.0e3,
+            buffer->thread_id);
+      }
+    }
+  }
+  buf.append(StringRef("\n]}\n"));
+  stream << StringRef(buf.data(), buf.size());
+}
+
+/** \} */
+
 }  // namespace blender::timeit
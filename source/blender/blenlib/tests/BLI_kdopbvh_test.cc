@@ -4,7 +4,7 @@
 
 #include "testing/testing.h"
 
-/* TODO: ray intersection, overlap ... etc. */
+/* TODO: overlap ... etc. */
 
 #include "MEM_guardedalloc.h"
 
@@ -134,3 +134,111 @@ TEST(kdopbvh, OptimalFindNearest_500)
 {
   find_nearest_points_test(500, 1.0, 1000, 12, true);
 }
+
+struct RayCastSpheresData {
+  const float (*centers)[3];
+  float radius;
+};
+
+/** Distance along the ray to the first hit with the sphere, or -1 when it's missed. */
+static float ray_sphere_dist(const float origin[3],
+                             const float dir[3],
+                             const float center[3],
+                             const float radius)
+{
+  float to_center[3];
+  sub_v3_v3v3(to_center, center, origin);
+  const float t = dot_v3v3(to_center, dir);
+  const float dist_sq = len_squared_v3(to_center) - t * t;
+  if (dist_sq > radius * radius) {
+    return -1.0f;
+  }
+  const float dist = t - sqrtf(radius * radius - dist_sq);
+  return dist >= 0.0f ? dist : -1.0f;
+}
+
+static void ray_cast_spheres_callback(void *userdata,
+                                      int index,
+                                      const BVHTreeRay *ray,
+                                      BVHTreeRayHit *hit)
+{
+  const RayCastSpheresData *data = static_cast<const RayCastSpheresData *>(userdata);
+  const float dist = ray_sphere_dist(
+      ray->origin, ray->direction, data->centers[index], data->radius);
+  if (dist >= 0.0f && dist < hit->dist) {
+    hit->index = index;
+    hit->dist = dist;
+    madd_v3_v3v3fl(hit->co, ray->origin, ray->direction, dist);
+  }
+}
+
+/**
+ * Cast rays from outside of a cloud of spheres and compare the closest hit to the result of
+ * testing every sphere.
+ */
+static void ray_cast_spheres_test(int spheres_len, int rays_len, int random_seed, int tree_type)
+{
+  const float radius = 0.05f;
+  RNG *rng = BLI_rng_new(random_seed);
+  BVHTree *tree = BLI_bvhtree_new(spheres_len, 0.0, char(tree_type), 6);
+
+  void *mem = MEM_mallocN(sizeof(float[3]) * spheres_len, __func__);
+  float(*centers)[3] = (float(*)[3])mem;
+
+  for (int i = 0; i < spheres_len; i++) {
+    rng_v3_round(centers[i], 3, rng, 1000, 1.0f);
+    float bounds[2][3];
+    copy_v3_v3(bounds[0], centers[i]);
+    copy_v3_v3(bounds[1], centers[i]);
+    add_v3_fl(bounds[0], -radius);
+    add_v3_fl(bounds[1], radius);
+    BLI_bvhtree_insert(tree, i, bounds[0], 2);
+  }
+  BLI_bvhtree_balance(tree);
+
+  RayCastSpheresData data = {centers, radius};
+  for (int i = 0; i < rays_len; i++) {
+    float origin[3], target[3], dir[3];
+    rng_v3_round(origin, 3, rng, 1000, 1.0f);
+    normalize_v3_length(origin, 3.0f);
+    rng_v3_round(target, 3, rng, 1000, 0.5f);
+    sub_v3_v3v3(dir, target, origin);
+    normalize_v3(dir);
+
+    int expected_index = -1;
+    float expected_dist = BVH_RAYCAST_DIST_MAX;
+    for (int j = 0; j < spheres_len; j++) {
+      const float dist = ray_sphere_dist(origin, dir, centers[j], radius);
+      if (dist >= 0.0f && dist < expected_dist) {
+        expected_index = j;
+        expected_dist = dist;
+      }
+    }
+
+    BVHTreeRayHit hit;
+    hit.index = -1;
+    hit.dist = BVH_RAYCAST_DIST_MAX;
+    BLI_bvhtree_ray_cast(tree, origin, dir, 0.0f, &hit, ray_cast_spheres_callback, &data);
+
+    EXPECT_EQ(hit.index, expected_index);
+    if (expected_index != -1) {
+      EXPECT_FLOAT_EQ(hit.dist, expected_dist);
+    }
+  }
+  BLI_bvhtree_free(tree);
+  BLI_rng_free(rng);
+  MEM_freeN(centers);
+}
+
+TEST(kdopbvh, RayCastSpheres_1)
+{
+  ray_cast_spheres_test(1, 100, 1234, 2);
+}
+TEST(kdopbvh, RayCastSpheres_500_Binary)
+{
+  ray_cast_spheres_test(500, 1000, 12, 2);
+}
+TEST(kdopbvh, RayCastSpheres_500_Quad)
+{
+  ray_cast_spheres_test(500, 1000, 12, 4);
+}
@@ -0,0 +1,146 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "BLI_array.hh"
+#include "BLI_rand.hh"
+#include "BLI_sort.hh"
+#include "BLI_timeit.hh"
+
+namespace blender::tests {
+
+template<typename T> static Array<int> stable_sorted_indices(const Span<T> keys)
+{
+  Array<int> indices(keys.size());
+  std::iota(indices.begin(), indices.end(), 0);
+  std::stable_sort(indices.begin(), indices.end(), [&](const int a, const int b) {
+    return keys[a] < keys[b];
+  });
+  return indices;
+}
+
+static Array<int> radix_sorted_indices(const Span<float> keys)
+{
+  Array<int> indices(keys.size());
+  std::iota(indices.begin(), indices.end(), 0);
+  parallel_sort_indices_by_key(keys, indices);
+  return indices;
+}
+
+static Array<int> radix_sorted_indices(const Span<int> keys)
+{
+  Array<int> indices(keys.size());
+  std::iota(indices.begin(), indices.end(), 0);
+  parallel_sort_indices_by_key(keys, indices);
+  return indices;
+}
+
+TEST(sort, SortIndicesByKeyEmpty)
+{
+  EXPECT_TRUE(radix_sorted_indices(Span<float>()).is_empty());
+}
+
+TEST(sort, SortIndicesByFloatKeySmall)
+{
+  const Array<float> keys = {3.0f, -1.0f, 2.5f, -0.0f, 0.0f, -7.5f, 2.5f};
+  const Array<int> indices = radix_sorted_indices(keys.as_span());
+  EXPECT_EQ_ARRAY(Span({5, 1, 3, 4, 2, 6, 0}).data(), indices.data(), 7);
+}
+
+TEST(sort, SortIndicesByFloatKeyLarge)
+{
+  RandomNumberGenerator rng(42);
+  Array<float> keys(100000);
+  for (float &key : keys) {
+    /* Use a limited set of values to have many equal keys. */
+    key = float(rng.get_int32(2000) - 1000) * 0.25f;
+  }
+  keys[10] = -0.0f;
+  keys[20] = 0.0f;
+  keys[30] = 1e30f;
+  keys[40] = -1e30f;
+  const Array<int> expected = stable_sorted_indices(keys.as_span());
+  const Array<int> indices = radix_sorted_indices(keys.as_span());
+  EXPECT_EQ_ARRAY(expected.data(), indices.data(), size_t(indices.size()));
+}
+
+TEST(sort, SortIndicesByFloatKeyLargeUniform)
+{
+  RandomNumberGenerator rng(7);
+  Array<float> keys(50000);
+  for (float &key : keys) {
+    key = rng.get_float();
+  }
+  const Array<int> expected = stable_sorted_indices(keys.as_span());
+  const Array<int> indices = radix_sorted_indices(keys.as_span());
+  EXPECT_EQ_ARRAY(expected.data(), indices.data(), size_t(indices.size()));
+}
+
+TEST(sort, SortIndicesByIntKeyLarge)
+{
+  RandomNumberGenerator rng(3);
+  Array<int> keys(80000);
+  for (int &key : keys) {
+    key = rng.get_int32() - (1 << 30);
+  }
+  keys[0] = std::numeric_limits<int>::min();
+  keys[1] = std::numeric_limits<int>::max();
+  const Array<int> expected = stable_sorted_indices(keys.as_span());
+  const Array<int> indices = radix_sorted_indices(keys.as_span());
+  EXPECT_EQ_ARRAY(expected.data(), indices.data(), size_t(indices.size()));
+}
+
+TEST(sort, SortIndicesByKeySubset)
+{
+  /* Only sort some of the indices, in a non-trivial initial order. */
+  RandomNumberGenerator rng(5);
+  Array<float> keys(20000);
+  for (float &key : keys) {
+    key = float(rng.get_int32(100));
+  }
+  Array<int> indices(keys.size() / 2);
+  for (const int i : indices.index_range()) {
+    indices[i] = int(keys.size()) - 1 - i * 2;
+  }
+  Array<int> expected = indices;
+  std::stable_sort(expected.begin(), expected.end(), [&](const int a, const int b) {
+    return keys[a] < keys[b];
+  });
+  parallel_sort_indices_by_key(keys.as_span(), indices);
+  EXPECT_EQ_ARRAY(expected.data(), indices.data(), size_t(indices.size()));
+}
+
+/* Disable benchmark by default. */
+#if 0
+TEST(sort, SortIndicesByKeyBenchmark)
+{
+  const int64_t size = 10'000'000;
+  RandomNumberGenerator rng(0);
+  Array<float> keys(size);
+  for (float &key : keys) {
+    key = rng.get_float();
+  }
+  for ([[maybe_unused]] const int64_t _ : IndexRange(3)) {
+    Array<int> indices(size);
+    std::iota(indices.begin(), indices.end(), 0);
+    {
+      SCOPED_TIMER("comparison sort");
+      parallel_sort(indices.begin(), indices.end(), [&](const int a, const int b) {
+        return keys[a] < keys[b];
+      });
+    }
+    std::iota(indices.begin(), indices.end(), 0);
+    {
+      SCOPED_TIMER("radix sort");
+      parallel_sort_indices_by_key(keys.as_span(), indices);
+    }
+  }
+}
+#endif
+
+}  // namespace blender::tests
@@ -0,0 +1,85 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include <sstream>
+
+#include "BLI_string_ref.hh"
+#include "BLI_timeit.hh"
+
+namespace blender::timeit::tests {
+
+static int64_t count_occurrences(const StringRef str, const StringRef pattern)
+{
+  int64_t count = 0;
+  for (int64_t pos = str.find(pattern); pos != StringRef::not_found;
+       pos = str.find(pattern, pos + 1))
+  {
+    count++;
+  }
+  return count;
+}
+
+static std::string trace_to_string()
+{
+  std::stringstream stream;
+  trace_write_chrome_json(stream);
+  return stream.str();
+}
+
+TEST(timeit, TraceDisabled)
+{
+  trace_clear();
+  trace_enable(false);
+  {
+    SCOPED_TRACE_ZONE("Zone");
+    trace_counter("Counter", 1);
+  }
+  const std::string trace = trace_to_string();
+  EXPECT_EQ(count_occurrences(trace, "\"name\""), 0);
+}
+
+TEST(timeit, TraceZones)
+{
+  trace_clear();
+  trace_enable(true);
+  {
+    SCOPED_TRACE_ZONE("Outer");
+    for (int i = 0; i < 3; i++) {
+      SCOPED_TRACE_ZONE("Inner");
+    }
+    trace_counter("Counter", 42);
+  }
+  trace_enable(false);
+  {
+    SCOPED_TRACE_ZONE("Ignored");
+  }
+  const std::string trace = trace_to_string();
+  EXPECT_EQ(count_occurrences(trace, "{\"name\":\"Outer\",\"ph\":\"X\""), 1);
+  EXPECT_EQ(count_occurrences(trace, "{\"name\":\"Inner\",\"ph\":\"X\""), 3);
+  EXPECT_EQ(count_occurrences(trace, "{\"name\":\"Counter\",\"ph\":\"C\""), 1);
+  EXPECT_EQ(count_occurrences(trace, "\"args\":{\"value\":42}"), 1);
+  EXPECT_EQ(count_occurrences(trace, "Ignored"), 0);
+
+  trace_clear();
+  EXPECT_EQ(count_occurrences(trace_to_string(), "\"name\""), 0);
+}
+
+TEST(timeit, TraceOverwriteOldest)
+{
+  trace_clear();
+  trace_enable(true);
+  trace_counter("First", 0);
+  for (int i = 0; i < 100000; i++) {
+    trace_counter("Counter", i);
+  }
+  trace_enable(false);
+  const std::string trace = trace_to_string();
+  EXPECT_EQ(count_occurrences(trace, "First"), 0);
+  EXPECT_EQ(count_occurrences(trace, "\"args\":{\"value\":99999}"), 1);
+  trace_clear();
+}
+
+}  // namespace blender::timeit::tests
@@ -304,6 +304,18 @@ void *BLO_read_struct_array_with_size(BlendDataReader *reader,
   *((void **)ptr_p) = BLO_read_struct_array_with_size( \
       reader, *((void **)ptr_p), sizeof(struct_name) * (array_size))
 
+/**
+ * Resolve in place all the items of an (already read) array of pointers to structs, this is
+ * equivalent to calling #BLO_read_struct on each item, but faster for large arrays.
+ */
+void BLO_read_struct_pointer_array_items_with_size(BlendDataReader *reader,
+                                                   int64_t array_size,
+                                                   void **array,
+                                                   size_t expected_size);
+#define BLO_read_struct_pointer_array_items(reader, struct_name, array_size, array) \
+  BLO_read_struct_pointer_array_items_with_size( \
+      reader, array_size, reinterpret_cast<void **>(array), sizeof(struct_name))
+
 /**
  * Similar to #BLO_read_struct_array_with_size, but can use a (DNA) type name instead of the type
  * itself to find the expected data size.
@@ -371,6 +383,35 @@ const blender::ImplicitSharingInfo *BLO_read_shared(
   return shared_data.sharing_info;
 }
 
+/**
+ * Reference a large array directly in the memory-mapped blend-file instead of copying it. This
+ * is only possible when reading an uncompressed file from disk, for data that does not need any
+ * conversion (DNA reconstruction, endianness switch...) and satisfies the given alignment.
+ *
+ * The mapping is private to the process, modifying the returned data in place is allowed and
+ * does not write to the file. The data must be owned through the returned sharing-info, which
+ * keeps the mapping alive.
+ *
+ * \param ptr_p: The stored (old) address, replaced by the mapped address on success.
+ * \return The sharing-info of the mapped data, or null when the data has to be read with the
+ * regular API (\a ptr_p is left unchanged then).
+ */
+const blender::ImplicitSharingInfo *BLO_read_mapped_data(BlendDataReader *reader,
+                                                         int64_t size_in_bytes,
+                                                         int64_t alignment,
+                                                         const void **ptr_p);
+
+/** Typed version of #BLO_read_mapped_data for plain data arrays. */
+template<typename T>
+const blender::ImplicitSharingInfo *BLO_read_mapped_array(BlendDataReader *reader,
+                                                          const int64_t array_size,
+                                                          T **ptr_p)
+{
+  static_assert(std::is_trivially_copyable_v<T>);
+  return BLO_read_mapped_data(
+      reader, int64_t(sizeof(T)) * array_size, int64_t(alignof(T)), (const void **)ptr_p);
+}
+
 int BLO_read_fileversion_get(BlendDataReader *reader);
 bool BLO_read_requires_endian_switch(BlendDataReader *reader);
 bool BLO_read_data_is_undo(BlendDataReader *reader);
@@ -3,6 +3,9 @@
  * SPDX-License-Identifier: GPL-2.0-or-later */
 #pragma once
 
+#include <string>
+
+#include "DNA_ID.h"
 #include "DNA_listBase.h"
 
 #include "BLI_compiler_attrs.h"
@@ -92,7 +95,7 @@ struct BlendFileReadWMSetupData {
 };
 
 struct BlendFileReadParams {
-  uint skip_flags : 3; /* #eBLOReadSkip */
+  uint skip_flags : 4; /* #eBLOReadSkip */
   uint is_startup : 1;
   uint is_factory_settings : 1;
 
@@ -100,19 +103,46 @@ struct BlendFileReadParams {
   int undo_direction; /* #eUndoStepDir */
 };
 
+/** Statistics about reading the IDs of one type, see #BlendFileReadReport.id_types. */
+struct BlendFileReadIDTypeStats {
+  int ids_num;
+  /** Size in the (uncompressed) file of the IDs and all their data. */
+  size_t bytes;
+  /** Time spent reading the IDs and their data (not including versioning and linking). */
+  double duration;
+};
+
 struct BlendFileReadReport {
   /** General reports handling. */
   ReportList *reports;
 
-  /** Timing information. */
+  /**
+   * Timing information.
+   *
+   * Phases are not exclusive, e.g. `libraries` includes the reading, versioning and linking of
+   * the library data, which is also counted in the corresponding phases.
+   */
   struct {
     double whole;
+    /** Opening the file, reading its header, its DNA and indexing BHeads. */
+    double open;
+    /** Reading IDs and their data, see #BlendFileReadReport.id_types for details. */
+    double read_data;
+    /** Running `do_versions` and `do_versions_after_linking` code. */
+    double versioning;
+    /** Resolving ID pointers (`lib_link`). */
+    double lib_link;
     double libraries;
     double lib_overrides;
     double lib_overrides_resync;
     double lib_overrides_recursive_resync;
+    /** Post-load processing like the first depsgraph build, set by the window-manager. */
+    double post_load;
   } duration;
 
+  /** Read statistics per ID type, indexed by #INDEX_ID_... values. */
+  BlendFileReadIDTypeStats id_types[INDEX_ID_MAX];
+
   /** Count information. */
   struct {
     /**
@@ -154,10 +184,28 @@ enum eBLOReadSkip {
   BLO_READ_SKIP_DATA = (1 << 1),
   /** Do not attempt to re-use IDs from old bmain for unchanged ones in case of undo. */
   BLO_READ_SKIP_UNDO_OLD_MAIN = (1 << 2),
+  /**
+   * Defer reading the large data arrays of geometry IDs (meshes, curves, point clouds...) until
+   * they are accessed, by referencing them in the memory-mapped file (see
+   * #BLO_read_mapped_data) even when they are fairly small. Only has an effect for uncompressed
+   * files, and is inherited by the libraries read from them.
+   */
+  BLO_READ_DEFER_GEOMETRY_DATA = (1 << 3),
 };
-ENUM_OPERATORS(eBLOReadSkip, BLO_READ_SKIP_UNDO_OLD_MAIN)
+ENUM_OPERATORS(eBLOReadSkip, BLO_READ_DEFER_GEOMETRY_DATA)
 #define BLO_READ_SKIP_ALL (BLO_READ_SKIP_USERDEF | BLO_READ_SKIP_DATA)
 
+/**
+ * Print the timing and size statistics gathered in \a reports to the log (#CLOG level 0 of the
+ * `blo.readfile` logger), so they show in `--debug` and `--log` output.
+ */
+void BLO_read_report_stats_log(const BlendFileReadReport *reports);
+/**
+ * Return the timing and size statistics gathered in \a reports as a JSON string, e.g.:
+ * `{"duration": {"whole": 1.2, ...}, "id_types": {"Mesh": {"count": 10, ...}, ...}}`.
+ */
+std::string BLO_read_report_stats_json(const BlendFileReadReport *reports);
+
 /**
  * Open a blender file from a `filepath`. The function returns NULL
  * and sets a report in the list if it cannot open the file.
@@ -33,6 +33,12 @@ struct MemFileChunk {
   const char *buf;
   /** Size in bytes. */
   size_t size;
+  /**
+   * When non-zero, #buf contains this many bytes of zstd compressed data, which decompress to
+   * #size bytes. Only chunks that own their memory and don't share it with another step are
+   * compressed, see #BLO_memfile_compress.
+   */
+  size_t compressed_size;
   /** When true, this chunk doesn't own the memory, it's shared with a previous #MemFileChunk */
   bool is_identical;
   /** When true, this chunk is also identical to the one in the next step (used by undo code to
@@ -52,6 +58,8 @@ struct MemFile {
    * without making a copy. This is faster and requires less memory.
    */
   MemFileSharedStorage *shared_storage;
+  /** Some chunks are compressed, see #BLO_memfile_compress. */
+  bool is_compressed;
 };
 
 struct MemFileWriteData {
@@ -107,6 +115,19 @@ void BLO_memfile_merge(MemFile *first, MemFile *second);
  * Clear is_identical_future before adding next memfile.
  */
 void BLO_memfile_clear_future(MemFile *memfile);
+/**
+ * Compress the chunks whose memory is only used by this memfile, to reduce the memory used by
+ * undo steps which are unlikely to be restored soon. #MemFile.size is updated accordingly.
+ *
+ * Must only be called once the next step has been written, since writing it may share more
+ * chunks of this memfile.
+ */
+void BLO_memfile_compress(MemFile *memfile);
+/**
+ * Decompress all chunks compressed by #BLO_memfile_compress. This is done automatically when the
+ * memfile is read or used as reference to write a new one.
+ */
+void BLO_memfile_decompress(MemFile *memfile);
 
 /* Utilities. */
 
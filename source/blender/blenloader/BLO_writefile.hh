@@ -56,6 +56,23 @@ extern bool BLO_write_file(Main *mainvar,
                            const BlendFileWriteParams *params,
                            ReportList *reports);
 
+/**
+ * Like #BLO_write_file, but only serializes \a mainvar before returning. Compressing and writing
+ * the data to \a filepath happens on a background thread, errors at that point are only logged.
+ * Saving versions (`.blend1` etc.) is not supported.
+ *
+ * \return Success of the serialization.
+ */
+extern bool BLO_write_file_deferred(Main *mainvar,
+                                    const char *filepath,
+                                    int write_flags,
+                                    const BlendFileWriteParams *params,
+                                    ReportList *reports);
+/**
+ * Wait for the file of the last #BLO_write_file_deferred call to be written.
+ */
+extern void BLO_write_file_deferred_wait();
+
 /**
  * \return Success.
  */
@@ -17,6 +17,7 @@
 #include "BLI_linklist.h"
 #include "BLI_path_utils.hh" /* Only for assertions. */
 #include "BLI_string.h"
+#include "BLI_time.h"
 #include "BLI_utildefines.h"
 
 #include "DNA_genfile.h"
@@ -306,7 +307,9 @@ BlendFileData *BLO_read_from_file(const char *filepath,
   BlendFileData *bfd = nullptr;
   FileData *fd;
 
+  const double time_open = BLI_time_now_seconds();
   fd = blo_filedata_from_file(filepath, reports);
+  reports->duration.open += BLI_time_now_seconds() - time_open;
   if (fd) {
     fd->skip_flags = skip_flags;
     bfd = blo_read_file_internal(fd, filepath);
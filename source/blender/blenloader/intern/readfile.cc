@@ -50,8 +50,10 @@
 #include "BLI_ghash.h"
 #include "BLI_map.hh"
 #include "BLI_memarena.h"
+#include "BLI_mmap.h"
 #include "BLI_string.h"
 #include "BLI_string_ref.hh"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_time.h"
 #include "BLI_utildefines.h"
@@ -173,9 +175,48 @@
 /** Use #GHash for restoring pointers by name. */
 #define USE_GHASH_RESTORE_POINTER
 
+/**
+ * Reference large plain data arrays directly in the memory-mapped file instead of copying them,
+ * see #BLO_read_mapped_data. Requires #USE_BHEAD_READ_ON_DEMAND.
+ */
+#define USE_MAPPED_DATA_READ
+
+/**
+ * Reconstruct the DNA of all data-blocks of a file in parallel before reading its IDs, only the
+ * linking of the decoded data (#direct_link_id, #OldNewMap insertion...) remains serial.
+ *
+ * \note This is disabled for undo (the memfile DNA always matches) and for files that need an
+ * endianness switch, since that one is done in-place in the #BHead data.
+ */
+#define USE_PARALLEL_BHEAD_DECODE
+
 static CLG_LogRef LOG = {"blo.readfile"};
 static CLG_LogRef LOG_UNDO = {"blo.readfile.undo"};
 
+/**
+ * Add the time spent in the current scope to a #BlendFileReadReport.duration phase, e.g.
+ * `ReadReportScopedDuration timer(fd->reports ? &fd->reports->duration.versioning : nullptr);`
+ */
+class ReadReportScopedDuration : blender::NonCopyable, blender::NonMovable {
+  double *duration_;
+  double time_start_;
+
+ public:
+  ReadReportScopedDuration(double *duration)
+      : duration_(duration), time_start_(duration ? BLI_time_now_seconds() : 0.0)
+  {
+  }
+  ~ReadReportScopedDuration()
+  {
+    if (duration_) {
+      *duration_ += BLI_time_now_seconds() - time_start_;
+    }
+  }
+};
+
+#define READ_REPORT_DURATION(fd, phase) \
+  ((fd)->reports ? &(fd)->reports->duration.phase : nullptr)
+
 #if ENDIAN_ORDER == B_ENDIAN
 #  warning "Support for Big Endian endianness is deprecated and will be removed in Blender 5.0"
 #endif
@@ -194,6 +235,13 @@ struct BHeadN {
   bool has_data;
 #endif
   bool is_memchunk_identical;
+#ifdef USE_PARALLEL_BHEAD_DECODE
+  /**
+   * Data decoded ahead of time by #read_file_bhead_decode_parallel, ownership is transferred to
+   * the first #read_struct call for this BHead.
+   */
+  void *decoded_data;
+#endif
   BHead bhead;
 };
 
@@ -254,11 +302,23 @@ struct OldNewMap {
   blender::Map<const void *, NewAddress> map;
 };
 
+/**
+ * The data map is cleared after reading each ID, keep its memory allocated to avoid growing it
+ * again for every ID, unless it became unusually large (clearing is linear in its capacity).
+ */
+#define OLDNEWMAP_KEEP_CAPACITY_MAX (1 << 14)
+
 static OldNewMap *oldnewmap_new()
 {
   return MEM_new<OldNewMap>(__func__);
 }
 
+/** Ensure \a onm can store \a n entries without being grown. */
+static void oldnewmap_reserve(OldNewMap *onm, const int64_t n)
+{
+  onm->map.reserve(n);
+}
+
 /**
  * \return `true` if the \a oldaddr key has been successfully added to the \a onm, and no existing
  * entry was overwritten.
@@ -297,6 +357,35 @@ static void *oldnewmap_lookup_and_inc(OldNewMap *onm, const void *addr, const bo
   return entry->newp;
 }
 
+/**
+ * Lookup all the \a addresses in place, unknown addresses are set to null.
+ */
+static void oldnewmap_lookup_and_inc_array(OldNewMap *onm,
+                                           const blender::MutableSpan<void *> addresses,
+                                           const bool increase_users)
+{
+  const void *prev_addr = nullptr;
+  NewAddress *prev_entry = nullptr;
+  for (const int64_t i : addresses.index_range()) {
+    const void *addr = addresses[i];
+    if (addr == nullptr) {
+      continue;
+    }
+    /* Arrays often reference the same data several times in a row. */
+    NewAddress *entry = (addr == prev_addr) ? prev_entry : onm->map.lookup_ptr(addr);
+    prev_addr = addr;
+    prev_entry = entry;
+    if (entry == nullptr) {
+      addresses[i] = nullptr;
+      continue;
+    }
+    if (increase_users) {
+      entry->nr++;
+    }
+    addresses[i] = entry->newp;
+  }
+}
+
 /* for libdata, NewAddress.nr has ID code, no increment */
 static void *oldnewmap_liblookup(OldNewMap *onm, const void *addr, const bool is_linked_only)
 {
@@ -322,7 +411,12 @@ static void oldnewmap_clear(OldNewMap *onm)
       MEM_freeN(new_addr.newp);
     }
   }
-  onm->map.clear();
+  if (onm->map.capacity() <= OLDNEWMAP_KEEP_CAPACITY_MAX) {
+    onm->map.clear_and_keep_capacity();
+  }
+  else {
+    onm->map.clear();
+  }
 }
 
 static void oldnewmap_free(OldNewMap *onm)
@@ -332,6 +426,75 @@ static void oldnewmap_free(OldNewMap *onm)
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Blend-File Memory Mapping
+ * \{ */
+
+#ifdef USE_MAPPED_DATA_READ
+
+/**
+ * Owns the memory mapping of a blend-file. It is shared by the #FileData reading it and by all
+ * arrays that reference the mapped memory directly.
+ */
+struct BlendFileMapping : public blender::ImplicitSharingMixin {
+  BLI_mmap_file *mmap_file;
+
+  BlendFileMapping(BLI_mmap_file *mmap_file) : mmap_file(mmap_file) {}
+
+ private:
+  void delete_self() override
+  {
+    BLI_mmap_free(mmap_file);
+    MEM_delete(this);
+  }
+};
+
+/**
+ * Sharing-info of a single array stored in a #BlendFileMapping. Each array gets its own
+ * sharing-info, so that the usual rules of implicit sharing apply: when the array has a single
+ * owner it is modified in place (the OS copies the touched pages since the mapping is private),
+ * otherwise it is copied into regular memory first.
+ */
+class MappedDataSharingInfo : public blender::ImplicitSharingInfo {
+ private:
+  const BlendFileMapping *mapping_;
+
+ public:
+  MappedDataSharingInfo(const BlendFileMapping &mapping) : mapping_(&mapping)
+  {
+    mapping_->add_user();
+  }
+
+ private:
+  void delete_self_with_data() override
+  {
+    if (mapping_) {
+      mapping_->remove_user_and_delete_if_last();
+    }
+    MEM_delete(this);
+  }
+
+  void delete_data_only() override
+  {
+    mapping_->remove_user_and_delete_if_last();
+    mapping_ = nullptr;
+  }
+};
+
+/**
+ * Data smaller than this is always copied, to avoid the overhead of many small sharing-infos.
+ */
+static constexpr int64_t MAPPED_DATA_MIN_SIZE = 16 * 1024;
+/**
+ * With #BLO_READ_DEFER_GEOMETRY_DATA, map everything that spans at least one memory page, so
+ * that arrays which are never accessed are not loaded from disk at all.
+ */
+static constexpr int64_t MAPPED_DATA_DEFER_MIN_SIZE = 4 * 1024;
+
+#endif /* USE_MAPPED_DATA_READ */
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name Helper Functions
  * \{ */
@@ -761,6 +924,9 @@ static BHeadN *get_bhead(FileData *fd)
           new_bhead->file_offset = fd->file->offset;
           new_bhead->has_data = false;
           new_bhead->is_memchunk_identical = false;
+#  ifdef USE_PARALLEL_BHEAD_DECODE
+          new_bhead->decoded_data = nullptr;
+#  endif
           new_bhead->bhead = bhead;
           const off64_t seek_new = fd->file->seek(fd->file, bhead.len, SEEK_CUR);
           if (UNLIKELY(seek_new == -1)) {
@@ -787,6 +953,9 @@ static BHeadN *get_bhead(FileData *fd)
           new_bhead->has_data = true;
 #endif
           new_bhead->is_memchunk_identical = false;
+#ifdef USE_PARALLEL_BHEAD_DECODE
+          new_bhead->decoded_data = nullptr;
+#endif
           new_bhead->bhead = bhead;
 
           readsize = fd->file->read(fd->file, new_bhead + 1, size_t(bhead.len));
@@ -905,6 +1074,9 @@ static BHead *blo_bhead_read_full(FileData *fd, BHead *thisblock)
   new_bhead_data->file_offset = new_bhead->file_offset;
   new_bhead_data->has_data = true;
   new_bhead_data->is_memchunk_identical = false;
+#  ifdef USE_PARALLEL_BHEAD_DECODE
+  new_bhead_data->decoded_data = nullptr;
+#  endif
   if (!blo_bhead_read_data(fd, thisblock, new_bhead_data + 1)) {
     MEM_freeN(new_bhead_data);
     return nullptr;
@@ -1243,6 +1415,7 @@ static FileData *blo_filedata_from_file_descriptor(const char *filepath,
   char header[7];
   FileReader *rawfile = BLI_filereader_new_file(filedes);
   FileReader *file = nullptr;
+  BlendFileMapping *mapping = nullptr;
 
   errno = 0;
   /* If opening the file failed or we can't read the header, give up. */
@@ -1267,7 +1440,16 @@ static FileData *blo_filedata_from_file_descriptor(const char *filepath,
   /* Check if we have a regular file. */
   if (memcmp(header, "BLENDER", sizeof(header)) == 0) {
     /* Try opening the file with memory-mapped IO. */
+#ifdef USE_MAPPED_DATA_READ
+    /* The mapping is copy-on-write and reference counted, so that large arrays can keep
+     * pointing into it after reading, see #BLO_read_mapped_data. */
+    if (BLI_mmap_file *mmap_file = BLI_mmap_open_copy_on_write(filedes)) {
+      mapping = MEM_new<BlendFileMapping>(__func__, mmap_file);
+      file = BLI_filereader_new_mmap_shared(mmap_file);
+    }
+#else
     file = BLI_filereader_new_mmap(filedes);
+#endif
     if (file == nullptr) {
       /* `mmap` failed, so just keep using `rawfile`. */
       file = rawfile;
@@ -1298,6 +1480,7 @@ static FileData *blo_filedata_from_file_descriptor(const char *filepath,
 
   FileData *fd = filedata_new(reports);
   fd->file = file;
+  fd->mapping = mapping;
 
   return fd;
 }
@@ -1398,6 +1581,13 @@ FileData *blo_filedata_from_memfile(MemFile *memfile,
 
 void blo_filedata_free(FileData *fd)
 {
+#ifdef USE_PARALLEL_BHEAD_DECODE
+  /* Decoded data of BHeads that were never read (e.g. because reading was aborted). */
+  LISTBASE_FOREACH (BHeadN *, new_bhead, &fd->bhead_list) {
+    MEM_SAFE_FREE(new_bhead->decoded_data);
+  }
+#endif
+
   /* Free all BHeadN data blocks */
 #ifdef NDEBUG
   BLI_freelistN(&fd->bhead_list);
@@ -1413,6 +1603,10 @@ void blo_filedata_free(FileData *fd)
   }
 #endif
   fd->file->close(fd->file);
+  if (fd->mapping) {
+    /* Arrays referencing the mapped memory may keep it alive. */
+    fd->mapping->remove_user_and_delete_if_last();
+  }
 
   if (fd->filesdna) {
     DNA_sdna_free(fd->filesdna);
@@ -1497,16 +1691,67 @@ short BLO_version_from_file(const char *filepath)
 /** \name Old/New Pointer Map
  * \{ */
 
+#ifdef USE_MAPPED_DATA_READ
+/**
+ * The data was kept in the file mapping as candidate for zero-copy reading, but it is accessed
+ * with the regular API: read it now.
+ */
+static void *datamap_read_mapped(FileData *fd, const void *adr, const bool increase_users)
+{
+  const std::optional<MappedDataBHead> mapped = fd->mapped_data_bheads.pop_try(adr);
+  if (!mapped) {
+    return nullptr;
+  }
+  void *data = read_struct(fd, mapped->bhead, mapped->blockname, mapped->id_type_index);
+  oldnewmap_insert(fd->datamap, adr, data, increase_users ? 1 : 0);
+  return data;
+}
+#endif
+
+static void *datamap_lookup(FileData *fd, const void *adr, const bool increase_users)
+{
+  void *data = oldnewmap_lookup_and_inc(fd->datamap, adr, increase_users);
+#ifdef USE_MAPPED_DATA_READ
+  if (data == nullptr && adr != nullptr && !fd->mapped_data_bheads.is_empty()) {
+    data = datamap_read_mapped(fd, adr, increase_users);
+  }
+#endif
+  return data;
+}
+
+static void datamap_lookup_array(FileData *fd,
+                                 const blender::MutableSpan<void *> addresses,
+                                 const bool increase_users)
+{
+#ifdef USE_MAPPED_DATA_READ
+  if (!fd->mapped_data_bheads.is_empty()) {
+    for (void *&address : addresses) {
+      address = datamap_lookup(fd, address, increase_users);
+    }
+    return;
+  }
+#endif
+  oldnewmap_lookup_and_inc_array(fd->datamap, addresses, increase_users);
+}
+
+static void datamap_clear(FileData *fd)
+{
+  oldnewmap_clear(fd->datamap);
+#ifdef USE_MAPPED_DATA_READ
+  fd->mapped_data_bheads.clear();
+#endif
+}
+
 /* Only direct data-blocks. */
 static void *newdataadr(FileData *fd, const void *adr)
 {
-  return oldnewmap_lookup_and_inc(fd->datamap, adr, true);
+  return datamap_lookup(fd, adr, true);
 }
 
 /* Only direct data-blocks. */
 static void *newdataadr_no_us(FileData *fd, const void *adr)
 {
-  return oldnewmap_lookup_and_inc(fd->datamap, adr, false);
+  return datamap_lookup(fd, adr, false);
 }
 
 void *blo_read_get_new_globaldata_address(FileData *fd, const void *adr)
@@ -1846,6 +2091,13 @@ static void *read_struct(FileData *fd, BHead *bh, const char *blockname, const i
   void *temp = nullptr;
 
   if (bh->len) {
+#ifdef USE_PARALLEL_BHEAD_DECODE
+    if (BHEADN_FROM_BHEAD(bh)->decoded_data) {
+      /* Already reconstructed by #read_file_bhead_decode_parallel. */
+      return std::exchange(BHEADN_FROM_BHEAD(bh)->decoded_data, nullptr);
+    }
+#endif
+
 #ifdef USE_BHEAD_READ_ON_DEMAND
     BHead *bh_orig = bh;
 #endif
@@ -1916,6 +2168,124 @@ static void *read_struct(FileData *fd, BHead *bh, const char *blockname, const i
   return temp;
 }
 
+#ifdef USE_PARALLEL_BHEAD_DECODE
+
+struct BHeadDecodeTask {
+  BHeadN *bheadn;
+  const char *alloc_name;
+  /** Raw file data read for BHeads that are read on demand, owned by the task. */
+  void *raw_data;
+};
+
+/**
+ * Below this amount of data to reconstruct, the overhead of the extra pass over all BHeads is
+ * not worth it.
+ */
+static constexpr int64_t BHEAD_DECODE_PARALLEL_MIN_SIZE = 1024 * 1024;
+
+/**
+ * Gather all ID and data BHeads that are going to be read by #read_libblock, and reconstruct them
+ * in parallel. Reading from the file itself remains serial, only the (CPU-bound) DNA
+ * reconstruction and copying is threaded.
+ *
+ * The results are stored in #BHeadN.decoded_data and picked up by #read_struct.
+ */
+static void read_file_bhead_decode_parallel(FileData *fd)
+{
+  using namespace blender;
+
+  if ((fd->flags & (FD_FLAGS_IS_MEMFILE | FD_FLAGS_SWITCH_ENDIAN)) ||
+      (fd->skip_flags & BLO_READ_SKIP_DATA) || BLI_system_thread_count() < 2)
+  {
+    return;
+  }
+
+  Vector<BHeadDecodeTask> tasks;
+  int64_t total_size = 0;
+  int id_type_index = INDEX_ID_NULL;
+  const char *blockname = nullptr;
+
+  for (BHead *bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
+    if (bhead->code == BLO_CODE_ENDB) {
+      break;
+    }
+    if (blo_bhead_is_id_valid_type(bhead)) {
+      id_type_index = BKE_idtype_idcode_to_index(bhead->code);
+      /* Must match the logic in #read_libblock. */
+#  ifndef NDEBUG
+      blockname = nullptr;
+#  else
+      blockname = get_alloc_name(fd, bhead, nullptr, id_type_index);
+#  endif
+    }
+    else if (bhead->code != BLO_CODE_DATA) {
+      /* Data of non-ID blocks (#BLO_CODE_USER, #BLO_CODE_GLOB...) is left to the regular
+       * reading code. */
+      id_type_index = INDEX_ID_NULL;
+      continue;
+    }
+    if (id_type_index == INDEX_ID_NULL) {
+      continue;
+    }
+    if (bhead->len == 0 || bhead->SDNAnr == SDNA_RAW_DATA_STRUCT_INDEX ||
+        fd->compflags[bhead->SDNAnr] == SDNA_CMP_REMOVED)
+    {
+      continue;
+    }
+
+    BHeadN *bheadn = BHEADN_FROM_BHEAD(bhead);
+    void *raw_data = nullptr;
+#  ifdef USE_BHEAD_READ_ON_DEMAND
+    if (!bheadn->has_data) {
+      if (fd->compflags[bhead->SDNAnr] == SDNA_CMP_EQUAL) {
+        /* Reading directly into the final memory in #read_struct is already optimal. */
+        continue;
+      }
+      raw_data = MEM_mallocN(size_t(bhead->len), __func__);
+      if (UNLIKELY(!blo_bhead_read_data(fd, bhead, raw_data))) {
+        /* Let #read_struct handle (and report) the error. */
+        MEM_freeN(raw_data);
+        continue;
+      }
+    }
+#  endif
+    const char *alloc_name = get_alloc_name(
+        fd, bhead, bhead->code == BLO_CODE_DATA ? blockname : nullptr, id_type_index);
+    tasks.append({bheadn, alloc_name, raw_data});
+    total_size += bhead->len;
+  }
+
+  if (total_size >= BHEAD_DECODE_PARALLEL_MIN_SIZE) {
+    threading::parallel_for(
+        tasks.index_range(),
+        256 * 1024,
+        [&](const IndexRange range) {
+          for (const BHeadDecodeTask &task : tasks.as_span().slice(range)) {
+            const BHead *bh = &task.bheadn->bhead;
+            const void *src = task.raw_data ? task.raw_data : static_cast<const void *>(bh + 1);
+            if (fd->compflags[bh->SDNAnr] == SDNA_CMP_NOT_EQUAL) {
+              task.bheadn->decoded_data = DNA_struct_reconstruct(
+                  fd->reconstruct_info, bh->SDNAnr, bh->nr, src, task.alloc_name);
+            }
+            else {
+              const int alignment = DNA_struct_alignment(fd->filesdna, bh->SDNAnr);
+              void *data = MEM_mallocN_aligned(bh->len, alignment, task.alloc_name);
+              memcpy(data, src, bh->len);
+              task.bheadn->decoded_data = data;
+            }
+          }
+        },
+        threading::individual_task_sizes(
+            [&](const int64_t i) { return int64_t(tasks[i].bheadn->bhead.len); }, total_size));
+  }
+
+  for (BHeadDecodeTask &task : tasks) {
+    MEM_SAFE_FREE(task.raw_data);
+  }
+}
+
+#endif /* USE_PARALLEL_BHEAD_DECODE */
+
 /* Like read_struct, but gets a pointer without allocating. Only works for
  * undo since DNA must match. */
 static const void *peek_struct_undo(FileData *fd, BHead *bhead)
@@ -2579,6 +2949,27 @@ static bool direct_link_id(FileData *fd,
   return success;
 }
 
+#ifdef USE_MAPPED_DATA_READ
+/**
+ * Whether the data of this BHead can be referenced directly in the file mapping, i.e. it does
+ * not need any conversion and it is not read in memory yet.
+ */
+static bool blo_bhead_is_mappable(const FileData *fd, const BHead *bhead)
+{
+  if (fd->mapping == nullptr || (fd->flags & FD_FLAGS_SWITCH_ENDIAN)) {
+    return false;
+  }
+  const int64_t min_size = (fd->skip_flags & BLO_READ_DEFER_GEOMETRY_DATA) ?
+                              MAPPED_DATA_DEFER_MIN_SIZE :
+                              MAPPED_DATA_MIN_SIZE;
+  if (bhead->len < min_size || BHEADN_FROM_BHEAD(bhead)->has_data) {
+    return false;
+  }
+  return bhead->SDNAnr == SDNA_RAW_DATA_STRUCT_INDEX ||
+         fd->compflags[bhead->SDNAnr] == SDNA_CMP_EQUAL;
+}
+#endif
+
 /* Read all data associated with a datablock into datamap. */
 static BHead *read_data_into_datamap(FileData *fd,
                                      BHead *bhead,
@@ -2587,7 +2978,23 @@ static BHead *read_data_into_datamap(FileData *fd,
 {
   bhead = blo_bhead_next(fd, bhead);
 
+  /* Size the map up front, IDs like meshes or node trees can have thousands of data blocks. */
+  int64_t data_bheads_num = 0;
+  for (BHead *data_bhead = bhead; data_bhead && data_bhead->code == BLO_CODE_DATA;
+       data_bhead = blo_bhead_next(fd, data_bhead))
+  {
+    data_bheads_num++;
+  }
+  oldnewmap_reserve(fd->datamap, data_bheads_num);
+
   while (bhead && bhead->code == BLO_CODE_DATA) {
+#ifdef USE_MAPPED_DATA_READ
+    if (id_type_index != INDEX_ID_NULL && blo_bhead_is_mappable(fd, bhead)) {
+      fd->mapped_data_bheads.add(bhead->old, {bhead, allocname, id_type_index});
+      bhead = blo_bhead_next(fd, bhead);
+      continue;
+    }
+#endif
     void *data = read_struct(fd, bhead, allocname, id_type_index);
     if (data) {
       const bool is_new = oldnewmap_insert(fd->datamap, bhead->old, data, 0);
@@ -2980,13 +3387,13 @@ static bool read_libblock_undo_restore(
  * When reading for undo, libraries, linked datablocks and unchanged datablocks
  * will be restored from the old database. Only new or changed datablocks will
  * actually be read. */
-static BHead *read_libblock(FileData *fd,
-                            Main *main,
-                            BHead *bhead,
-                            int id_tag,
-                            ID_Readfile_Data::Tags id_read_tags,
-                            const bool placeholder_set_indirect_extern,
-                            ID **r_id)
+static BHead *read_libblock_impl(FileData *fd,
+                                 Main *main,
+                                 BHead *bhead,
+                                 int id_tag,
+                                 ID_Readfile_Data::Tags id_read_tags,
+                                 const bool placeholder_set_indirect_extern,
+                                 ID **r_id)
 {
   const bool do_partial_undo = (fd->skip_flags & BLO_READ_SKIP_UNDO_OLD_MAIN) == 0;
 
@@ -3082,7 +3489,7 @@ static BHead *read_libblock(FileData *fd,
    * Use convenient malloc name for debugging and better memory link prints. */
   bhead = read_data_into_datamap(fd, bhead, blockname, id_type_index);
   const bool success = direct_link_id(fd, main, id_tag, id_read_tags, id, id_old);
-  oldnewmap_clear(fd->datamap);
+  datamap_clear(fd);
 
   if (!success) {
     /* XXX This is probably working OK currently given the very limited scope of that flag.
@@ -3110,6 +3517,39 @@ static BHead *read_libblock(FileData *fd,
   return bhead;
 }
 
+/** Same as #read_libblock_impl, also gathering the per ID type statistics of the read report. */
+static BHead *read_libblock(FileData *fd,
+                            Main *main,
+                            BHead *bhead,
+                            const int id_tag,
+                            const ID_Readfile_Data::Tags id_read_tags,
+                            const bool placeholder_set_indirect_extern,
+                            ID **r_id)
+{
+  const int id_type_index = BKE_idtype_idcode_to_index(bhead->code);
+  if (fd->reports == nullptr || id_type_index < 0 || id_type_index >= INDEX_ID_MAX) {
+    return read_libblock_impl(
+        fd, main, bhead, id_tag, id_read_tags, placeholder_set_indirect_extern, r_id);
+  }
+
+  const double time_start = BLI_time_now_seconds();
+  BHead *bhead_next = read_libblock_impl(
+      fd, main, bhead, id_tag, id_read_tags, placeholder_set_indirect_extern, r_id);
+  const double duration = BLI_time_now_seconds() - time_start;
+
+  BlendFileReadIDTypeStats &stats = fd->reports->id_types[id_type_index];
+  stats.ids_num++;
+  stats.duration += duration;
+  for (BHead *bhead_iter = bhead; bhead_iter && bhead_iter != bhead_next;
+       bhead_iter = blo_bhead_next(fd, bhead_iter))
+  {
+    stats.bytes += size_t(bhead_iter->len);
+  }
+  fd->reports->duration.read_data += duration;
+
+  return bhead_next;
+}
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -3126,7 +3566,7 @@ BHead *blo_read_asset_data_block(FileData *fd, BHead *bhead, AssetMetaData **r_a
   BLO_read_struct(&reader, AssetMetaData, r_asset_data);
   BKE_asset_metadata_read(&reader, *r_asset_data);
 
-  oldnewmap_clear(fd->datamap);
+  datamap_clear(fd);
 
   return bhead;
 }
@@ -3225,6 +3665,8 @@ static void do_versions_userdef(FileData * /*fd*/, BlendFileData *bfd)
 
 static void do_versions(FileData *fd, Library *lib, Main *main)
 {
+  ReadReportScopedDuration timer(READ_REPORT_DURATION(fd, versioning));
+
   /* WATCH IT!!!: pointers from libdata have not been converted */
 
   /* Don't allow versioning to create new data-blocks. */
@@ -3287,6 +3729,7 @@ static void do_versions(FileData *fd, Library *lib, Main *main)
 static void do_versions_after_linking(FileData *fd, Main *main)
 {
   BLI_assert(fd != nullptr);
+  ReadReportScopedDuration timer(READ_REPORT_DURATION(fd, versioning));
 
   CLOG_INFO(&LOG,
             2,
@@ -3360,6 +3803,7 @@ static int lib_link_cb(LibraryIDLinkCallbackData *cb_data)
 
 static void lib_link_all(FileData *fd, Main *bmain)
 {
+  ReadReportScopedDuration timer(READ_REPORT_DURATION(fd, lib_link));
   BlendLibReader reader = {fd, bmain};
 
   ID *id;
@@ -3566,7 +4010,7 @@ static BHead *read_userdef(BlendFileData *bfd, FileData *fd, BHead *bhead)
   user->edit_studio_light = 0;
 
   /* free fd->datamap again */
-  oldnewmap_clear(fd->datamap);
+  datamap_clear(fd);
 
   return bhead;
 }
@@ -3701,6 +4145,21 @@ BlendFileData *blo_read_file_internal(FileData *fd, const char *filepath)
     read_undo_reuse_noundo_local_ids(fd);
   }
 
+#ifdef USE_PARALLEL_BHEAD_DECODE
+  read_file_bhead_decode_parallel(fd);
+#endif
+
+  /* All IDs and linked placeholders are added to the lib-map, size it once. */
+  {
+    int64_t id_bheads_num = 0;
+    for (BHead *id_bhead = bhead; id_bhead; id_bhead = blo_bhead_next(fd, id_bhead)) {
+      if (blo_bhead_is_id(id_bhead) || id_bhead->code == ID_LINK_PLACEHOLDER) {
+        id_bheads_num++;
+      }
+    }
+    oldnewmap_reserve(fd->libmap, fd->libmap->map.size() + id_bheads_num);
+  }
+
   while (bhead) {
     switch (bhead->code) {
       case BLO_CODE_DATA:
@@ -4778,10 +5237,15 @@ static void read_library_clear_weak_links(FileData *basefd, ListBase *mainlist,
   }
 }
 
+/**
+ * \param preopened_fd: Result of opening the library file ahead of time, see
+ * #read_libraries_open_files_parallel. Can be null when opening failed.
+ */
 static FileData *read_library_file_data(FileData *basefd,
                                         ListBase *mainlist,
                                         Main *mainl,
-                                        Main *mainptr)
+                                        Main *mainptr,
+                                        const std::optional<FileData *> preopened_fd)
 {
   FileData *fd = mainptr->curlib->runtime->filedata;
 
@@ -4812,7 +5276,9 @@ static FileData *read_library_file_data(FileData *basefd,
                      mainptr->curlib->runtime->filepath_abs,
                      mainptr->curlib->filepath,
                      library_parent_filepath(mainptr->curlib));
-    fd = blo_filedata_from_file(mainptr->curlib->runtime->filepath_abs, basefd->reports);
+    fd = preopened_fd ? *preopened_fd :
+                        blo_filedata_from_file(mainptr->curlib->runtime->filepath_abs,
+                                               basefd->reports);
   }
 
   if (fd) {
@@ -4823,6 +5289,7 @@ static FileData *read_library_file_data(FileData *basefd,
     fd->mainlist = mainlist;
 
     fd->reports = basefd->reports;
+    fd->skip_flags |= basefd->skip_flags & BLO_READ_DEFER_GEOMETRY_DATA;
 
     if (fd->libmap) {
       oldnewmap_free(fd->libmap);
@@ -4835,7 +5302,9 @@ static FileData *read_library_file_data(FileData *basefd,
 
     /* subversion */
     read_file_version(fd, mainptr);
-    read_file_bhead_idname_map_create(fd);
+    if (!fd->bhead_idname_map) {
+      read_file_bhead_idname_map_create(fd);
+    }
   }
   else {
     mainptr->curlib->runtime->filedata = nullptr;
@@ -4856,6 +5325,49 @@ static FileData *read_library_file_data(FileData *basefd,
   return fd;
 }
 
+/**
+ * Open, decode and index the BHeads of all library files which are going to be read in the next
+ * pass of #read_libraries concurrently. This is mostly I/O bound, with many libraries on network
+ * storage the latency of opening them one after another would otherwise add up.
+ *
+ * Everything that touches the #Main data-bases or produces info reports remains serial in
+ * #read_library_file_data, so the result is the same as when opening the files one by one.
+ */
+static blender::Map<Main *, FileData *> read_libraries_open_files_parallel(FileData *basefd,
+                                                                           Main *mainl)
+{
+  blender::Vector<Main *> mains_to_open;
+  for (Main *mainptr = mainl->next; mainptr; mainptr = mainptr->next) {
+    if (mainptr->curlib->runtime->filedata == nullptr && mainptr->curlib->packedfile == nullptr &&
+        has_linked_ids_to_read(mainptr))
+    {
+      mains_to_open.append(mainptr);
+    }
+  }
+  if (mains_to_open.size() < 2) {
+    return {};
+  }
+
+  blender::Array<FileData *> fds(mains_to_open.size());
+  blender::threading::parallel_for(
+      mains_to_open.index_range(), 1, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          FileData *fd = blo_filedata_from_file(mains_to_open[i]->curlib->runtime->filepath_abs,
+                                                basefd->reports);
+          if (fd) {
+            read_file_bhead_idname_map_create(fd);
+          }
+          fds[i] = fd;
+        }
+      });
+
+  blender::Map<Main *, FileData *> opened_fds;
+  for (const int64_t i : mains_to_open.index_range()) {
+    opened_fds.add_new(mains_to_open[i], fds[i]);
+  }
+  return opened_fds;
+}
+
 static void read_libraries(FileData *basefd, ListBase *mainlist)
 {
   Main *mainl = static_cast<Main *>(mainlist->first);
@@ -4871,6 +5383,9 @@ static void read_libraries(FileData *basefd, ListBase *mainlist)
   while (do_it) {
     do_it = false;
 
+    blender::Map<Main *, FileData *> preopened_fds = read_libraries_open_files_parallel(basefd,
+                                                                                      mainl);
+
     /* Loop over mains of all library blend files encountered so far. Note
      * this list gets longer as more indirectly library blends are found. */
     for (Main *mainptr = mainl->next; mainptr; mainptr = mainptr->next) {
@@ -4883,7 +5398,8 @@ static void read_libraries(FileData *basefd, ListBase *mainlist)
                   mainptr->curlib->filepath);
 
         /* Open file if it has not been done yet. */
-        FileData *fd = read_library_file_data(basefd, mainlist, mainl, mainptr);
+        FileData *fd = read_library_file_data(
+            basefd, mainlist, mainl, mainptr, preopened_fds.pop_try(mainptr));
 
         if (fd) {
           do_it = true;
@@ -4902,6 +5418,14 @@ static void read_libraries(FileData *basefd, ListBase *mainlist)
         BLO_expand_main(fd, mainptr, expand_doit_library);
       }
     }
+
+    /* All pre-opened files are expected to be used, but don't leak them in case reading a
+     * library made another one not needed anymore. */
+    for (FileData *fd : preopened_fds.values()) {
+      if (fd) {
+        blo_filedata_free(fd);
+      }
+    }
   }
 
   for (Main *mainptr = mainl->next; mainptr; mainptr = mainptr->next) {
@@ -4986,6 +5510,25 @@ void *BLO_read_struct_array_with_size(BlendDataReader *reader,
   return blo_verify_data_address(new_address, old_address, expected_size);
 }
 
+void BLO_read_struct_pointer_array_items_with_size(BlendDataReader *reader,
+                                                   const int64_t array_size,
+                                                   void **array,
+                                                   const size_t expected_size)
+{
+  if (array == nullptr || array_size <= 0) {
+    return;
+  }
+  const blender::MutableSpan<void *> addresses(array, array_size);
+  datamap_lookup_array(reader->fd, addresses, true);
+#ifndef NDEBUG
+  for (void *new_address : addresses) {
+    blo_verify_data_address(new_address, nullptr, expected_size);
+  }
+#else
+  UNUSED_VARS(expected_size);
+#endif
+}
+
 void *BLO_read_struct_by_name_array(BlendDataReader *reader,
                                     const char *struct_name,
                                     const int64_t items_num,
@@ -5258,6 +5801,32 @@ blender::ImplicitSharingInfoAndData blo_read_shared_impl(
   return shared_data;
 }
 
+const blender::ImplicitSharingInfo *BLO_read_mapped_data(BlendDataReader *reader,
+                                                         const int64_t size_in_bytes,
+                                                         const int64_t alignment,
+                                                         const void **ptr_p)
+{
+#ifdef USE_MAPPED_DATA_READ
+  FileData *fd = reader->fd;
+  const MappedDataBHead *mapped = fd->mapped_data_bheads.lookup_ptr(*ptr_p);
+  if (mapped == nullptr || mapped->bhead->len < size_in_bytes) {
+    return nullptr;
+  }
+  const BHeadN *bheadn = BHEADN_FROM_BHEAD(mapped->bhead);
+  const void *data = POINTER_OFFSET(BLI_mmap_get_pointer(fd->mapping->mmap_file),
+                                    bheadn->file_offset);
+  if (uintptr_t(data) % uintptr_t(alignment) != 0) {
+    return nullptr;
+  }
+  fd->mapped_data_bheads.remove(*ptr_p);
+  *ptr_p = data;
+  return MEM_new<MappedDataSharingInfo>(__func__, *fd->mapping);
+#else
+  UNUSED_VARS(reader, size_in_bytes, alignment, ptr_p);
+  return nullptr;
+#endif
+}
+
 bool BLO_read_data_is_undo(BlendDataReader *reader)
 {
   return (reader->fd->flags & FD_FLAGS_IS_MEMFILE);
@@ -5294,3 +5863,76 @@ BlendFileReadReport *BLO_read_lib_reports(BlendLibReader *reader)
 }
 
 /** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name Read Report Statistics
+ * \{ */
+
+void BLO_read_report_stats_log(const BlendFileReadReport *reports)
+{
+  CLOG_INFO(&LOG,
+            0,
+            "Read phases: open %.3fs, read data %.3fs, versioning %.3fs, lib-link %.3fs, "
+            "libraries %.3fs, overrides %.3fs, resync %.3fs, post-load %.3fs",
+            reports->duration.open,
+            reports->duration.read_data,
+            reports->duration.versioning,
+            reports->duration.lib_link,
+            reports->duration.libraries,
+            reports->duration.lib_overrides,
+            reports->duration.lib_overrides_resync,
+            reports->duration.post_load);
+  for (int i = 0; i < INDEX_ID_MAX; i++) {
+    const BlendFileReadIDTypeStats &stats = reports->id_types[i];
+    if (stats.ids_num == 0) {
+      continue;
+    }
+    CLOG_INFO(&LOG,
+              0,
+              " * %s: %d IDs, %.2f MiB, %.3fs",
+              BKE_idtype_idcode_to_name_plural(BKE_idtype_index_to_idcode(i)),
+              stats.ids_num,
+              double(stats.bytes) / (1024.0 * 1024.0),
+              stats.duration);
+  }
+}
+
+std::string BLO_read_report_stats_json(const BlendFileReadReport *reports)
+{
+  fmt::memory_buffer buf;
+  fmt::format_to(fmt::appender(buf),
+                 "{{\"duration\": {{\"whole\": {}, \"open\": {}, \"read_data\": {}, "
+                 "\"versioning\": {}, \"lib_link\": {}, \"libraries\": {}, "
+                 "\"lib_overrides\": {}, \"lib_overrides_resync\": {}, "
+                 "\"lib_overrides_recursive_resync\": {}, \"post_load\": {}}}, "
+                 "\"id_types\": {{",
+                 reports->duration.whole,
+                 reports->duration.open,
+                 reports->duration.read_data,
+                 reports->duration.versioning,
+                 reports->duration.lib_link,
+                 reports->duration.libraries,
+                 reports->duration.lib_overrides,
+                 reports->duration.lib_overrides_resync,
+                 reports->duration.lib_overrides_recursive_resync,
+                 reports->duration.post_load);
+  bool is_first = true;
+  for (int i = 0; i < INDEX_ID_MAX; i++) {
+    const BlendFileReadIDTypeStats &stats = reports->id_types[i];
+    if (stats.ids_num == 0) {
+      continue;
+    }
+    fmt::format_to(fmt::appender(buf),
+                   "{}\"{}\": {{\"count\": {}, \"bytes\": {}, \"duration\": {}}}",
+                   is_first ? "" : ", ",
+                   BKE_idtype_idcode_to_name(BKE_idtype_index_to_idcode(i)),
+                   stats.ids_num,
+                   stats.bytes,
+                   stats.duration);
+    is_first = false;
+  }
+  fmt::format_to(fmt::appender(buf), "}}}}");
+  return fmt::to_string(buf);
+}
+
+/** \} */
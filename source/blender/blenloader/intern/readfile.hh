@@ -30,6 +30,7 @@ struct BlendFileReadParams;
 struct BlendFileReadReport;
 struct BLOCacheStorage;
 struct BHeadSort;
+struct BlendFileMapping;
 struct DNA_ReconstructInfo;
 struct IDNameLib_Map;
 struct Key;
@@ -53,6 +54,16 @@ enum eFileDataFlag {
 };
 ENUM_OPERATORS(eFileDataFlag, FD_FLAGS_IS_MEMFILE)
 
+/**
+ * A data-block that was not read into the #FileData.datamap yet, because it may be referenced
+ * directly in the memory-mapped file instead, see #BLO_read_mapped_data.
+ */
+struct MappedDataBHead {
+  BHead *bhead;
+  const char *blockname;
+  int id_type_index;
+};
+
 /* Disallow since it's 32bit on ms-windows. */
 #ifdef __GNUC__
 #  pragma GCC poison off_t
@@ -71,6 +82,12 @@ struct FileData {
   bool is_eof = false;
 
   FileReader *file = nullptr;
+  /**
+   * Reference counted copy-on-write mapping of the whole file, when reading an uncompressed
+   * blend-file from disk. Data referenced directly in the mapping keeps it alive after the
+   * #FileData is freed.
+   */
+  BlendFileMapping *mapping = nullptr;
 
   /**
    * Whether we are undoing (< 0) or redoing (> 0), used to choose which 'unchanged' flag to use
@@ -117,6 +134,12 @@ struct FileData {
   int id_tag_extra = 0;
 
   OldNewMap *datamap = nullptr;
+  /**
+   * Large data-blocks of the ID currently being read which are candidates for zero-copy reading.
+   * They are moved to #datamap (i.e. read regularly) as soon as they are accessed through any
+   * other API than #BLO_read_mapped_data.
+   */
+  blender::Map<const void *, MappedDataBHead> mapped_data_bheads;
   OldNewMap *globmap = nullptr;
 
   /**
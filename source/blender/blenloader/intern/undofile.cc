@@ -24,6 +24,8 @@
 #include "DNA_listBase.h"
 
 #include "BLI_implicit_sharing.hh"
+#include "BLI_task.hh"
+#include "BLI_vector.hh"
 
 #include "BLO_readfile.hh"
 #include "BLO_undofile.hh"
@@ -32,8 +34,15 @@
 #include "BKE_main.hh"
 #include "BKE_undo_system.hh"
 
+#include <zstd.h>
+
 #include "BLI_strict_flags.h" /* IWYU pragma: keep. Keep last. */
 
+/** Smaller chunks are not worth compressing. */
+#define MEMFILE_COMPRESS_MIN_SIZE 4096
+/** Fast level, compression happens while the user is interacting. */
+#define MEMFILE_COMPRESS_LEVEL 1
+
 /* **************** support for memory-write, for undo buffers *************** */
 
 void BLO_memfile_free(MemFile *memfile)
@@ -47,6 +56,7 @@ void BLO_memfile_free(MemFile *memfile)
   MEM_delete(memfile->shared_storage);
   memfile->shared_storage = nullptr;
   memfile->size = 0;
+  memfile->is_compressed = false;
 }
 
 MemFileSharedStorage::~MemFileSharedStorage()
@@ -95,10 +105,87 @@ void BLO_memfile_clear_future(MemFile *memfile)
   }
 }
 
+void BLO_memfile_compress(MemFile *memfile)
+{
+  blender::Vector<MemFileChunk *> chunks;
+  LISTBASE_FOREACH (MemFileChunk *, chunk, &memfile->chunks) {
+    /* Chunks shared with the previous step (`is_identical`) or with the next one
+     * (`is_identical_future`) have to stay readable as-is by the other steps. */
+    if (!chunk->is_identical && !chunk->is_identical_future && chunk->compressed_size == 0 &&
+        chunk->size >= MEMFILE_COMPRESS_MIN_SIZE)
+    {
+      chunks.append(chunk);
+    }
+  }
+  if (chunks.is_empty()) {
+    return;
+  }
+
+  blender::threading::parallel_for(chunks.index_range(), 8, [&](const blender::IndexRange range) {
+    for (MemFileChunk *chunk : chunks.as_mutable_span().slice(range)) {
+      const size_t bound = ZSTD_compressBound(chunk->size);
+      char *compressed = static_cast<char *>(MEM_mallocN(bound, "Chunk buffer compressed"));
+      const size_t compressed_size = ZSTD_compress(
+          compressed, bound, chunk->buf, chunk->size, MEMFILE_COMPRESS_LEVEL);
+      /* Only keep the compressed data when it is significantly smaller. */
+      if (ZSTD_isError(compressed_size) || compressed_size > chunk->size / 4 * 3) {
+        MEM_freeN(compressed);
+        continue;
+      }
+      MEM_freeN(const_cast<char *>(chunk->buf));
+      chunk->buf = static_cast<char *>(MEM_reallocN(compressed, compressed_size));
+      chunk->compressed_size = compressed_size;
+    }
+  });
+
+  for (const MemFileChunk *chunk : chunks) {
+    if (chunk->compressed_size != 0) {
+      memfile->size -= chunk->size - chunk->compressed_size;
+      memfile->is_compressed = true;
+    }
+  }
+}
+
+void BLO_memfile_decompress(MemFile *memfile)
+{
+  if (!memfile->is_compressed) {
+    return;
+  }
+
+  blender::Vector<MemFileChunk *> chunks;
+  LISTBASE_FOREACH (MemFileChunk *, chunk, &memfile->chunks) {
+    if (chunk->compressed_size != 0) {
+      chunks.append(chunk);
+    }
+  }
+
+  blender::threading::parallel_for(chunks.index_range(), 8, [&](const blender::IndexRange range) {
+    for (MemFileChunk *chunk : chunks.as_mutable_span().slice(range)) {
+      char *buf = static_cast<char *>(MEM_mallocN(chunk->size, "Chunk buffer"));
+      const size_t size = ZSTD_decompress(buf, chunk->size, chunk->buf, chunk->compressed_size);
+      BLI_assert(size == chunk->size);
+      UNUSED_VARS_NDEBUG(size);
+      MEM_freeN(const_cast<char *>(chunk->buf));
+      chunk->buf = buf;
+    }
+  });
+
+  for (MemFileChunk *chunk : chunks) {
+    memfile->size += chunk->size - chunk->compressed_size;
+    chunk->compressed_size = 0;
+  }
+  memfile->is_compressed = false;
+}
+
 void BLO_memfile_write_init(MemFileWriteData *mem_data,
                             MemFile *written_memfile,
                             MemFile *reference_memfile)
 {
+  if (reference_memfile != nullptr) {
+    /* Chunks are compared with the reference ones. */
+    BLO_memfile_decompress(reference_memfile);
+  }
+
   mem_data->written_memfile = written_memfile;
   mem_data->reference_memfile = reference_memfile;
   mem_data->reference_current_chunk = reference_memfile ? static_cast<MemFileChunk *>(
@@ -133,6 +220,7 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
 
   MemFileChunk *curchunk = MEM_mallocN<MemFileChunk>("MemFileChunk");
   curchunk->size = size;
+  curchunk->compressed_size = 0;
   curchunk->buf = nullptr;
   curchunk->is_identical = false;
   /* This is unsafe in the sense that an app handler or other code that does not
@@ -267,6 +355,8 @@ FileReader *BLO_memfile_new_filereader(MemFile *memfile, int undo_direction)
 {
   UndoReader *undo = MEM_callocN<UndoReader>(__func__);
 
+  BLO_memfile_decompress(memfile);
+
   undo->memfile = memfile;
   undo->undo_direction = undo_direction;
 
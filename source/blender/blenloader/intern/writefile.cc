@@ -64,6 +64,11 @@
 #include <cstdlib>
 #include <cstring>
 #include <fcntl.h>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #ifdef WIN32
 #  include "BLI_winstuff.h"
@@ -89,6 +94,7 @@
 #include "DNA_sdna_types.h"
 #include "DNA_userdef_types.h"
 
+#include "BLI_array.hh"
 #include "BLI_endian_defines.h"
 #include "BLI_fileops.hh"
 #include "BLI_implicit_sharing.hh"
@@ -97,7 +103,9 @@
 #include "BLI_path_utils.hh"
 #include "BLI_set.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
+#include "BLI_time.h"
 
 #include "MEM_guardedalloc.h" /* MEM_freeN */
 
@@ -131,6 +139,7 @@
 
 #include "readfile.hh"
 
+#include <xxhash.h>
 #include <zstd.h>
 
 /* Make preferences read-only. */
@@ -154,11 +163,26 @@
 
 #define ZSTD_COMPRESSION_LEVEL 3
 
+/**
+ * IDs with at least this much serialized data are written in their own zstd frames, which can be
+ * copied as-is from the previous file on the next save when the ID did not change.
+ */
+#define ZSTD_REUSE_ID_MIN_SIZE (1 << 18) /* 256kb */
+
 static CLG_LogRef LOG = {"blo.writefile"};
 
 /** Use if we want to store how many bytes have been written to the file. */
 // #define USE_WRITE_DATA_LEN
 
+/**
+ * Serialize local IDs into separate buffers on worker threads when writing to a file (not undo),
+ * the buffers are then written in the original order so the resulting file is identical.
+ */
+#define USE_PARALLEL_ID_WRITE
+
+/** Number of IDs serialized at once, limits the memory used by pending ID buffers. */
+#define PARALLEL_ID_WRITE_BATCH_SIZE 64
+
 /* -------------------------------------------------------------------- */
 /** \name Internal Write Wrapper's (Abstracts Compression)
  * \{ */
@@ -168,6 +192,8 @@ struct ZstdFrame {
 
   uint32_t compressed_size;
   uint32_t uncompressed_size;
+  /** Offset of the frame in the written file. */
+  uint64_t file_offset;
 };
 
 class WriteWrap {
@@ -175,9 +201,22 @@ class WriteWrap {
   virtual bool open(const char *filepath) = 0;
   virtual bool close() = 0;
   virtual bool write(const void *buf, size_t buf_len) = 0;
+  /**
+   * Write all the data of a single ID. Wrappers may store it in a way that allows reusing it when
+   * saving the same file again, see #ZstdWriteWrap.
+   */
+  virtual bool write_id_data(uint /*id_session_uid*/, const void *buf, size_t buf_len)
+  {
+    return write(buf, buf_len);
+  }
 
   /** Buffer output (we only want when output isn't already buffered). */
   bool use_buf = true;
+  /**
+   * The data is not written to the file by #close but later on, so there is no temporary file
+   * to move in place, see #MemoryWriteWrap.
+   */
+  bool is_deferred = false;
 };
 
 class RawWriteWrap : public WriteWrap {
@@ -212,9 +251,134 @@ bool RawWriteWrap::write(const void *buf, size_t buf_len)
   return ::write(file_handle, buf, buf_len) == buf_len;
 }
 
+/**
+ * Keeps all written data in memory, so that it can be compressed and written to the actual file
+ * later on a background thread, see #BLO_write_file_deferred.
+ */
+class MemoryWriteWrap : public WriteWrap {
+  struct Chunk {
+    void *data;
+    size_t size;
+    /** Chunks written with #write_id_data, passed on the same way for frame reuse. */
+    bool is_id_data;
+    uint id_session_uid;
+  };
+  blender::Vector<Chunk> chunks_;
+
+ public:
+  MemoryWriteWrap()
+  {
+    is_deferred = true;
+  }
+  ~MemoryWriteWrap()
+  {
+    for (const Chunk &chunk : chunks_) {
+      MEM_freeN(chunk.data);
+    }
+  }
+
+  bool open(const char * /*filepath*/) override
+  {
+    return true;
+  }
+  bool close() override
+  {
+    return true;
+  }
+  bool write(const void *buf, const size_t buf_len) override
+  {
+    return this->add_chunk(buf, buf_len, false, 0);
+  }
+  bool write_id_data(const uint id_session_uid, const void *buf, const size_t buf_len) override
+  {
+    return this->add_chunk(buf, buf_len, true, id_session_uid);
+  }
+
+  /** Write all stored data to \a ww, freeing it along the way. */
+  bool flush(WriteWrap &ww)
+  {
+    bool success = true;
+    for (Chunk &chunk : chunks_) {
+      if (success) {
+        success = chunk.is_id_data ?
+                      ww.write_id_data(chunk.id_session_uid, chunk.data, chunk.size) :
+                      ww.write(chunk.data, chunk.size);
+      }
+      MEM_freeN(chunk.data);
+    }
+    chunks_.clear();
+    return success;
+  }
+
+ private:
+  bool add_chunk(const void *buf, const size_t buf_len, const bool is_id_data, const uint uid)
+  {
+    void *data = MEM_mallocN(buf_len, __func__);
+    memcpy(data, buf, buf_len);
+    chunks_.append({data, buf_len, is_id_data, uid});
+    return true;
+  }
+};
+
+/**
+ * Compressed frames of an ID written by the last compressed save of a file.
+ */
+struct ZstdReuseIDFrames {
+  /** Hash and size of the uncompressed ID data stored in the frames. */
+  uint64_t hash;
+  size_t uncompressed_size;
+  /** Index of the first frame of the ID and number of frames, in the writing order. */
+  int first_frame;
+  int num_frames;
+  /** Offset of the first frame in the file and total compressed size of all frames. */
+  uint64_t file_offset = 0;
+  size_t compressed_size = 0;
+  /** Compressed and uncompressed size of each frame, needed for the seek table. */
+  std::vector<std::pair<uint32_t, uint32_t>> frame_sizes;
+};
+
+/**
+ * Layout of the IDs in the last compressed save of a file, used to copy the frames of unchanged
+ * IDs directly from that file instead of compressing them again.
+ *
+ * The file size and modification time allow to detect when the file was modified externally.
+ */
+struct ZstdReuseCache {
+  int64_t file_size = 0;
+  int64_t file_mtime = 0;
+  std::unordered_map<uint, ZstdReuseIDFrames> ids;
+};
+
+/** Keep the layout of a few files, so that e.g. auto-save does not discard the regular one. */
+#define ZSTD_REUSE_CACHE_MAX_FILES 4
+
+static std::mutex zstd_reuse_caches_mutex;
+static std::unordered_map<std::string, ZstdReuseCache> zstd_reuse_caches;
+
+static bool zstd_reuse_file_stat(const char *filepath, int64_t *r_size, int64_t *r_mtime)
+{
+  BLI_stat_t st;
+  if (BLI_stat(filepath, &st) != 0) {
+    return false;
+  }
+  *r_size = int64_t(st.st_size);
+  *r_mtime = int64_t(st.st_mtime);
+  return true;
+}
+
 class ZstdWriteWrap : public WriteWrap {
   WriteWrap &base_wrap;
 
+  /** Layout of the previous save of the same file, see #reuse_begin. */
+  ZstdReuseCache reuse_prev;
+  /** File handle of the previous save to copy unchanged frames from, -1 when not reusing. */
+  int reuse_prev_file = -1;
+  /** IDs written in their own frames by this save. */
+  std::unordered_map<uint, ZstdReuseIDFrames> reuse_ids;
+  bool use_reuse = false;
+  /** Number of bytes written to the base wrapper so far. */
+  uint64_t written_len = 0;
+
   ListBase threadpool = {};
   ListBase tasks = {};
   ThreadMutex mutex = {};
@@ -232,10 +396,24 @@ class ZstdWriteWrap : public WriteWrap {
   bool open(const char *filepath) override;
   bool close() override;
   bool write(const void *buf, size_t buf_len) override;
+  bool write_id_data(uint id_session_uid, const void *buf, size_t buf_len) override;
+
+  /**
+   * Enable reusing compressed frames of unchanged IDs from the previous save of \a filepath.
+   * Must be called before #open.
+   */
+  void reuse_begin(const char *filepath);
+  /**
+   * Store the frames layout of this save for the next save of \a filepath.
+   * Must be called after #close, once the file was successfully written to \a filepath.
+   */
+  void reuse_end(const char *filepath);
 
  private:
   struct ZstdWriteBlockTask;
   void write_task(ZstdWriteBlockTask *task);
+  void submit_task(ZstdWriteBlockTask *task);
+  bool write_id_data_reused(const ZstdReuseIDFrames &prev_frames);
   void write_u32_le(uint32_t val);
   void write_seekable_frames();
 };
@@ -244,6 +422,8 @@ struct ZstdWriteWrap::ZstdWriteBlockTask {
   ZstdWriteBlockTask *next, *prev;
   void *data;
   size_t size;
+  /** When non-zero, #data is an already compressed frame of that uncompressed size. */
+  size_t uncompressed_size;
   int frame_number;
   ZstdWriteWrap *ww;
 
@@ -257,12 +437,22 @@ struct ZstdWriteWrap::ZstdWriteBlockTask {
 
 void ZstdWriteWrap::write_task(ZstdWriteBlockTask *task)
 {
-  size_t out_buf_len = ZSTD_compressBound(task->size);
-  void *out_buf = MEM_mallocN(out_buf_len, "Zstd out buffer");
-  size_t out_size = ZSTD_compress(
-      out_buf, out_buf_len, task->data, task->size, ZSTD_COMPRESSION_LEVEL);
+  void *out_buf;
+  size_t out_size;
+  size_t uncompressed_size;
+  if (task->uncompressed_size != 0) {
+    out_buf = task->data;
+    out_size = task->size;
+    uncompressed_size = task->uncompressed_size;
+  }
+  else {
+    size_t out_buf_len = ZSTD_compressBound(task->size);
+    out_buf = MEM_mallocN(out_buf_len, "Zstd out buffer");
+    out_size = ZSTD_compress(out_buf, out_buf_len, task->data, task->size, ZSTD_COMPRESSION_LEVEL);
+    uncompressed_size = task->size;
 
-  MEM_freeN(task->data);
+    MEM_freeN(task->data);
+  }
 
   BLI_mutex_lock(&mutex);
 
@@ -276,9 +466,11 @@ void ZstdWriteWrap::write_task(ZstdWriteBlockTask *task)
   else {
     if (base_wrap.write(out_buf, out_size)) {
       ZstdFrame *frameinfo = MEM_mallocN<ZstdFrame>("zstd frameinfo");
-      frameinfo->uncompressed_size = task->size;
+      frameinfo->uncompressed_size = uncompressed_size;
       frameinfo->compressed_size = out_size;
+      frameinfo->file_offset = written_len;
       BLI_addtail(&frames, frameinfo);
+      written_len += out_size;
     }
     else {
       write_error = true;
@@ -357,6 +549,33 @@ bool ZstdWriteWrap::close()
   BLI_mutex_end(&mutex);
   BLI_condition_end(&condition);
 
+  if (reuse_prev_file != -1) {
+    ::close(reuse_prev_file);
+    reuse_prev_file = -1;
+  }
+
+  /* Resolve the file range of the IDs written in their own frames. */
+  if (use_reuse && !write_error) {
+    blender::Vector<const ZstdFrame *> frames_by_number;
+    LISTBASE_FOREACH (const ZstdFrame *, frame, &frames) {
+      frames_by_number.append(frame);
+    }
+    for (auto &item : reuse_ids) {
+      ZstdReuseIDFrames &id_frames = item.second;
+      if (id_frames.first_frame + id_frames.num_frames > frames_by_number.size()) {
+        /* Should not happen without a write error. */
+        write_error = true;
+        break;
+      }
+      id_frames.file_offset = frames_by_number[id_frames.first_frame]->file_offset;
+      for (int i = 0; i < id_frames.num_frames; i++) {
+        const ZstdFrame *frame = frames_by_number[id_frames.first_frame + i];
+        id_frames.compressed_size += frame->compressed_size;
+        id_frames.frame_sizes.emplace_back(frame->compressed_size, frame->uncompressed_size);
+      }
+    }
+  }
+
   write_seekable_frames();
   BLI_freelistN(&frames);
 
@@ -373,9 +592,17 @@ bool ZstdWriteWrap::write(const void *buf, const size_t buf_len)
   task->data = MEM_mallocN(buf_len, __func__);
   memcpy(task->data, buf, buf_len);
   task->size = buf_len;
+  task->uncompressed_size = 0;
   task->frame_number = num_frames++;
   task->ww = this;
 
+  submit_task(task);
+
+  return true;
+}
+
+void ZstdWriteWrap::submit_task(ZstdWriteBlockTask *task)
+{
   BLI_mutex_lock(&mutex);
   BLI_addtail(&tasks, task);
 
@@ -395,10 +622,134 @@ bool ZstdWriteWrap::write(const void *buf, const size_t buf_len)
     MEM_freeN(first_task);
   }
   BLI_threadpool_insert(&threadpool, task);
+}
+
+bool ZstdWriteWrap::write_id_data(const uint id_session_uid, const void *buf, size_t buf_len)
+{
+  if (!use_reuse || buf_len < ZSTD_REUSE_ID_MIN_SIZE) {
+    return write(buf, buf_len);
+  }
+  if (write_error) {
+    return false;
+  }
+
+  ZstdReuseIDFrames id_frames;
+  id_frames.hash = XXH3_64bits(buf, buf_len);
+  id_frames.uncompressed_size = buf_len;
+  id_frames.first_frame = num_frames;
+
+  /* An ID that is not known in the previous file, e.g. because it was added since, or the file
+   * was re-loaded (which changes session UIDs), is simply written in new frames. */
+  const auto prev_item = reuse_prev.ids.find(id_session_uid);
+  const bool is_unchanged = prev_item != reuse_prev.ids.end() &&
+                            prev_item->second.hash == id_frames.hash &&
+                            prev_item->second.uncompressed_size == buf_len;
+
+  if (!is_unchanged || !write_id_data_reused(prev_item->second)) {
+    /* Split in frames of the same size as the regular buffered writing. */
+    const char *data = static_cast<const char *>(buf);
+    do {
+      const size_t frame_len = std::min<size_t>(buf_len, ZSTD_CHUNK_SIZE);
+      if (!write(data, frame_len)) {
+        return false;
+      }
+      data += frame_len;
+      buf_len -= frame_len;
+    } while (buf_len > 0);
+  }
+
+  id_frames.num_frames = num_frames - id_frames.first_frame;
+  reuse_ids.insert_or_assign(id_session_uid, std::move(id_frames));
+  return true;
+}
+
+bool ZstdWriteWrap::write_id_data_reused(const ZstdReuseIDFrames &prev_frames)
+{
+  if (reuse_prev_file == -1 ||
+      BLI_lseek(reuse_prev_file, int64_t(prev_frames.file_offset), SEEK_SET) == -1)
+  {
+    return false;
+  }
+
+  /* Read all frames first, so that a failure does not leave a partially written ID. */
+  blender::Vector<ZstdWriteBlockTask *> frame_tasks;
+  bool read_error = false;
+  for (const std::pair<uint32_t, uint32_t> &frame_size : prev_frames.frame_sizes) {
+    ZstdWriteBlockTask *task = MEM_mallocN<ZstdWriteBlockTask>(__func__);
+    task->data = MEM_mallocN(frame_size.first, __func__);
+    task->size = frame_size.first;
+    task->uncompressed_size = frame_size.second;
+    task->ww = this;
+    frame_tasks.append(task);
+    if (BLI_read(reuse_prev_file, task->data, task->size) != int64_t(task->size)) {
+      read_error = true;
+      break;
+    }
+  }
+
+  if (read_error) {
+    for (ZstdWriteBlockTask *task : frame_tasks) {
+      MEM_freeN(task->data);
+      MEM_freeN(task);
+    }
+    /* The previous file is not usable anymore, don't try to reuse other IDs. */
+    ::close(reuse_prev_file);
+    reuse_prev_file = -1;
+    return false;
+  }
 
+  for (ZstdWriteBlockTask *task : frame_tasks) {
+    task->frame_number = num_frames++;
+    submit_task(task);
+  }
   return true;
 }
 
+void ZstdWriteWrap::reuse_begin(const char *filepath)
+{
+  use_reuse = true;
+
+  ZstdReuseCache cache;
+  {
+    std::scoped_lock lock(zstd_reuse_caches_mutex);
+    const auto item = zstd_reuse_caches.find(filepath);
+    if (item == zstd_reuse_caches.end()) {
+      return;
+    }
+    cache = std::move(item->second);
+    zstd_reuse_caches.erase(item);
+  }
+
+  int64_t file_size, file_mtime;
+  if (!zstd_reuse_file_stat(filepath, &file_size, &file_mtime) || file_size != cache.file_size ||
+      file_mtime != cache.file_mtime)
+  {
+    /* The file was modified or removed since it was saved. */
+    return;
+  }
+  reuse_prev_file = BLI_open(filepath, O_BINARY | O_RDONLY, 0);
+  if (reuse_prev_file != -1) {
+    reuse_prev = std::move(cache);
+  }
+}
+
+void ZstdWriteWrap::reuse_end(const char *filepath)
+{
+  BLI_assert(use_reuse);
+
+  ZstdReuseCache cache;
+  if (write_error || !zstd_reuse_file_stat(filepath, &cache.file_size, &cache.file_mtime)) {
+    return;
+  }
+  cache.ids = std::move(reuse_ids);
+
+  std::scoped_lock lock(zstd_reuse_caches_mutex);
+  if (zstd_reuse_caches.size() >= ZSTD_REUSE_CACHE_MAX_FILES) {
+    zstd_reuse_caches.clear();
+  }
+  zstd_reuse_caches.insert_or_assign(filepath, std::move(cache));
+}
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -460,6 +811,18 @@ struct WriteData {
    * Will be nullptr for UNDO.
    */
   WriteWrap *ww;
+
+  /**
+   * When set, all data is appended to this buffer instead of being written through #ww.
+   * Used to serialize a single ID on a worker thread, see #write_ids_parallel.
+   */
+  blender::Vector<uchar> *id_output = nullptr;
+
+  /** Serialized size and count of the local IDs written to a file, per ID type index. */
+  struct {
+    size_t bytes[INDEX_ID_MAX];
+    int ids_num[INDEX_ID_MAX];
+  } id_type_stats;
 };
 
 struct BlendWriter {
@@ -508,6 +871,9 @@ static void writedata_do_write(WriteData *wd, const void *mem, const size_t meml
   if (wd->use_memfile) {
     BLO_memfile_chunk_add(&wd->mem, static_cast<const char *>(mem), memlen);
   }
+  else if (wd->id_output) {
+    wd->id_output->extend(blender::Span(static_cast<const uchar *>(mem), int64_t(memlen)));
+  }
   else {
     if (!wd->ww->write(mem, memlen)) {
       wd->validation_data.critical_error = true;
@@ -1081,6 +1447,96 @@ static void write_id(WriteData *wd, ID *id)
   mywrite_id_end(wd, id);
 }
 
+#ifdef USE_PARALLEL_ID_WRITE
+
+/**
+ * IDs which are written on the main thread even when writing in parallel: their write callbacks
+ * may ensure caches on data shared with other IDs (e.g. view-layer syncing), and they are small.
+ */
+static bool write_id_is_thread_safe(const ID *id)
+{
+  switch (GS(id->name)) {
+    case ID_SCE:
+    case ID_WM:
+    case ID_SCR:
+    case ID_WS:
+      return false;
+    default:
+      return true;
+  }
+}
+
+/**
+ * Write the given IDs, serializing each of them into its own buffer on worker threads.
+ * The buffers are then passed to \a wd in the order of \a ids, so the output is identical to
+ * calling #write_id for each of them.
+ */
+static void write_ids_parallel(WriteData *wd, const blender::Span<ID *> ids)
+{
+  using namespace blender;
+
+  BLI_assert(!wd->use_memfile && wd->debug_dst == nullptr);
+
+  Array<Vector<uchar>> id_outputs(std::min<int64_t>(ids.size(), PARALLEL_ID_WRITE_BATCH_SIZE));
+  Array<bool> id_errors(id_outputs.size());
+
+  auto write_id_to_buffer = [&](ID *id, const int64_t output_index) {
+    WriteData *id_wd = MEM_new<WriteData>(__func__);
+    id_wd->sdna = wd->sdna;
+    id_wd->id_output = &id_outputs[output_index];
+    write_id(id_wd, id);
+    id_errors[output_index] = id_wd->validation_data.critical_error;
+    writedata_free(id_wd);
+  };
+
+  for (int64_t batch_start = 0; batch_start < ids.size();
+       batch_start += PARALLEL_ID_WRITE_BATCH_SIZE)
+  {
+    const Span<ID *> batch = ids.slice(
+        batch_start, std::min<int64_t>(PARALLEL_ID_WRITE_BATCH_SIZE, ids.size() - batch_start));
+
+    threading::parallel_for(batch.index_range(), 1, [&](const IndexRange range) {
+      for (const int64_t i : range) {
+        if (write_id_is_thread_safe(batch[i])) {
+          write_id_to_buffer(batch[i], i);
+        }
+      }
+    });
+    for (const int64_t i : batch.index_range()) {
+      if (!write_id_is_thread_safe(batch[i])) {
+        write_id_to_buffer(batch[i], i);
+      }
+    }
+
+    for (const int64_t i : batch.index_range()) {
+      if (id_errors[i]) {
+        wd->validation_data.critical_error = true;
+      }
+      if (id_outputs[i].size() >= ZSTD_REUSE_ID_MIN_SIZE) {
+        /* Give large IDs to the write wrapper directly, so that it can store them in a way that
+         * allows reusing them when saving the same file again. */
+        mywrite_flush(wd);
+        if (!wd->validation_data.critical_error &&
+            !wd->ww->write_id_data(batch[i]->session_uid,
+                                   id_outputs[i].data(),
+                                   size_t(id_outputs[i].size())))
+        {
+          wd->validation_data.critical_error = true;
+        }
+      }
+      else if (!id_outputs[i].is_empty()) {
+        mywrite(wd, id_outputs[i].data(), size_t(id_outputs[i].size()));
+      }
+      const int id_type_index = BKE_idtype_idcode_to_index(GS(batch[i]->name));
+      wd->id_type_stats.bytes[id_type_index] += size_t(id_outputs[i].size());
+      wd->id_type_stats.ids_num[id_type_index]++;
+      id_outputs[i].clear();
+    }
+  }
+}
+
+#endif /* USE_PARALLEL_ID_WRITE */
+
 /** Keep it last of `write_*_data` functions. */
 static void write_libraries(WriteData *wd, Main *bmain)
 {
@@ -1493,8 +1949,35 @@ static bool write_file_handle(Main *mainvar,
   }
 
   /* Actually write local data-blocks to the file. */
-  for (ID *id : local_ids_to_write) {
-    write_id(wd, id);
+  const double time_ids_start = BLI_time_now_seconds();
+#ifdef USE_PARALLEL_ID_WRITE
+  if (!is_undo && wd->debug_dst == nullptr && local_ids_to_write.size() > 1) {
+    write_ids_parallel(wd, local_ids_to_write);
+  }
+  else
+#endif
+  {
+    for (ID *id : local_ids_to_write) {
+      write_id(wd, id);
+    }
+  }
+
+  if (!is_undo) {
+    CLOG_INFO(&LOG,
+              0,
+              "Local data-blocks written in %.3fs",
+              BLI_time_now_seconds() - time_ids_start);
+    for (int i = 0; i < INDEX_ID_MAX; i++) {
+      if (wd->id_type_stats.ids_num[i] == 0) {
+        continue;
+      }
+      CLOG_INFO(&LOG,
+                0,
+                " * %s: %d IDs, %.2f MiB",
+                BKE_idtype_idcode_to_name_plural(BKE_idtype_index_to_idcode(i)),
+                wd->id_type_stats.ids_num[i],
+                double(wd->id_type_stats.bytes[i]) / (1024.0 * 1024.0));
+    }
   }
 
   /* Write libraries about libraries and linked data-blocks. */
@@ -1738,10 +2221,16 @@ static bool BLO_write_file_impl(Main *mainvar,
 #endif
 
   /* Actual file writing. */
+  const double time_write_start = BLI_time_now_seconds();
   const bool err = write_file_handle(
       mainvar, &ww, nullptr, nullptr, write_flags, use_userdef, thumb, debug_dst);
 
   ww.close();
+  CLOG_INFO(&LOG,
+            0,
+            "Blender file '%s' written in %.3fs",
+            filepath,
+            BLI_time_now_seconds() - time_write_start);
 
   if (UNLIKELY(path_list_backup)) {
     BKE_bpath_list_restore(mainvar, path_list_flag, path_list_backup);
@@ -1755,6 +2244,13 @@ static bool BLO_write_file_impl(Main *mainvar,
     return false;
   }
 
+  if (ww.is_deferred) {
+    /* The temporary file is written and moved in place later, see #BLO_write_file_deferred. */
+    BLI_assert(!use_save_versions);
+    write_file_main_validate_post(mainvar, reports);
+    return true;
+  }
+
   /* File save to temporary file was successful, now do reverse file history
    * (move `.blend1` -> `.blend2`, `.blend` -> `.blend1` .. etc). */
   if (use_save_versions) {
@@ -1790,12 +2286,93 @@ bool BLO_write_file(Main *mainvar,
 
   if (write_flags & G_FILE_COMPRESS) {
     ZstdWriteWrap zstd_wrap(raw_wrap);
-    return BLO_write_file_impl(mainvar, filepath, write_flags, params, reports, zstd_wrap);
+    /* Copy the compressed data of unchanged IDs from the previous save of this file. */
+    zstd_wrap.reuse_begin(filepath);
+    const bool success = BLO_write_file_impl(
+        mainvar, filepath, write_flags, params, reports, zstd_wrap);
+    if (success) {
+      zstd_wrap.reuse_end(filepath);
+    }
+    return success;
   }
 
   return BLO_write_file_impl(mainvar, filepath, write_flags, params, reports, raw_wrap);
 }
 
+/** Background thread compressing and writing the data of the last #BLO_write_file_deferred. */
+static std::thread deferred_write_thread;
+
+static void write_file_deferred_finish(MemoryWriteWrap *mem_wrap,
+                                       const std::string filepath,
+                                       const int write_flags)
+{
+  const std::string tempname = filepath + "@";
+  const double time_write_start = BLI_time_now_seconds();
+
+  RawWriteWrap raw_wrap;
+  ZstdWriteWrap zstd_wrap(raw_wrap);
+  const bool use_compress = (write_flags & G_FILE_COMPRESS) != 0;
+  WriteWrap &ww = use_compress ? static_cast<WriteWrap &>(zstd_wrap) : raw_wrap;
+  if (use_compress) {
+    zstd_wrap.reuse_begin(filepath.c_str());
+  }
+
+  bool success = false;
+  if (ww.open(tempname.c_str())) {
+    const bool flush_success = mem_wrap->flush(ww);
+    success = ww.close() && flush_success;
+  }
+  else {
+    CLOG_ERROR(&LOG, "Cannot open file %s for writing: %s", tempname.c_str(), strerror(errno));
+  }
+  MEM_delete(mem_wrap);
+
+  if (!success) {
+    remove(tempname.c_str());
+    return;
+  }
+  if (BLI_rename_overwrite(tempname.c_str(), filepath.c_str()) != 0) {
+    CLOG_ERROR(&LOG, "Cannot change old file %s (file saved with @)", filepath.c_str());
+    return;
+  }
+  if (use_compress) {
+    zstd_wrap.reuse_end(filepath.c_str());
+  }
+
+  CLOG_INFO(&LOG,
+            0,
+            "Blender file '%s' written in the background in %.3fs",
+            filepath.c_str(),
+            BLI_time_now_seconds() - time_write_start);
+}
+
+bool BLO_write_file_deferred(Main *mainvar,
+                             const char *filepath,
+                             const int write_flags,
+                             const BlendFileWriteParams *params,
+                             ReportList *reports)
+{
+  /* The previous write may still use the same file. */
+  BLO_write_file_deferred_wait();
+
+  MemoryWriteWrap *mem_wrap = MEM_new<MemoryWriteWrap>(__func__);
+  if (!BLO_write_file_impl(mainvar, filepath, write_flags, params, reports, *mem_wrap)) {
+    MEM_delete(mem_wrap);
+    return false;
+  }
+
+  deferred_write_thread = std::thread(
+      write_file_deferred_finish, mem_wrap, std::string(filepath), write_flags);
+  return true;
+}
+
+void BLO_write_file_deferred_wait()
+{
+  if (deferred_write_thread.joinable()) {
+    deferred_write_thread.join();
+  }
+}
+
 bool BLO_write_file_mem(Main *mainvar, MemFile *compare, MemFile *current, const int write_flags)
 {
   bool use_userdef = false;
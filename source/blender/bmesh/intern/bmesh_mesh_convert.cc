@@ -758,6 +758,7 @@ static int bm_to_mesh_shape_layer_index_from_kb(BMesh *bm, KeyBlock *currkey)
  * See #BMeshToMeshParams.active_shapekey_to_mvert doc-string.
  */
 static void bm_to_mesh_shape(BMesh *bm,
+                             const Span<const BMVert *> bm_verts,
                              Key *key,
                              MutableSpan<float3> positions,
                              const bool active_shapekey_to_mvert)
@@ -817,24 +818,28 @@ static void bm_to_mesh_shape(BMesh *bm,
     const int cd_shape_offset = CustomData_get_n_offset(&bm->vdata, CD_SHAPEKEY, actkey_uuid);
 
     ofs = static_cast<float(*)[3]>(MEM_mallocN(sizeof(float[3]) * bm->totvert, __func__));
-    int i;
-    BM_ITER_MESH_INDEX (eve, &iter, bm, BM_VERTS_OF_MESH, i) {
-      const int keyi = BM_ELEM_CD_GET_INT(eve, cd_shape_keyindex_offset);
-      /* Check the vertex existed when entering edit-mode (otherwise don't apply an offset). */
-      if (keyi != ORIGINDEX_NONE) {
-        float *co_orig = (float *)BM_ELEM_CD_GET_VOID_P(eve, cd_shape_offset);
-        /* Could use 'eve->co' or the destination position, they're the same at this point. */
-        sub_v3_v3v3(ofs[i], eve->co, co_orig);
-      }
-      else {
-        /* If there are new vertices in the mesh, we can't propagate the offset
-         * because it will only work for the existing vertices and not the new
-         * ones, creating a mess when doing e.g. subdivide + translate. */
-        MEM_freeN(ofs);
-        ofs = nullptr;
-        dependent.reset();
-        break;
+    std::atomic<bool> any_new_vert = false;
+    threading::parallel_for(bm_verts.index_range(), 1024, [&](const IndexRange range) {
+      for (const int i : range) {
+        const BMVert *vert = bm_verts[i];
+        const int keyi = BM_ELEM_CD_GET_INT(vert, cd_shape_keyindex_offset);
+        /* Check the vertex existed when entering edit-mode (otherwise don't apply an offset). */
+        if (keyi == ORIGINDEX_NONE) {
+          any_new_vert.store(true, std::memory_order_relaxed);
+          return;
+        }
+        const float *co_orig = (const float *)BM_ELEM_CD_GET_VOID_P(vert, cd_shape_offset);
+        /* Could use 'vert->co' or the destination position, they're the same at this point. */
+        sub_v3_v3v3(ofs[i], vert->co, co_orig);
       }
+    });
+    if (any_new_vert) {
+      /* If there are new vertices in the mesh, we can't propagate the offset
+       * because it will only work for the existing vertices and not the new
+       * ones, creating a mess when doing e.g. subdivide + translate. */
+      MEM_freeN(ofs);
+      ofs = nullptr;
+      dependent.reset();
     }
   }
 
@@ -861,7 +866,6 @@ static void bm_to_mesh_shape(BMesh *bm,
 
   int currkey_i;
   LISTBASE_FOREACH_INDEX (KeyBlock *, currkey, &key->block, currkey_i) {
-    int keyi;
     float(*currkey_data)[3];
 
     const int currkey_uuid = bm_to_mesh_shape_layer_index_from_kb(bm, currkey);
@@ -882,37 +886,39 @@ static void bm_to_mesh_shape(BMesh *bm,
       }
       currkey_data = (float(*)[3])currkey->data;
 
-      int i;
-      BM_ITER_MESH_INDEX (eve, &iter, bm, BM_VERTS_OF_MESH, i) {
-        float *co_orig = (float *)BM_ELEM_CD_GET_VOID_P(eve, cd_shape_offset);
+      threading::parallel_for(bm_verts.index_range(), 1024, [&](const IndexRange range) {
+        for (const int i : range) {
+          const BMVert *vert = bm_verts[i];
+          float *co_orig = (float *)BM_ELEM_CD_GET_VOID_P(vert, cd_shape_offset);
 
-        if (currkey == actkey) {
-          copy_v3_v3(currkey_data[i], eve->co);
+          if (currkey == actkey) {
+            copy_v3_v3(currkey_data[i], vert->co);
 
-          if (update_vertex_coords_from_refkey) {
-            BLI_assert(actkey != key->refkey);
-            keyi = BM_ELEM_CD_GET_INT(eve, cd_shape_keyindex_offset);
-            if (keyi != ORIGINDEX_NONE) {
-              float *co_refkey = (float *)BM_ELEM_CD_GET_VOID_P(eve, cd_shape_offset_refkey);
-              copy_v3_v3(positions[i], co_refkey);
+            if (update_vertex_coords_from_refkey) {
+              BLI_assert(actkey != key->refkey);
+              const int keyi = BM_ELEM_CD_GET_INT(vert, cd_shape_keyindex_offset);
+              if (keyi != ORIGINDEX_NONE) {
+                float *co_refkey = (float *)BM_ELEM_CD_GET_VOID_P(vert, cd_shape_offset_refkey);
+                copy_v3_v3(positions[i], co_refkey);
+              }
             }
           }
-        }
-        else {
-          copy_v3_v3(currkey_data[i], co_orig);
-        }
+          else {
+            copy_v3_v3(currkey_data[i], co_orig);
+          }
 
-        /* Propagate edited basis offsets to other shapes. */
-        if (apply_offset) {
-          add_v3_v3(currkey_data[i], ofs[i]);
-        }
+          /* Propagate edited basis offsets to other shapes. */
+          if (apply_offset) {
+            add_v3_v3(currkey_data[i], ofs[i]);
+          }
 
-        /* Apply back new coordinates shape-keys that have offset into #BMesh.
-         * Otherwise, in case we call again #BM_mesh_bm_to_me on same #BMesh,
-         * we'll apply diff from previous call to #BM_mesh_bm_to_me,
-         * to shape-key values from original creation of the #BMesh. See #50524. */
-        copy_v3_v3(co_orig, currkey_data[i]);
-      }
+          /* Apply back new coordinates shape-keys that have offset into #BMesh.
+           * Otherwise, in case we call again #BM_mesh_bm_to_me on same #BMesh,
+           * we'll apply diff from previous call to #BM_mesh_bm_to_me,
+           * to shape-key values from original creation of the #BMesh. See #50524. */
+          copy_v3_v3(co_orig, currkey_data[i]);
+        }
+      });
     }
     else {
       /* No original layer data, use fallback information. */
@@ -932,7 +938,7 @@ static void bm_to_mesh_shape(BMesh *bm,
 
       int i;
       BM_ITER_MESH_INDEX (eve, &iter, bm, BM_VERTS_OF_MESH, i) {
-
+        int keyi;
         if ((currkey->data != nullptr) && (cd_shape_keyindex_offset != -1) &&
             ((keyi = BM_ELEM_CD_GET_INT(eve, cd_shape_keyindex_offset)) != ORIGINDEX_NONE) &&
             (keyi < currkey->totelem))
@@ -1531,8 +1537,11 @@ void BM_mesh_bm_to_me(Main *bmain, BMesh *bm, Mesh *mesh, const BMeshToMeshParam
       [&]() {
         bm_to_mesh_verts(*bm, vert_table, *mesh, select_vert.span, hide_vert.span);
         if (mesh->key) {
-          bm_to_mesh_shape(
-              bm, mesh->key, mesh->vert_positions_for_write(), params->active_shapekey_to_mvert);
+          bm_to_mesh_shape(bm,
+                           vert_table,
+                           mesh->key,
+                           mesh->vert_positions_for_write(),
+                           params->active_shapekey_to_mvert);
         }
       },
       [&]() {
@@ -1602,12 +1611,12 @@ void BM_mesh_bm_to_me(Main *bmain, BMesh *bm, Mesh *mesh, const BMeshToMeshParam
           const int cd_shape_keyindex_offset = CustomData_get_offset(&bm->vdata,
                                                                      CD_SHAPE_KEYINDEX);
           if (cd_shape_keyindex_offset != -1) {
-            BMIter iter;
-            BMVert *vert;
-            int i;
-            BM_ITER_MESH_INDEX (vert, &iter, bm, BM_VERTS_OF_MESH, i) {
-              BM_ELEM_CD_SET_INT(vert, cd_shape_keyindex_offset, i);
-            }
+            threading::parallel_for(vert_table.index_range(), 4096, [&](const IndexRange range) {
+              for (const int i : range) {
+                BMVert *vert = const_cast<BMVert *>(vert_table[i]);
+                BM_ELEM_CD_SET_INT(vert, cd_shape_keyindex_offset, i);
+              }
+            });
           }
         }
       });
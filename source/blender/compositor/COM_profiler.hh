@@ -36,6 +36,11 @@ class Profiler {
   /* Finalize profiling by computing node group times. This should be called after evaluation. */
   void finalize(const bNodeTree &node_tree);
 
+  /* Print the evaluation times of the nodes at the top level of the given tree to the standard
+   * output, sorted from the most to the least expensive. Node groups report their accumulated
+   * time, so this should be called after finalize. */
+  void print_nodes_evaluation_times(const bNodeTree &node_tree) const;
+
  private:
   /* Computes the evaluation time of every group node inside the given tree recursively by
    * accumulating the evaluation time of its nodes, setting the computed time to the group nodes.
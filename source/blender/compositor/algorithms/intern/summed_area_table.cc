@@ -249,15 +249,15 @@ static void summed_area_table_cpu(Result &input,
     }
   });
 
-  /* Vertical summing pass. */
-  threading::parallel_for(IndexRange(size.x), 1, [&](const IndexRange range_x) {
-    for (const int x : range_x) {
-      float4 accumulated_color = float4(0.0f);
-      for (const int y : IndexRange(size.y)) {
+  /* Vertical summing pass. Each task handles a block of columns but walks it row by row, adding
+   * the previous row to the current one, such that memory is accessed contiguously instead of
+   * striding a full row for every pixel. */
+  threading::parallel_for(IndexRange(size.x), 64, [&](const IndexRange range_x) {
+    for (const int y : IndexRange(size.y).drop_front(1)) {
+      for (const int x : range_x) {
         const int2 texel = int2(x, y);
-        const float4 color = output.load_pixel<float4>(texel);
-        accumulated_color += color;
-        output.store_pixel(texel, accumulated_color);
+        const float4 previous_color = output.load_pixel<float4>(int2(x, y - 1));
+        output.store_pixel(texel, output.load_pixel<float4>(texel) + previous_color);
       }
     }
   });
@@ -39,6 +39,9 @@ void Evaluator::evaluate()
   derived_node_tree_ = std::make_unique<DerivedNodeTree>(context_.get_node_tree());
 
   if (!this->validate_node_tree()) {
+    /* Invalid trees are typically transient states while editing links, so keep the cached
+     * resources of the last valid evaluation around instead of freeing them on the next one. */
+    context_.cache_manager().skip_next_reset();
     return;
   }
 
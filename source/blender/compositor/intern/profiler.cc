@@ -2,7 +2,11 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <algorithm>
+#include <iostream>
+
 #include "BLI_timeit.hh"
+#include "BLI_vector.hh"
 
 #include "DNA_node_types.h"
 
@@ -68,4 +72,34 @@ void Profiler::finalize(const bNodeTree &node_tree)
   this->accumulate_node_group_times(node_tree, bke::NODE_INSTANCE_KEY_BASE);
 }
 
+void Profiler::print_nodes_evaluation_times(const bNodeTree &node_tree) const
+{
+  Vector<std::pair<const bNode *, timeit::Nanoseconds>> node_times;
+  timeit::Nanoseconds total_time = timeit::Nanoseconds::zero();
+  for (const bNode *node : node_tree.all_nodes()) {
+    const bNodeInstanceKey node_instance_key = bke::node_instance_key(
+        bke::NODE_INSTANCE_KEY_BASE, &node_tree, node);
+    const timeit::Nanoseconds *time = nodes_evaluation_times_.lookup_ptr(node_instance_key);
+    if (time == nullptr) {
+      continue;
+    }
+    node_times.append({node, *time});
+    total_time += *time;
+  }
+
+  std::sort(node_times.begin(), node_times.end(), [](const auto &a, const auto &b) {
+    return a.second > b.second;
+  });
+
+  std::cout << "Compositor node evaluation times for " << node_tree.id.name + 2 << ":\n";
+  for (const auto &[node, time] : node_times) {
+    std::cout << "  " << node->name << ": ";
+    timeit::print_duration(time);
+    std::cout << "\n";
+  }
+  std::cout << "  Total: ";
+  timeit::print_duration(total_time);
+  std::cout << "\n";
+}
+
 }  // namespace blender::compositor
@@ -30,6 +30,8 @@
 
 #pragma once
 
+#include "BLI_span.hh"
+
 #include "DNA_ID.h"
 
 /* Dependency Graph */
@@ -192,6 +194,18 @@ void DEG_evaluate_on_framechange(
     float frame,
     DepsgraphEvaluateSyncWriteback sync_writeback = DEG_EVALUATE_SYNC_WRITEBACK_NO);
 
+/**
+ * Evaluate each of the given graphs at the frame with the same index, evaluating the graphs at the
+ * same time on all available threads.
+ *
+ * Intended for baking, exporting and motion blur, where many frames of the same scene are needed.
+ * The caller is responsible for the frames being independent from each other: there should be no
+ * simulations or caches relying on a previous frame being evaluated first. The graphs are to be
+ * distinct and inactive, so that the evaluation does not write back to the original data.
+ */
+void DEG_evaluate_on_framechange_multiple(blender::Span<Depsgraph *> graphs,
+                                          blender::Span<float> frames);
+
 /**
  * Data changed recalculation entry point.
  * Evaluate all nodes tagged for updating.
@@ -52,6 +52,18 @@ void DEG_debug_stats_gnuplot(const Depsgraph *graph,
                              const char *label,
                              const char *output_filename);
 
+/* ************************************************ */
+/* Evaluation Trace */
+
+/**
+ * Start recording evaluation of all dependency graphs: every evaluated operation with its thread
+ * and timing. The trace is written to the given file in the Trace Event Format (viewable in
+ * `chrome://tracing` or Perfetto) by #DEG_debug_trace_end.
+ */
+void DEG_debug_trace_begin(const char *filepath);
+/** Write the recorded evaluation trace, does nothing if the recording is not active. */
+void DEG_debug_trace_end();
+
 /* ************************************************ */
 
 /** Compare two dependency graphs. */
@@ -30,6 +30,11 @@ bool BuilderMap::checkIsBuiltAndTag(ID *id, int tag)
   return result;
 }
 
+void BuilderMap::reserve(const int64_t size)
+{
+  id_tags_.reserve(size);
+}
+
 int BuilderMap::getIDTag(ID *id) const
 {
   return id_tags_.lookup_default(id, 0);
@@ -375,6 +375,11 @@ ID *DepsgraphNodeBuilder::ensure_cow_id(ID *id_orig)
 
 void DepsgraphNodeBuilder::begin_build()
 {
+  /* The rebuilt graph is likely to contain about the same IDs as the current one, so avoid
+   * growing the lookup tables one re-hash at a time. */
+  id_info_hash_.reserve(graph_->id_nodes.size());
+  built_map_.reserve(graph_->id_nodes.size());
+
   /* Store existing evaluated versions of datablock, so we can re-use
    * them for new ID nodes. */
   for (IDNode *id_node : graph_->id_nodes) {
@@ -1239,6 +1244,13 @@ void DepsgraphNodeBuilder::build_animdata(ID *id)
   /* Make sure ID node exists. */
   (void)add_id_node(id);
   ID *id_cow = get_cow_id(id);
+  /* Relations update might be caused by changes to the animated data, do not trust previously
+   * resolved paths. */
+  if (deg_eval_copy_is_expanded(id_cow)) {
+    if (AnimData *adt_cow = BKE_animdata_from_id(id_cow)) {
+      BKE_animsys_path_cache_free(adt_cow);
+    }
+  }
   if (adt->action != nullptr || !BLI_listbase_is_empty(&adt->nla_tracks)) {
     OperationNode *operation_node;
     /* Explicit entry operation. */
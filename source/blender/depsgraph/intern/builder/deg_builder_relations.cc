@@ -18,8 +18,10 @@
 #include "BKE_global.hh"
 #include "DNA_modifier_types.h"
 
+#include "BLI_array.hh"
 #include "BLI_listbase.h"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "DNA_action_types.h"
@@ -509,7 +511,10 @@ Depsgraph *DepsgraphRelationBuilder::getGraph()
 
 /* **** Functions to build relations between entities  **** */
 
-void DepsgraphRelationBuilder::begin_build() {}
+void DepsgraphRelationBuilder::begin_build()
+{
+  built_map_.reserve(graph_->id_nodes.size());
+}
 
 void DepsgraphRelationBuilder::build_id(ID *id)
 {
@@ -3450,8 +3455,19 @@ void DepsgraphRelationBuilder::build_vfont(VFont *vfont)
 
 void DepsgraphRelationBuilder::build_copy_on_write_relations()
 {
-  for (IDNode *id_node : graph_->id_nodes) {
-    build_copy_on_write_relations(id_node);
+  /* Relations from the copy-on-evaluation operation only depend on the operations of the same ID,
+   * so they are gathered for all IDs from multiple threads. Adding a relation modifies the nodes
+   * it connects, so the gathered relations are added afterwards, in the original order of IDs to
+   * keep the graph identical to the one built by a single thread. */
+  const Span<IDNode *> id_nodes = graph_->id_nodes;
+  Array<Vector<CopyOnWriteRelation>> id_relations(id_nodes.size());
+  threading::parallel_for(id_nodes.index_range(), 256, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      collect_copy_on_write_relations(id_nodes[i], id_relations[i]);
+    }
+  });
+  for (const int64_t i : id_nodes.index_range()) {
+    build_copy_on_write_relations(id_nodes[i], id_relations[i]);
   }
 }
 
@@ -3492,6 +3508,14 @@ void DepsgraphRelationBuilder::build_nested_shapekey(ID *owner, Key *key)
 }
 
 void DepsgraphRelationBuilder::build_copy_on_write_relations(IDNode *id_node)
+{
+  Vector<CopyOnWriteRelation> relations;
+  collect_copy_on_write_relations(id_node, relations);
+  build_copy_on_write_relations(id_node, relations);
+}
+
+void DepsgraphRelationBuilder::collect_copy_on_write_relations(
+    IDNode *id_node, Vector<CopyOnWriteRelation> &r_relations) const
 {
   ID *id_orig = id_node->id_orig;
 
@@ -3555,8 +3579,7 @@ void DepsgraphRelationBuilder::build_copy_on_write_relations(IDNode *id_node)
      * copy of ID. */
     OperationNode *op_entry = comp_node->get_entry_operation();
     if (op_entry != nullptr) {
-      Relation *rel = graph_->add_new_relation(op_cow, op_entry, "Copy-on-Eval Dependency");
-      rel->flag |= rel_flag;
+      r_relations.append({op_cow, op_entry, rel_flag});
     }
     /* All dangling operations should also be executed after copy-on-evaluation. */
     for (OperationNode *op_node : comp_node->operations_map->values()) {
@@ -3564,8 +3587,7 @@ void DepsgraphRelationBuilder::build_copy_on_write_relations(IDNode *id_node)
         continue;
       }
       if (op_node->inlinks.is_empty()) {
-        Relation *rel = graph_->add_new_relation(op_cow, op_node, "Copy-on-Eval Dependency");
-        rel->flag |= rel_flag;
+        r_relations.append({op_cow, op_node, rel_flag});
       }
       else {
         bool has_same_comp_dependency = false;
@@ -3580,8 +3602,7 @@ void DepsgraphRelationBuilder::build_copy_on_write_relations(IDNode *id_node)
           }
         }
         if (!has_same_comp_dependency) {
-          Relation *rel = graph_->add_new_relation(op_cow, op_node, "Copy-on-Eval Dependency");
-          rel->flag |= rel_flag;
+          r_relations.append({op_cow, op_node, rel_flag});
         }
       }
     }
@@ -3593,6 +3614,28 @@ void DepsgraphRelationBuilder::build_copy_on_write_relations(IDNode *id_node)
      * evaluation step needs geometry, it will have transitive dependency
      * to Mesh copy-on-evaluation already. */
   }
+}
+
+void DepsgraphRelationBuilder::build_copy_on_write_relations(
+    IDNode *id_node, const Span<CopyOnWriteRelation> relations)
+{
+  ID *id_orig = id_node->id_orig;
+
+  if (!deg_eval_copy_is_needed(GS(id_orig->name))) {
+    return;
+  }
+
+  if (!relations.is_empty()) {
+    Node::Relations &outlinks = relations.first().op_from->outlinks;
+    outlinks.reserve(outlinks.size() + relations.size());
+  }
+  for (const CopyOnWriteRelation &relation : relations) {
+    Relation *rel = graph_->add_new_relation(
+        relation.op_from, relation.op_to, "Copy-on-Eval Dependency");
+    rel->flag |= relation.flag;
+  }
+
+  OperationKey copy_on_write_key(id_orig, NodeType::COPY_ON_EVAL, OperationCode::COPY_ON_EVAL);
   /* TODO(sergey): This solves crash for now, but causes too many
    * updates potentially. */
   if (GS(id_orig->name) == ID_OB) {
@@ -15,6 +15,7 @@
 #include "DNA_ID.h"
 
 #include "BLI_span.hh"
+#include "BLI_vector.hh"
 
 #include "BKE_lib_query.hh" /* For LibraryForeachIDCallbackFlag enum. */
 
@@ -307,6 +308,20 @@ class DepsgraphRelationBuilder : public DepsgraphBuilder {
                                    const char *description,
                                    int flags = 0);
 
+  /* Relation from the copy-on-evaluation operation of an ID to another operation of that ID. */
+  struct CopyOnWriteRelation {
+    OperationNode *op_from;
+    OperationNode *op_to;
+    int flag;
+  };
+
+  /* Gather relations from the copy-on-evaluation operation of the ID to its other operations.
+   * The graph is only read, so this is safe to call for different IDs from multiple threads. */
+  void collect_copy_on_write_relations(IDNode *id_node,
+                                       Vector<CopyOnWriteRelation> &r_relations) const;
+  /* Add the gathered relations to the graph, followed by relations to other IDs. */
+  void build_copy_on_write_relations(IDNode *id_node, Span<CopyOnWriteRelation> relations);
+
   template<typename KeyType>
   DepsNodeHandle create_node_handle(const KeyType &key, const char *default_name = "");
 
@@ -159,8 +159,9 @@ void Depsgraph::clear_id_nodes()
   for (IDNode *id_node : id_nodes) {
     delete id_node;
   }
-  /* Clear containers. */
-  id_hash.clear();
+  /* Clear containers. Keep the allocated storage: the graph is typically rebuilt with a similar
+   * set of IDs right after this. */
+  id_hash.clear_and_keep_capacity();
   id_nodes.clear();
   /* Clear physics relation caches. */
   clear_physics_relations(this);
@@ -20,6 +20,7 @@
 #include "intern/debug/deg_debug.h"
 #include "intern/depsgraph.hh"
 #include "intern/depsgraph_relation.hh"
+#include "intern/eval/deg_eval_trace.h"
 #include "intern/node/deg_node_component.hh"
 #include "intern/node/deg_node_id.hh"
 #include "intern/node/deg_node_time.hh"
@@ -50,6 +51,16 @@ const char *DEG_debug_name_get(Depsgraph *depsgraph)
   return deg_graph->debug.name.c_str();
 }
 
+void DEG_debug_trace_begin(const char *filepath)
+{
+  deg::deg_eval_trace_begin(filepath);
+}
+
+void DEG_debug_trace_end()
+{
+  deg::deg_eval_trace_end();
+}
+
 bool DEG_debug_compare(const Depsgraph *graph1, const Depsgraph *graph2)
 {
   BLI_assert(graph1 != nullptr);
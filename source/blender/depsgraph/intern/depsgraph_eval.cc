@@ -8,6 +8,8 @@
  * Evaluation engine entry-points for Depsgraph Engine.
  */
 
+#include "BLI_task.hh"
+
 #include "BKE_scene.hh"
 
 #include "DNA_scene_types.h"
@@ -16,6 +18,10 @@
 #include "DEG_depsgraph_query.hh"
 #include "DEG_depsgraph_writeback_sync.hh"
 
+#ifdef WITH_PYTHON
+#  include "BPY_extern.hh"
+#endif
+
 #include "intern/eval/deg_eval.h"
 #include "intern/eval/deg_eval_flush.h"
 
@@ -85,3 +91,28 @@ void DEG_evaluate_on_framechange(Depsgraph *graph,
   deg_graph->ctime = BKE_scene_frame_to_ctime(scene, frame);
   deg_flush_updates_and_refresh(deg_graph, sync_writeback);
 }
+
+void DEG_evaluate_on_framechange_multiple(const blender::Span<Depsgraph *> graphs,
+                                          const blender::Span<float> frames)
+{
+  BLI_assert(graphs.size() == frames.size());
+
+#ifdef WITH_PYTHON
+  /* Release the GIL for the whole duration of the evaluation: drivers evaluated from worker
+   * threads would otherwise be waiting for the calling thread which holds it. */
+  BPy_BEGIN_ALLOW_THREADS;
+#endif
+
+  /* Every graph uses its own task pool for the evaluation of its operations, so there is no need
+   * to group multiple graphs into a single task. */
+  blender::threading::parallel_for(graphs.index_range(), 1, [&](const blender::IndexRange range) {
+    for (const int64_t i : range) {
+      BLI_assert(!reinterpret_cast<deg::Depsgraph *>(graphs[i])->is_active);
+      DEG_evaluate_on_framechange(graphs[i], frames[i]);
+    }
+  });
+
+#ifdef WITH_PYTHON
+  BPy_END_ALLOW_THREADS;
+#endif
+}
@@ -8,7 +8,9 @@
  * Evaluation engine entry-points for Depsgraph Engine.
  */
 
+#include <algorithm>
 #include <atomic>
+#include <cmath>
 #include <cstdint>
 
 #include "intern/eval/deg_eval.h"
@@ -17,6 +19,8 @@
 #include "BLI_gsqueue.h"
 #include "BLI_task.h"
 #include "BLI_time.h"
+#include "BLI_timeit.hh"
+#include "BLI_vector.hh"
 
 #include "BKE_global.hh"
 
@@ -38,6 +42,7 @@
 #include "intern/eval/deg_eval_copy_on_write.h"
 #include "intern/eval/deg_eval_flush.h"
 #include "intern/eval/deg_eval_stats.h"
+#include "intern/eval/deg_eval_trace.h"
 #include "intern/eval/deg_eval_visibility.h"
 #include "intern/node/deg_node.hh"
 #include "intern/node/deg_node_component.hh"
@@ -82,19 +87,65 @@ struct DepsgraphEvalState {
   EvaluationStage stage;
   bool need_update_pending_parents = true;
   bool need_single_thread_pass = false;
+
+  /* Measure evaluation cost of operations and start ready operations with the longest chain of
+   * dependent operations first. */
+  bool use_priority_scheduling = false;
+  /* Set when evaluation cost of an operation changed enough to invalidate the critical path. */
+  std::atomic<bool> need_update_critical_path = false;
+
+  /* Record evaluation of every operation for the evaluation trace. */
+  bool do_trace = false;
+  /* Total time spent evaluating operations, in nanoseconds. Only measured for the trace. */
+  std::atomic<uint64_t> trace_busy_time_ns = 0;
 };
 
-void evaluate_node(const DepsgraphEvalState *state, OperationNode *operation_node)
+/* Weight of the latest measurement in the running average of the operation cost. */
+#define OPERATION_COST_AVERAGE_WEIGHT 0.25f
+/* Change of the operation cost (relative, and absolute in seconds) which triggers re-calculation
+ * of the critical path after the evaluation. Avoids walking the whole graph on every frame when
+ * timings are stable. */
+#define CRITICAL_PATH_UPDATE_RELATIVE_THRESHOLD 0.25f
+#define CRITICAL_PATH_UPDATE_ABSOLUTE_THRESHOLD 1e-4f
+
+void update_operation_cost(DepsgraphEvalState *state, OperationNode *operation_node, float time)
+{
+  const float old_cost = operation_node->eval_cost;
+  float new_cost = time;
+  if (old_cost != 0.0f) {
+    new_cost = old_cost + (time - old_cost) * OPERATION_COST_AVERAGE_WEIGHT;
+  }
+  operation_node->eval_cost = new_cost;
+
+  const float threshold = std::max(old_cost * CRITICAL_PATH_UPDATE_RELATIVE_THRESHOLD,
+                                   CRITICAL_PATH_UPDATE_ABSOLUTE_THRESHOLD);
+  if (std::abs(new_cost - old_cost) > threshold) {
+    state->need_update_critical_path.store(true, std::memory_order_relaxed);
+  }
+}
+
+void evaluate_node(DepsgraphEvalState *state, OperationNode *operation_node)
 {
   ::Depsgraph *depsgraph = reinterpret_cast<::Depsgraph *>(state->graph);
 
   /* Sanity checks. */
   BLI_assert_msg(!operation_node->is_noop(), "NOOP nodes should not actually be scheduled");
   /* Perform operation. */
-  if (state->do_stats) {
+  if (state->do_stats || state->use_priority_scheduling || state->do_trace) {
     const double start_time = BLI_time_now_seconds();
     operation_node->evaluate(depsgraph);
-    operation_node->stats.current_time += BLI_time_now_seconds() - start_time;
+    const double end_time = BLI_time_now_seconds();
+    const double time = end_time - start_time;
+    if (state->do_stats) {
+      operation_node->stats.current_time += time;
+    }
+    if (state->use_priority_scheduling) {
+      update_operation_cost(state, operation_node, float(time));
+    }
+    if (state->do_trace) {
+      deg_eval_trace_operation(operation_node, start_time, end_time);
+      state->trace_busy_time_ns.fetch_add(uint64_t(time * 1e9), std::memory_order_relaxed);
+    }
   }
   else {
     operation_node->evaluate(depsgraph);
@@ -107,19 +158,51 @@ void evaluate_node(const DepsgraphEvalState *state, OperationNode *operation_nod
   operation_node->flag &= ~DEPSOP_FLAG_CLEAR_ON_EVAL;
 }
 
+/* Order operations so that the ones with the longest chain of dependent operations come first. */
+void sort_by_critical_path(MutableSpan<OperationNode *> nodes)
+{
+  std::stable_sort(nodes.begin(), nodes.end(), [](const OperationNode *a, const OperationNode *b) {
+    return a->critical_path_cost > b->critical_path_cost;
+  });
+}
+
 void deg_task_run_func(TaskPool *pool, void *taskdata)
 {
   void *userdata_v = BLI_task_pool_user_data(pool);
   DepsgraphEvalState *state = (DepsgraphEvalState *)userdata_v;
 
-  /* Evaluate node. */
   OperationNode *operation_node = reinterpret_cast<OperationNode *>(taskdata);
-  evaluate_node(state, operation_node);
 
-  /* Schedule children. */
-  schedule_children(state, operation_node, [&](OperationNode *node) {
-    BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
-  });
+  if (!state->use_priority_scheduling) {
+    /* Evaluate node. */
+    evaluate_node(state, operation_node);
+
+    /* Schedule children. */
+    schedule_children(state, operation_node, [&](OperationNode *node) {
+      BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
+    });
+    return;
+  }
+
+  /* Keep evaluating the most expensive ready child in this task, so that the critical path does
+   * not wait in the pool behind cheap operations. Other ready children are pushed to the pool,
+   * most expensive first so they are the first ones to be picked up by other threads. */
+  Vector<OperationNode *, 16> ready_nodes;
+  while (operation_node != nullptr) {
+    evaluate_node(state, operation_node);
+
+    ready_nodes.clear();
+    schedule_children(
+        state, operation_node, [&](OperationNode *node) { ready_nodes.append(node); });
+    if (ready_nodes.is_empty()) {
+      break;
+    }
+    sort_by_critical_path(ready_nodes);
+    for (OperationNode *node : ready_nodes.as_span().drop_front(1)) {
+      BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
+    }
+    operation_node = ready_nodes.first();
+  }
 }
 
 bool check_operation_node_visible(const DepsgraphEvalState *state, OperationNode *op_node)
@@ -316,9 +399,19 @@ void evaluate_graph_threaded_stage(DepsgraphEvalState *state,
 
   calculate_pending_parents_if_needed(state);
 
-  schedule_graph(state, [&](OperationNode *node) {
-    BLI_task_pool_push(task_pool, deg_task_run_func, node, false, nullptr);
-  });
+  if (state->use_priority_scheduling) {
+    Vector<OperationNode *> ready_nodes;
+    schedule_graph(state, [&](OperationNode *node) { ready_nodes.append(node); });
+    sort_by_critical_path(ready_nodes);
+    for (OperationNode *node : ready_nodes) {
+      BLI_task_pool_push(task_pool, deg_task_run_func, node, false, nullptr);
+    }
+  }
+  else {
+    schedule_graph(state, [&](OperationNode *node) {
+      BLI_task_pool_push(task_pool, deg_task_run_func, node, false, nullptr);
+    });
+  }
   BLI_task_pool_work_and_wait(task_pool);
 }
 
@@ -385,6 +478,8 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
     return;
   }
 
+  SCOPED_TRACE_ZONE("Depsgraph Evaluation");
+
   /* The update counts can be used to check if the Depsgraph was changed since the last time it was
    * cached by comparing its current update count with the one stored at the moment the Depsgraph
    * data were cached.
@@ -410,6 +505,10 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
   DepsgraphEvalState state;
   state.graph = graph;
   state.do_stats = graph->debug.do_time_debug();
+  /* Scheduling order does not matter when there is only a single thread. */
+  state.use_priority_scheduling = (G.debug & G_DEBUG_DEPSGRAPH_NO_THREADS) == 0;
+  state.do_trace = deg_eval_trace_is_enabled();
+  const double trace_start_time = state.do_trace ? BLI_time_now_seconds() : 0.0;
 
   /* Prepare all nodes for evaluation. */
   initialize_execution(&state, graph);
@@ -464,6 +563,15 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
   if (state.do_stats) {
     deg_eval_stats_aggregate(graph);
   }
+  if (state.need_update_critical_path) {
+    deg_eval_stats_update_critical_path(graph);
+  }
+  if (state.do_trace) {
+    deg_eval_trace_graph(graph,
+                         trace_start_time,
+                         BLI_time_now_seconds(),
+                         double(state.trace_busy_time_ns.load()) * 1e-9);
+  }
 
   /* Clear any uncleared tags. */
   deg_graph_clear_tags(graph);
@@ -22,7 +22,8 @@ RuntimeBackup::RuntimeBackup(const Depsgraph *depsgraph)
       sound_backup(depsgraph),
       object_backup(depsgraph),
       movieclip_backup(depsgraph),
-      volume_backup(depsgraph)
+      volume_backup(depsgraph),
+      mesh_backup(depsgraph)
 {
 }
 
@@ -56,6 +57,9 @@ void RuntimeBackup::init_from_id(ID *id)
     case ID_VO:
       volume_backup.init_from_volume(reinterpret_cast<Volume *>(id));
       break;
+    case ID_ME:
+      mesh_backup.init_from_mesh(reinterpret_cast<Mesh *>(id));
+      break;
     default:
       break;
   }
@@ -88,6 +92,9 @@ void RuntimeBackup::restore_to_id(ID *id)
     case ID_VO:
       volume_backup.restore_to_volume(reinterpret_cast<Volume *>(id));
       break;
+    case ID_ME:
+      mesh_backup.restore_to_mesh(reinterpret_cast<Mesh *>(id));
+      break;
     default:
       break;
   }
@@ -0,0 +1,159 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup depsgraph
+ */
+
+#include "intern/eval/deg_eval_runtime_backup_mesh.h"
+
+#include "DNA_mesh_types.h"
+
+#include "BKE_customdata.hh"
+
+namespace blender::deg {
+
+namespace {
+
+MeshBackup::SharedArray get_shared_layer(const CustomData &data,
+                                         const eCustomDataType type,
+                                         const StringRef name)
+{
+  const int layer_index = CustomData_get_named_layer_index(&data, type, name);
+  if (layer_index == -1) {
+    return {};
+  }
+  const CustomDataLayer &layer = data.layers[layer_index];
+  MeshBackup::SharedArray array;
+  array.data = layer.data;
+  if (layer.sharing_info != nullptr) {
+    layer.sharing_info->add_user();
+    array.sharing_info = ImplicitSharingPtr<>(layer.sharing_info);
+  }
+  return array;
+}
+
+MeshBackup::SharedArray get_shared_face_offsets(const Mesh &mesh)
+{
+  MeshBackup::SharedArray array;
+  array.data = mesh.face_offset_indices;
+  if (const ImplicitSharingInfo *sharing_info = mesh.runtime->face_offsets_sharing_info) {
+    sharing_info->add_user();
+    array.sharing_info = ImplicitSharingPtr<>(sharing_info);
+  }
+  return array;
+}
+
+/* Check whether the array of the re-created mesh is the same one the caches were computed from.
+ * The pointer comparison is only reliable if the old array was kept alive in between. */
+bool is_same_array(const MeshBackup::SharedArray &backup, const MeshBackup::SharedArray &current)
+{
+  if (backup.data != current.data) {
+    return false;
+  }
+  return backup.data == nullptr || backup.sharing_info;
+}
+
+template<typename T> void restore_cache(const SharedCache<T> &backup, SharedCache<T> &cache)
+{
+  /* The cache of the re-created mesh might have been shared with the original mesh and be
+   * computed already, keep it in that case. */
+  if (backup.is_cached() && !cache.is_cached()) {
+    cache = backup;
+  }
+}
+
+}  // namespace
+
+MeshBackup::MeshBackup(const Depsgraph * /*depsgraph*/) {}
+
+void MeshBackup::init_from_mesh(Mesh *mesh)
+{
+  const bke::MeshRuntime &runtime = *mesh->runtime;
+  if (runtime.wrapper_type != ME_WRAPPER_TYPE_MDATA || runtime.edit_mesh) {
+    return;
+  }
+  storage = std::make_unique<Storage>();
+  Storage &backup = *storage;
+
+  backup.verts_num = mesh->verts_num;
+  backup.edges_num = mesh->edges_num;
+  backup.faces_num = mesh->faces_num;
+  backup.corners_num = mesh->corners_num;
+
+  backup.positions = get_shared_layer(mesh->vert_data, CD_PROP_FLOAT3, "position");
+  backup.edges = get_shared_layer(mesh->edge_data, CD_PROP_INT32_2D, ".edge_verts");
+  backup.face_offsets = get_shared_face_offsets(*mesh);
+  backup.corner_verts = get_shared_layer(mesh->corner_data, CD_PROP_INT32, ".corner_vert");
+  backup.corner_edges = get_shared_layer(mesh->corner_data, CD_PROP_INT32, ".corner_edge");
+
+  backup.corner_tri_faces_cache = runtime.corner_tri_faces_cache;
+  backup.vert_to_face_offset_cache = runtime.vert_to_face_offset_cache;
+  backup.vert_to_face_map_cache = runtime.vert_to_face_map_cache;
+  backup.vert_to_corner_map_cache = runtime.vert_to_corner_map_cache;
+  backup.corner_to_face_map_cache = runtime.corner_to_face_map_cache;
+  backup.loose_edges_cache = runtime.loose_edges_cache;
+  backup.loose_verts_cache = runtime.loose_verts_cache;
+  backup.verts_no_face_cache = runtime.verts_no_face_cache;
+
+  backup.bounds_cache = runtime.bounds_cache;
+  backup.corner_tris_cache = runtime.corner_tris_cache.data;
+  backup.vert_normals_cache = runtime.vert_normals_cache;
+  backup.face_normals_cache = runtime.face_normals_cache;
+  backup.bvh_cache_verts = runtime.bvh_cache_verts;
+  backup.bvh_cache_edges = runtime.bvh_cache_edges;
+  backup.bvh_cache_faces = runtime.bvh_cache_faces;
+  backup.bvh_cache_corner_tris = runtime.bvh_cache_corner_tris;
+}
+
+void MeshBackup::restore_to_mesh(Mesh *mesh)
+{
+  if (!storage) {
+    return;
+  }
+  const Storage &backup = *storage;
+  bke::MeshRuntime &runtime = *mesh->runtime;
+
+  const bool same_topology =
+      runtime.wrapper_type == ME_WRAPPER_TYPE_MDATA && mesh->verts_num == backup.verts_num &&
+      mesh->edges_num == backup.edges_num && mesh->faces_num == backup.faces_num &&
+      mesh->corners_num == backup.corners_num &&
+      is_same_array(backup.edges,
+                    get_shared_layer(mesh->edge_data, CD_PROP_INT32_2D, ".edge_verts")) &&
+      is_same_array(backup.face_offsets, get_shared_face_offsets(*mesh)) &&
+      is_same_array(backup.corner_verts,
+                    get_shared_layer(mesh->corner_data, CD_PROP_INT32, ".corner_vert")) &&
+      is_same_array(backup.corner_edges,
+                    get_shared_layer(mesh->corner_data, CD_PROP_INT32, ".corner_edge"));
+  const bool same_positions = same_topology &&
+                              is_same_array(backup.positions,
+                                            get_shared_layer(
+                                                mesh->vert_data, CD_PROP_FLOAT3, "position"));
+
+  if (same_topology) {
+    restore_cache(backup.corner_tri_faces_cache, runtime.corner_tri_faces_cache);
+    restore_cache(backup.vert_to_face_offset_cache, runtime.vert_to_face_offset_cache);
+    restore_cache(backup.vert_to_face_map_cache, runtime.vert_to_face_map_cache);
+    restore_cache(backup.vert_to_corner_map_cache, runtime.vert_to_corner_map_cache);
+    restore_cache(backup.corner_to_face_map_cache, runtime.corner_to_face_map_cache);
+    restore_cache(backup.loose_edges_cache, runtime.loose_edges_cache);
+    restore_cache(backup.loose_verts_cache, runtime.loose_verts_cache);
+    restore_cache(backup.verts_no_face_cache, runtime.verts_no_face_cache);
+  }
+  if (same_positions) {
+    restore_cache(backup.bounds_cache, runtime.bounds_cache);
+    restore_cache(backup.corner_tris_cache, runtime.corner_tris_cache.data);
+    restore_cache(backup.vert_normals_cache, runtime.vert_normals_cache);
+    restore_cache(backup.face_normals_cache, runtime.face_normals_cache);
+    restore_cache(backup.bvh_cache_verts, runtime.bvh_cache_verts);
+    restore_cache(backup.bvh_cache_edges, runtime.bvh_cache_edges);
+    restore_cache(backup.bvh_cache_faces, runtime.bvh_cache_faces);
+    restore_cache(backup.bvh_cache_corner_tris, runtime.bvh_cache_corner_tris);
+  }
+
+  /* Release references to the old arrays and caches. */
+  storage.reset();
+}
+
+}  // namespace blender::deg
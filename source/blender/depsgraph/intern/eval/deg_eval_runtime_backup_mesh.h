@@ -0,0 +1,80 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup depsgraph
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "BLI_implicit_sharing_ptr.hh"
+
+#include "BKE_mesh_types.hh"
+
+struct Mesh;
+
+namespace blender::deg {
+
+struct Depsgraph;
+
+/* Backup of mesh caches which only depend on the geometry.
+ *
+ * Tagging a mesh for copy-on-evaluation re-creates the evaluated copy from the original, even
+ * when only a property unrelated to the geometry has changed. The geometry arrays themselves are
+ * shared with the original, but without this backup all derived data (normals, triangulation,
+ * BVH trees, ...) would be re-computed on the next evaluation. */
+class MeshBackup {
+ public:
+  MeshBackup(const Depsgraph *depsgraph);
+
+  void init_from_mesh(Mesh *mesh);
+  void restore_to_mesh(Mesh *mesh);
+
+  /* Array which the caches are computed from. The sharing info is referenced, so that the memory
+   * can not be re-used by another array while the mesh is being re-copied. */
+  struct SharedArray {
+    const void *data = nullptr;
+    ImplicitSharingPtr<> sharing_info;
+  };
+
+  struct Storage {
+    int verts_num;
+    int edges_num;
+    int faces_num;
+    int corners_num;
+
+    SharedArray positions;
+    SharedArray edges;
+    SharedArray face_offsets;
+    SharedArray corner_verts;
+    SharedArray corner_edges;
+
+    /* Caches which depend on the topology only. */
+    SharedCache<Array<int>> corner_tri_faces_cache;
+    SharedCache<Array<int>> vert_to_face_offset_cache;
+    SharedCache<Array<int>> vert_to_face_map_cache;
+    SharedCache<Array<int>> vert_to_corner_map_cache;
+    SharedCache<Array<int>> corner_to_face_map_cache;
+    SharedCache<bke::LooseEdgeCache> loose_edges_cache;
+    SharedCache<bke::LooseVertCache> loose_verts_cache;
+    SharedCache<bke::LooseVertCache> verts_no_face_cache;
+
+    /* Caches which depend on the topology and the vertex positions. */
+    SharedCache<Bounds<float3>> bounds_cache;
+    SharedCache<Array<int3>> corner_tris_cache;
+    SharedCache<Vector<float3>> vert_normals_cache;
+    SharedCache<Vector<float3>> face_normals_cache;
+    SharedCache<std::unique_ptr<BVHTree, BVHTreeDeleter>> bvh_cache_verts;
+    SharedCache<std::unique_ptr<BVHTree, BVHTreeDeleter>> bvh_cache_edges;
+    SharedCache<std::unique_ptr<BVHTree, BVHTreeDeleter>> bvh_cache_faces;
+    SharedCache<std::unique_ptr<BVHTree, BVHTreeDeleter>> bvh_cache_corner_tris;
+  };
+
+  /* Only allocated when there is a mesh to backup, most of the updated IDs are not meshes. */
+  std::unique_ptr<Storage> storage;
+};
+
+}  // namespace blender::deg
@@ -8,7 +8,12 @@
 
 #include "intern/eval/deg_eval_stats.h"
 
+#include <algorithm>
+
+#include "BLI_vector.hh"
+
 #include "intern/depsgraph.hh"
+#include "intern/depsgraph_relation.hh"
 
 #include "intern/node/deg_node.hh"
 #include "intern/node/deg_node_component.hh"
@@ -37,4 +42,46 @@ void deg_eval_stats_aggregate(Depsgraph *graph)
   }
 }
 
+void deg_eval_stats_update_critical_path(Depsgraph *graph)
+{
+  /* Visit operations in reverse topological order, starting from the ones nothing depends on, so
+   * that the critical path of all children is known by the time an operation is visited. Cyclic
+   * relations are ignored: they are not respected by the scheduler either.
+   *
+   * The custom flags store the number of children which are not visited yet. */
+  Vector<OperationNode *> queue;
+  queue.reserve(graph->operations.size());
+  for (OperationNode *op_node : graph->operations) {
+    op_node->custom_flags = 0;
+    for (const Relation *rel : op_node->outlinks) {
+      if ((rel->flag & RELATION_FLAG_CYCLIC) == 0) {
+        ++op_node->custom_flags;
+      }
+    }
+    if (op_node->custom_flags == 0) {
+      queue.append(op_node);
+    }
+  }
+  for (int64_t i = 0; i < queue.size(); i++) {
+    OperationNode *op_node = queue[i];
+    float children_cost = 0.0f;
+    for (const Relation *rel : op_node->outlinks) {
+      if ((rel->flag & RELATION_FLAG_CYCLIC) == 0) {
+        const OperationNode *child = (const OperationNode *)rel->to;
+        children_cost = std::max(children_cost, child->critical_path_cost);
+      }
+    }
+    op_node->critical_path_cost = op_node->eval_cost + children_cost;
+    for (const Relation *rel : op_node->inlinks) {
+      if (rel->from->type != NodeType::OPERATION || (rel->flag & RELATION_FLAG_CYCLIC) != 0) {
+        continue;
+      }
+      OperationNode *parent = (OperationNode *)rel->from;
+      if (--parent->custom_flags == 0) {
+        queue.append(parent);
+      }
+    }
+  }
+}
+
 }  // namespace blender::deg
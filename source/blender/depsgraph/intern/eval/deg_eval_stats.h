@@ -15,4 +15,8 @@ struct Depsgraph;
 /* Aggregate operation timings to overall component and ID nodes timing. */
 void deg_eval_stats_aggregate(Depsgraph *graph);
 
+/* Update the estimated cost of the longest chain of operations starting at every operation, based
+ * on the per-operation evaluation cost measured during previous evaluations. */
+void deg_eval_stats_update_critical_path(Depsgraph *graph);
+
 }  // namespace blender::deg
@@ -0,0 +1,186 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup depsgraph
+ */
+
+#include "intern/eval/deg_eval_trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <string>
+
+#include "BLI_enumerable_thread_specific.hh"
+#include "BLI_fileops.h"
+#include "BLI_string.h"
+#include "BLI_task.h"
+#include "BLI_utildefines.h"
+#include "BLI_vector.hh"
+
+#include "intern/debug/deg_debug.h"
+#include "intern/depsgraph.hh"
+#include "intern/node/deg_node_component.hh"
+#include "intern/node/deg_node_id.hh"
+#include "intern/node/deg_node_operation.hh"
+
+namespace blender::deg {
+
+namespace {
+
+struct TraceEvent {
+  std::string name;
+  std::string category;
+  /* Pre-formatted JSON object, empty when the event has no arguments. */
+  std::string args;
+  double start_time;
+  double end_time;
+};
+
+struct TraceRecorder {
+  std::string filepath;
+  /* Events are collected per thread to avoid any synchronization while recording. The index of
+   * the thread's storage is used as the thread identifier in the trace. */
+  threading::EnumerableThreadSpecific<Vector<TraceEvent>> thread_events;
+};
+
+std::atomic<TraceRecorder *> trace_recorder = nullptr;
+
+std::string json_escape(const StringRef str)
+{
+  std::string result;
+  result.reserve(str.size());
+  for (const char c : str) {
+    if (ELEM(c, '"', '\\')) {
+      result += '\\';
+      result += c;
+    }
+    else if (uchar(c) < 0x20) {
+      char buf[8];
+      SNPRINTF(buf, "\\u%04x", int(c));
+      result += buf;
+    }
+    else {
+      result += c;
+    }
+  }
+  return result;
+}
+
+void trace_add_event(TraceEvent &&event)
+{
+  TraceRecorder *recorder = trace_recorder.load(std::memory_order_acquire);
+  if (recorder == nullptr) {
+    return;
+  }
+  recorder->thread_events.local().append(std::move(event));
+}
+
+void trace_write(TraceRecorder &recorder)
+{
+  FILE *fp = BLI_fopen(recorder.filepath.c_str(), "w");
+  if (fp == nullptr) {
+    DEG_ERROR_PRINTF("Failed to write depsgraph trace to '%s'\n", recorder.filepath.c_str());
+    return;
+  }
+
+  fprintf(fp, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+  fprintf(fp, R"({"name":"process_name","ph":"M","pid":1,"args":{"name":"Depsgraph"}})");
+
+  int thread_index = 0;
+  for (const Vector<TraceEvent> &events : recorder.thread_events) {
+    fprintf(fp,
+            ",\n"
+            R"({"name":"thread_name","ph":"M","pid":1,"tid":%d,"args":{"name":"Thread %d"}})",
+            thread_index,
+            thread_index);
+    for (const TraceEvent &event : events) {
+      fprintf(fp,
+              ",\n"
+              R"({"name":"%s","cat":"%s","ph":"X","ts":%.3f,"dur":%.3f,"pid":1,"tid":%d)",
+              json_escape(event.name).c_str(),
+              json_escape(event.category).c_str(),
+              event.start_time * 1e6,
+              (event.end_time - event.start_time) * 1e6,
+              thread_index);
+      if (!event.args.empty()) {
+        fprintf(fp, ",\"args\":%s", event.args.c_str());
+      }
+      fprintf(fp, "}");
+    }
+    thread_index++;
+  }
+
+  fprintf(fp, "\n]}\n");
+  fclose(fp);
+}
+
+}  // namespace
+
+void deg_eval_trace_begin(const char *filepath)
+{
+  TraceRecorder *recorder = new TraceRecorder();
+  recorder->filepath = filepath;
+  delete trace_recorder.exchange(recorder);
+}
+
+void deg_eval_trace_end()
+{
+  TraceRecorder *recorder = trace_recorder.exchange(nullptr);
+  if (recorder == nullptr) {
+    return;
+  }
+  trace_write(*recorder);
+  delete recorder;
+}
+
+bool deg_eval_trace_is_enabled()
+{
+  return trace_recorder.load(std::memory_order_relaxed) != nullptr;
+}
+
+void deg_eval_trace_operation(const OperationNode *operation_node,
+                              const double start_time,
+                              const double end_time)
+{
+  const ComponentNode *comp_node = operation_node->owner;
+  const IDNode *id_node = comp_node->owner;
+
+  TraceEvent event;
+  event.name = operation_node->full_identifier();
+  event.category = comp_node->identifier();
+  event.args = "{\"id\":\"" + json_escape(id_node->name) + "\"}";
+  event.start_time = start_time;
+  event.end_time = end_time;
+  trace_add_event(std::move(event));
+}
+
+void deg_eval_trace_graph(const Depsgraph *graph,
+                          const double start_time,
+                          const double end_time,
+                          const double busy_time)
+{
+  /* Time the worker threads were not evaluating operations while the graph was evaluated. It
+   * includes scheduling overhead and time spent waiting on dependencies. */
+  const double available_time = (end_time - start_time) * BLI_task_scheduler_num_threads();
+  const double idle_time = std::max(available_time - busy_time, 0.0);
+
+  char args[128];
+  SNPRINTF(args,
+           "{\"operations\":%d,\"busy_ms\":%.3f,\"idle_ms\":%.3f}",
+           int(graph->operations.size()),
+           busy_time * 1e3,
+           idle_time * 1e3);
+
+  TraceEvent event;
+  event.name = graph->debug.name.empty() ? "Depsgraph" : "Depsgraph " + graph->debug.name;
+  event.category = "evaluation";
+  event.args = args;
+  event.start_time = start_time;
+  event.end_time = end_time;
+  trace_add_event(std::move(event));
+}
+
+}  // namespace blender::deg
@@ -0,0 +1,40 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup depsgraph
+ *
+ * Opt-in recording of the dependency graph evaluation, written out in the Trace Event Format
+ * which can be viewed in `chrome://tracing` or Perfetto.
+ */
+
+#pragma once
+
+namespace blender::deg {
+
+struct Depsgraph;
+struct OperationNode;
+
+/* Start recording evaluation of all dependency graphs, the trace is written to the given file
+ * by #deg_eval_trace_end(). */
+void deg_eval_trace_begin(const char *filepath);
+/* Write the recorded trace and stop recording. Does nothing if the recording is not active. */
+void deg_eval_trace_end();
+
+bool deg_eval_trace_is_enabled();
+
+/* Record evaluation of a single operation on the current thread.
+ * The times are in seconds, as returned by #BLI_time_now_seconds(). */
+void deg_eval_trace_operation(const OperationNode *operation_node,
+                              double start_time,
+                              double end_time);
+
+/* Record evaluation of the whole graph on the current thread.
+ * The busy time is the total time spent evaluating operations, on all threads. */
+void deg_eval_trace_graph(const Depsgraph *graph,
+                          double start_time,
+                          double end_time,
+                          double busy_time);
+
+}  // namespace blender::deg
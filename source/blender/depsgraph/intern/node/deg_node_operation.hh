@@ -285,6 +285,12 @@ struct OperationNode : public Node {
   uint32_t num_links_pending;
   bool scheduled;
 
+  /* Running average of the time in seconds spent evaluating this operation, and the estimated
+   * time of the longest chain of operations which depends on it (including the operation itself).
+   * Used by the evaluation engine to start operations on the critical path first. */
+  float eval_cost;
+  float critical_path_cost;
+
   /* Identifier for the operation being performed. */
   OperationCode opcode;
   int name_tag;
@@ -311,6 +311,13 @@ void Film::init(const int2 &extent, const rcti *output_rect)
     data_.scaling_factor = 1;
     if (inst_.is_viewport()) {
       data_.scaling_factor = BKE_render_preview_pixel_size(&inst_.scene->r);
+      if ((inst_.scene->eevee.flag & SCE_EEVEE_NAVIGATION_LOW_RESOLUTION) &&
+          (inst_.is_navigating || inst_.is_transforming))
+      {
+        /* Trade sharpness for interactivity. The film is reset when the view stops moving and the
+         * full resolution is reconstructed by the accumulation. */
+        data_.scaling_factor = math::min(data_.scaling_factor * 2, 8);
+      }
     }
     /* Sharpen the LODs (1.5x) to avoid TAA filtering causing over-blur (see #122941). */
     data_.texture_lod_bias = 1.0f / (data_.scaling_factor * 1.5f);
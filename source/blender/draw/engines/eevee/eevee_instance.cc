@@ -785,6 +785,7 @@ void Instance::light_bake_irradiance(
     FunctionRef<void()> context_enable,
     FunctionRef<void()> context_disable,
     FunctionRef<bool()> stop,
+    FunctionRef<bool()> result_pending,
     FunctionRef<void(LightProbeGridCacheFrame *, float progress)> result_update)
 {
   BLI_assert(is_baking());
@@ -869,12 +870,13 @@ void Instance::light_bake_irradiance(
         }
       }
 
-      LightProbeGridCacheFrame *cache_frame;
+      LightProbeGridCacheFrame *cache_frame = nullptr;
       if (sampling.finished()) {
         cache_frame = volume_probes.bake.read_result_packed();
       }
-      else {
-        /* TODO(fclem): Only do this read-back if needed. But it might be tricky to know when. */
+      else if (!result_pending()) {
+        /* Skip the intermediate read-back if the previous one has not been displayed yet.
+         * It would be discarded anyway. */
         cache_frame = volume_probes.bake.read_result_unpacked();
       }
 
@@ -255,6 +255,7 @@ class Instance : public DrawEngine {
       FunctionRef<void()> context_enable,
       FunctionRef<void()> context_disable,
       FunctionRef<bool()> stop,
+      FunctionRef<bool()> result_pending,
       FunctionRef<void(LightProbeGridCacheFrame *, float progress)> result_update);
 
   static void update_passes(RenderEngine *engine, Scene *scene, ViewLayer *view_layer);
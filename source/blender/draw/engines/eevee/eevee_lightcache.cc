@@ -167,18 +167,25 @@ class LightBake {
           [this]() { context_enable(); },
           [this]() { context_disable(); },
           [&]() { return (G.is_break == true) || ((stop != nullptr) ? *stop : false); },
+          [&]() {
+            std::scoped_lock lock(result_mutex_);
+            return bake_result_[i] != nullptr;
+          },
           [&](LightProbeGridCacheFrame *cache_frame, float grid_progress) {
-            {
-              std::scoped_lock lock(result_mutex_);
-              /* Delete any existing cache that wasn't transferred to the original object. */
-              if (bake_result_[i] != nullptr) {
-                BKE_lightprobe_grid_cache_frame_free(bake_result_[i]);
+            /* Can be null when only the progress changed. */
+            if (cache_frame != nullptr) {
+              {
+                std::scoped_lock lock(result_mutex_);
+                /* Delete any existing cache that wasn't transferred to the original object. */
+                if (bake_result_[i] != nullptr) {
+                  BKE_lightprobe_grid_cache_frame_free(bake_result_[i]);
+                }
+                bake_result_[i] = cache_frame;
               }
-              bake_result_[i] = cache_frame;
-            }
 
-            if (do_update) {
-              *do_update = true;
+              if (do_update) {
+                *do_update = true;
+              }
             }
 
             if (progress) {
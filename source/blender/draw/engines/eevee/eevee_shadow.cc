@@ -764,12 +764,13 @@ void ShadowModule::sync_object(const Object *ob,
   ShadowObject &shadow_ob = objects_.lookup_or_add_default(handle.object_key);
   shadow_ob.used = true;
   const bool is_initialized = shadow_ob.resource_handle.raw != 0;
+  const bool was_caster = is_initialized && shadow_ob.is_caster;
   const bool has_jittered_transparency = has_transparent_shadows && data_.use_jitter;
-  if (is_shadow_caster && (handle.recalc || !is_initialized || has_jittered_transparency)) {
-    if (handle.recalc && is_initialized) {
-      past_casters_updated_.append(shadow_ob.resource_handle.raw);
-    }
-
+  if (was_caster && (handle.recalc || !is_shadow_caster)) {
+    /* Clear the shadows of the previous state. */
+    past_casters_updated_.append(shadow_ob.resource_handle.raw);
+  }
+  if (is_shadow_caster && (handle.recalc || !was_caster || has_jittered_transparency)) {
     if (has_jittered_transparency) {
       jittered_transparent_casters_.append(resource_handle.raw);
     }
@@ -778,6 +779,7 @@ void ShadowModule::sync_object(const Object *ob,
     }
   }
   shadow_ob.resource_handle = resource_handle;
+  shadow_ob.is_caster = is_shadow_caster;
 
   if (is_shadow_caster) {
     curr_casters_.append(resource_handle.raw);
@@ -828,8 +830,11 @@ void ShadowModule::end_sync()
     ShadowObject &shadow_ob = (*it).value;
     /* Do not discard casters in baking mode. See WORKAROUND in `surfels_create`. */
     if (!shadow_ob.used && !inst_.is_baking()) {
-      /* May not be a caster, but it does not matter, be conservative. */
-      past_casters_updated_.append(shadow_ob.resource_handle.raw);
+      /* Objects that were only receivers (e.g. transparent objects not casting shadows) did not
+       * contribute to any shadow page, no need to update them. */
+      if (shadow_ob.is_caster) {
+        past_casters_updated_.append(shadow_ob.resource_handle.raw);
+      }
       objects_.remove(it);
     }
     else {
@@ -1245,7 +1250,9 @@ void ShadowModule::ShadowView::compute_visibility(ObjectBoundsBuf &bounds,
   uint words_len = (view_len_ == 1) ? divide_ceil_u(resource_len, 32) :
                                       resource_len * word_per_draw;
   words_len = ceil_to_multiple_u(max_ii(1, words_len), 4);
-  /* TODO(fclem): Resize to nearest pow2 to reduce fragmentation. */
+  /* Round up to a power of 2 so the buffer isn't reallocated each time the number of resources
+   * changes slightly. */
+  words_len = power_of_2_max_u(words_len);
   visibility_buf_.resize(words_len);
 
   const uint32_t data = 0xFFFFFFFFu;
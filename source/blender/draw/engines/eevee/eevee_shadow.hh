@@ -171,6 +171,8 @@ struct ShadowTileMapPool {
 struct ShadowObject {
   ResourceHandle resource_handle = {0};
   bool used = true;
+  /** Was a shadow caster during the last sync. Only casters need to invalidate shadow pages. */
+  bool is_caster = false;
 };
 
 /** \} */
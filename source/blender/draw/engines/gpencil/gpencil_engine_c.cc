@@ -374,6 +374,8 @@ static GPENCIL_tObject *grease_pencil_object_cache_populate(
   GPUTexture *tex_fill = inst->dummy_tx;
   GPUTexture *tex_stroke = inst->dummy_tx;
 
+  /* Fetched on first use, the batch is shared by all the drawings of the object. */
+  blender::gpu::Batch *geom = nullptr;
   blender::gpu::Batch *iter_geom = nullptr;
   PassSimple *last_pass = nullptr;
   int vfirst = 0;
@@ -408,6 +410,20 @@ static GPENCIL_tObject *grease_pencil_object_cache_populate(
         vcount = v_first + v_count - vfirst;
       };
 
+  /* Looking up the material settings is not free and is needed for every stroke of every drawing.
+   * Cache them per material slot for the whole object. */
+  Array<const MaterialGPencilStyle *> gp_styles(ob->totcol, nullptr);
+  const auto material_settings_get =
+      [&](const int material_index) -> const MaterialGPencilStyle * {
+    if (material_index >= gp_styles.size()) {
+      return BKE_gpencil_material_settings(ob, material_index + 1);
+    }
+    if (gp_styles[material_index] == nullptr) {
+      gp_styles[material_index] = BKE_gpencil_material_settings(ob, material_index + 1);
+    }
+    return gp_styles[material_index];
+  };
+
   int t_offset = 0;
   /* Note that we loop over all the drawings (including the onion skinned ones) to make sure we
    * match the offsets of the batch cache. */
@@ -500,7 +516,7 @@ static GPENCIL_tObject *grease_pencil_object_cache_populate(
        * clamp it here to avoid crashing in the rendering code. Any stroke with a material < 0 will
        * use the first material in the first material slot. */
       const int material_index = std::max(stroke_materials[stroke_i], 0);
-      const MaterialGPencilStyle *gp_style = BKE_gpencil_material_settings(ob, material_index + 1);
+      const MaterialGPencilStyle *gp_style = material_settings_get(material_index);
 
       const bool hide_material = (gp_style->flag & GP_MATERIAL_HIDE) != 0;
       const bool show_stroke = ((gp_style->flag & GP_MATERIAL_STROKE_SHOW) != 0);
@@ -545,7 +561,9 @@ static GPENCIL_tObject *grease_pencil_object_cache_populate(
         }
       }
 
-      blender::gpu::Batch *geom = draw::DRW_cache_grease_pencil_get(inst->scene, ob);
+      if (geom == nullptr) {
+        geom = draw::DRW_cache_grease_pencil_get(inst->scene, ob);
+      }
       if (iter_geom != geom) {
         drawcall_flush(pass);
 
@@ -441,7 +441,18 @@ class Armatures : Overlay {
       transparent_.relations = opaque_.relations;
     }
 
-    auto shape_instance_bufs_begin_sync = [](BoneBuffers &bb) {
+    /* Recreating the buffers of every custom shape at each sync is expensive. Only remove the
+     * buffers of the shapes that were not drawn during the last sync and reuse the others. */
+    auto custom_shape_bufs_begin_sync =
+        [](Map<gpu::Batch *, std::unique_ptr<BoneInstanceBuf>> &custom_shape_bufs) {
+          custom_shape_bufs.remove_if(
+              [](const auto &item) { return item.value->data_buf.is_empty(); });
+          for (std::unique_ptr<BoneInstanceBuf> &buf : custom_shape_bufs.values()) {
+            buf->clear();
+          }
+        };
+
+    auto shape_instance_bufs_begin_sync = [&](BoneBuffers &bb) {
       bb.envelope_fill_buf.clear();
       bb.envelope_outline_buf.clear();
       bb.envelope_distance_buf.clear();
@@ -457,12 +468,10 @@ class Armatures : Overlay {
       bb.degrees_of_freedom_fill_buf.clear();
       bb.degrees_of_freedom_wire_buf.clear();
       bb.relations_buf.clear();
-      /* TODO(fclem): Potentially expensive operation recreating a lot of gpu buffers.
-       * Prefer a pruning strategy. */
-      bb.custom_shape_fill.clear();
-      bb.custom_shape_outline.clear();
-      bb.custom_shape_wire.clear();
-      bb.custom_shape_wire_strip.clear();
+      custom_shape_bufs_begin_sync(bb.custom_shape_fill);
+      custom_shape_bufs_begin_sync(bb.custom_shape_outline);
+      custom_shape_bufs_begin_sync(bb.custom_shape_wire);
+      custom_shape_bufs_begin_sync(bb.custom_shape_wire_strip);
     };
 
     shape_instance_bufs_begin_sync(transparent_);
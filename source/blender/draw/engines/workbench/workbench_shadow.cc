@@ -222,10 +222,12 @@ void ShadowPass::ShadowView::compute_visibility(ObjectBoundsBuf &bounds,
   uint words_len = (view_len_ == 1) ? divide_ceil_u(resource_len, 32) :
                                       resource_len * word_per_draw;
   words_len = ceil_to_multiple_u(max_ii(1, words_len), 4);
+  /* Round up to a power of 2 so the buffer isn't reallocated each time the number of resources
+   * changes slightly. */
+  words_len = power_of_2_max_u(words_len);
   const uint32_t data = 0xFFFFFFFFu;
 
   if (current_pass_type_ == ShadowPass::PASS) {
-    /* TODO(fclem): Resize to nearest pow2 to reduce fragmentation. */
     pass_visibility_buf_.resize(words_len);
     GPU_storagebuf_clear(pass_visibility_buf_, data);
     fail_visibility_buf_.resize(words_len);
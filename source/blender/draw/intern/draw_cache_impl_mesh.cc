@@ -704,6 +704,23 @@ static void mesh_batch_cache_discard_uvedit_select(MeshBatchCache &cache)
   mesh_batch_cache_discard_batch(cache, batch_map);
 }
 
+/**
+ * Only discard the generic attribute buffers, so that changing attribute values (e.g. painting
+ * vertex colors) doesn't re-extract positions, normals and UVs. The requested attribute layers
+ * are kept, so the same buffers are extracted again on the next draw.
+ */
+static void mesh_batch_cache_discard_attributes(MeshBatchCache &cache)
+{
+  FOREACH_MESH_BUFFER_CACHE (cache, mbc) {
+    for (int i = 0; i < GPU_MAX_ATTR; i++) {
+      GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.attr[i]);
+    }
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.attr_viewer);
+  }
+  DRWBatchFlag batch_map = BATCH_MAP(vbo.attr[0], vbo.attr_viewer);
+  mesh_batch_cache_discard_batch(cache, batch_map);
+}
+
 void DRW_mesh_batch_cache_dirty_tag(Mesh *mesh, eMeshBatchDirtyMode mode)
 {
   if (!mesh->runtime->batch_cache) {
@@ -752,6 +769,9 @@ void DRW_mesh_batch_cache_dirty_tag(Mesh *mesh, eMeshBatchDirtyMode mode)
       batch_map = BATCH_MAP(vbo.edituv_data, vbo.fdots_edituv_data);
       mesh_batch_cache_discard_batch(cache, batch_map);
       break;
+    case BKE_MESH_BATCH_DIRTY_ATTRIBUTES:
+      mesh_batch_cache_discard_attributes(cache);
+      break;
     default:
       BLI_assert(0);
   }
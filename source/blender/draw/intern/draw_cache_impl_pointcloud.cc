@@ -254,8 +254,11 @@ static void pointcloud_extract_indices(const PointCloud &pointcloud, PointCloudB
     }
   });
 
-  GPU_indexbuf_build_in_place_ex(
-      &builder, 0, primitive_len * 3, false, cache.eval_cache.geom_indices);
+  /* Pass the actual index range so that small point clouds can use 16-bit indices. */
+  const uint32_t index_max = (pointcloud.totpoint > 0) ?
+                                 (uint32_t(pointcloud.totpoint - 1) << 3) | 4u :
+                                 0u;
+  GPU_indexbuf_build_in_place_ex(&builder, 0, index_max, false, cache.eval_cache.geom_indices);
 }
 
 static void pointcloud_extract_position_and_radius(const PointCloud &pointcloud,
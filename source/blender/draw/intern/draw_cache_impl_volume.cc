@@ -310,8 +310,10 @@ static DRWVolumeGrid *volume_grid_cache_get(const Volume *volume,
     return cache_grid;
   }
 
+  /* Grids larger than what the GPU supports are skipped before extraction, as the dense buffer
+   * can be huge for sparse volumes and would be thrown away anyway. */
   DenseFloatVolumeGrid dense_grid;
-  if (BKE_volume_grid_dense_floats(volume, grid, &dense_grid)) {
+  if (BKE_volume_grid_dense_floats(volume, grid, GPU_max_texture_3d_size(), &dense_grid)) {
     cache_grid->texture_to_object = float4x4(dense_grid.texture_to_object);
     cache_grid->object_to_texture = math::invert(cache_grid->texture_to_object);
 
@@ -674,6 +674,9 @@ void DRW_cache_free_old_batches(Main *bmain)
 
   lasttime = ctime;
 
+  /* Instances share the batch cache of their source geometry, only visit each of them once. */
+  blender::Set<const void *> visited_data;
+
   for (scene = static_cast<Scene *>(bmain->scenes.first); scene;
        scene = static_cast<Scene *>(scene->id.next))
   {
@@ -683,12 +686,13 @@ void DRW_cache_free_old_batches(Main *bmain)
         continue;
       }
 
-      /* TODO(fclem): This is not optimal since it iter over all dupli instances.
-       * In this case only the source object should be tagged. */
       DEGObjectIterSettings deg_iter_settings = {nullptr};
       deg_iter_settings.depsgraph = depsgraph;
       deg_iter_settings.flags = DEG_OBJECT_ITER_FOR_RENDER_ENGINE_FLAGS;
       DEG_OBJECT_ITER_BEGIN (&deg_iter_settings, ob) {
+        if (ob->data == nullptr || !visited_data.add(ob->data)) {
+          continue;
+        }
         DRW_batch_cache_free_old(ob, ctime);
       }
       DEG_OBJECT_ITER_END;
@@ -730,10 +734,15 @@ void DRWContext::sync(iter_callback_t iter_callback)
   ExtractionGraph extraction;
 
   /* Custom callback defines the set of object to sync. */
+  GPU_debug_group_begin("Context.object_sync");
   iter_callback(dupli_handler, extraction);
+  GPU_debug_group_end();
 
+  /* Separate group so that the batch extraction cost shows up on its own when profiling. */
+  GPU_debug_group_begin("Context.extraction");
   dupli_handler.extract_all(extraction);
   extraction.work_and_wait(this->delayed_extraction);
+  GPU_debug_group_end();
 
   DRW_manager_end_sync();
 
@@ -255,6 +255,25 @@ static void drw_deferred_queue_append(GPUMaterial *mat, bool is_optimization_job
   compiler_data().queue_cv.notify_one();
 }
 
+/**
+ * Move an already queued material to the end of the queue, so it is compiled next.
+ * Materials are requested again on every sync as long as they are used for drawing, so the
+ * materials still in use are compiled before the ones that aren't visible anymore.
+ */
+static void drw_deferred_queue_bump(GPUMaterial *mat)
+{
+  std::scoped_lock queue_lock(compiler_data().queue_mutex);
+
+  Vector<GPUMaterial *> &queue = compiler_data().queue;
+  const int64_t index = queue.first_index_of_try(mat);
+  /* Not found when the compilation thread already picked it up. */
+  if (ELEM(index, -1, queue.size() - 1)) {
+    return;
+  }
+  queue.remove(index);
+  queue.append(mat);
+}
+
 static void drw_deferred_shader_add(GPUMaterial *mat, bool deferred)
 {
   if (ELEM(GPU_material_status(mat), GPU_MAT_SUCCESS, GPU_MAT_FAILED)) {
@@ -279,6 +298,7 @@ static void drw_deferred_shader_add(GPUMaterial *mat, bool deferred)
 
   /* Don't add material to the queue twice. */
   if (GPU_material_status(mat) == GPU_MAT_QUEUED) {
+    drw_deferred_queue_bump(mat);
     return;
   }
 
@@ -295,9 +315,10 @@ void DRW_deferred_shader_remove(GPUMaterial *mat)
 
   std::scoped_lock queue_lock(compiler_data().queue_mutex);
 
-  /* Search for compilation job in queue. */
-  if (compiler_data().queue.contains(mat)) {
-    compiler_data().queue.remove_first_occurrence_and_reorder(mat);
+  /* Search for compilation job in queue. Keep the order, it defines the compilation priority. */
+  const int64_t index = compiler_data().queue.first_index_of_try(mat);
+  if (index != -1) {
+    compiler_data().queue.remove(index);
     GPU_material_status_set(mat, GPU_MAT_CREATED);
   }
 
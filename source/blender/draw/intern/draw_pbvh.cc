@@ -9,6 +9,7 @@
  * Embeds GPU meshes inside of bke::pbvh::Tree nodes, used by mesh sculpt mode.
  */
 
+#include "BLI_bit_span_ops.hh"
 #include "BLI_map.hh"
 #include "BLI_math_geom.h"
 #include "BLI_math_vector_types.hh"
@@ -1797,9 +1798,12 @@ Span<gpu::VertBuf *> DrawCacheImpl::ensure_attribute_data(const Object &object,
     }
   }
 
-  /* TODO: It would be good to deallocate the bit vector if all of the bits have been reset to
-   * avoid unnecessary processing in subsequent redraws. */
   dirty_mask.foreach_index_optimized<int>([&](const int i) { data.dirty_nodes[i].reset(); });
+  if (!dirty_mask.is_empty() && !bits::any_bit_set(data.dirty_nodes)) {
+    /* Deallocate the bits once all nodes are updated so the following redraws don't have to
+     * process them. */
+    data.dirty_nodes.clear_and_shrink();
+  }
 
   flush_vbo_data(vbos, mask);
 
@@ -9,6 +9,7 @@
 #include <ctime>
 #include <fstream>
 #include <iomanip>
+#include <mutex>
 #include <optional>
 
 #include "ED_asset_indexer.hh"
@@ -298,6 +299,8 @@ struct AssetLibraryIndex {
    * since it doesn't exist and isn't relevant to keep track of anymore.
    */
   Map<std::string /*path*/, PreexistingFileIndexInfo> preexisting_file_indices;
+  /** Protects #PreexistingFileIndexInfo.is_used, indices are read in parallel. */
+  std::mutex preexisting_file_indices_mutex;
 
   /**
    * \brief Absolute path where the indices of `library` are stored.
@@ -380,6 +383,7 @@ struct AssetLibraryIndex {
 
   void mark_as_used(const std::string &filename)
   {
+    std::scoped_lock lock(this->preexisting_file_indices_mutex);
     PreexistingFileIndexInfo *preexisting = this->preexisting_file_indices.lookup_ptr(filename);
     if (preexisting) {
       preexisting->is_used = true;
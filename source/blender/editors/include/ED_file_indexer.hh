@@ -104,6 +104,8 @@ struct FileIndexerType {
    * entries field, `r_read_entries_len` must be set to `0` and the function must return
    * `eFileIndexerResult::FILE_INDEXER_NEEDS_UPDATE`. In this case the blend file will read from
    * the blend file and the `update_index` function will be called.
+   *
+   * Can be called for multiple blend files in parallel.
    */
   FileIndexerReadIndexFunc read_index;
 
@@ -191,6 +191,19 @@ static void um_arraystore_cd_compact(CustomData *cdata,
     }
   }
 
+  /* Adding a state to an array store is the expensive part (hashing & de-duplicating chunks).
+   * Each store is only used by a single thread, so layers stored in different stores
+   * (layers with a different stride) are added in parallel, see #um_arraystore.bs_stride. */
+  struct LayerStateAdd {
+    BArrayStore *bs;
+    const void *data;
+    size_t data_size;
+    BArrayState *state_reference;
+    std::variant<BArrayState *, ImplicitSharingInfoAndData> *r_state;
+  };
+  Vector<LayerStateAdd> state_adds;
+  Vector<BArrayStore *> state_add_stores;
+
   const BArrayCustomData *bcd_reference_current = bcd_reference;
   BArrayCustomData *bcd = nullptr, *bcd_first = nullptr, *bcd_prev = nullptr;
   for (int layer_start = 0, layer_end; layer_start < cdata->totlayer; layer_start = layer_end) {
@@ -282,25 +295,15 @@ static void um_arraystore_cd_compact(CustomData *cdata,
               state_reference = std::get<BArrayState *>(bcd_reference_current->states[i]);
             }
 
-            bcd->states[i] = BLI_array_store_state_add(
-                bs, layer->data, size_t(data_len) * stride, state_reference);
+            state_adds.append(
+                {bs, layer->data, size_t(data_len) * stride, state_reference, &bcd->states[i]});
+            state_add_stores.append_non_duplicates(bs);
           }
         }
         else {
           bcd->states[i] = nullptr;
         }
       }
-
-      if (layer->data) {
-        if (layer->sharing_info) {
-          layer->sharing_info->remove_user_and_delete_if_last();
-          layer->sharing_info = nullptr;
-          layer->data = nullptr;
-        }
-        else {
-          MEM_SAFE_FREE(layer->data);
-        }
-      }
     }
 
     if (create) {
@@ -310,6 +313,31 @@ static void um_arraystore_cd_compact(CustomData *cdata,
     }
   }
 
+  threading::parallel_for(state_add_stores.index_range(), 1, [&](const IndexRange range) {
+    for (BArrayStore *bs : state_add_stores.as_span().slice(range)) {
+      for (const LayerStateAdd &state_add : state_adds) {
+        if (state_add.bs == bs) {
+          *state_add.r_state = BLI_array_store_state_add(
+              bs, state_add.data, state_add.data_size, state_add.state_reference);
+        }
+      }
+    }
+  });
+
+  /* Free the layers once all states have been added, the layer data is no longer needed. */
+  for (CustomDataLayer &layer : MutableSpan(cdata->layers, cdata->totlayer)) {
+    if (layer.data) {
+      if (layer.sharing_info) {
+        layer.sharing_info->remove_user_and_delete_if_last();
+        layer.sharing_info = nullptr;
+        layer.data = nullptr;
+      }
+      else {
+        MEM_SAFE_FREE(layer.data);
+      }
+    }
+  }
+
   if (create) {
     *r_bcd_first = bcd_first;
   }
@@ -388,9 +416,8 @@ static void um_arraystore_compact_ex(UndoMesh *um, const UndoMesh *um_ref, bool
 
   /* Compacting can be time consuming, run in parallel.
    *
-   * NOTE(@ideasman42): this could be further parallelized with every custom-data layer
-   * running in its own thread. If this is a bottleneck it's worth considering.
-   * At the moment it seems fast enough to split by domain.
+   * Each domain runs in its own task, within a domain the layers are split further
+   * by the array store they use (see #um_arraystore_cd_compact).
    * Since this is itself a background thread, using too many threads here could
    * interfere with foreground tasks. */
   blender::threading::parallel_invoke(
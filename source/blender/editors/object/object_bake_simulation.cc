@@ -8,6 +8,7 @@
 #include "BLI_listbase.h"
 #include "BLI_path_utils.hh"
 #include "BLI_string.h"
+#include "BLI_task.h"
 #include "BLI_vector.hh"
 
 #include "BLT_translation.hh"
@@ -244,6 +245,39 @@ static void clear_requested_bakes_in_modifier_cache(BakeGeometryNodesJob &job)
   }
 }
 
+/**
+ * Writes a baked frame to disk. This runs in a background task, so that the next frame can be
+ * evaluated at the same time. The frame cache stays alive until the bake job ends.
+ */
+struct DiskFrameWriteTask {
+  NodeBakeRequest *request;
+  const bake::FrameCache *frame_cache;
+  std::string frame_file_name;
+  int64_t *written_size;
+};
+
+static void write_frame_to_disk_task(TaskPool *__restrict /*pool*/, void *taskdata)
+{
+  const DiskFrameWriteTask &task = *static_cast<DiskFrameWriteTask *>(taskdata);
+  const bake::BakePath &path = *task.request->path;
+
+  char meta_path[FILE_MAX];
+  const std::string meta_file_name = task.frame_file_name + ".json";
+  BLI_path_join(meta_path, sizeof(meta_path), path.meta_dir.c_str(), meta_file_name.c_str());
+  BLI_file_ensure_parent_dir_exists(meta_path);
+  bake::DiskBlobWriter blob_writer{path.blobs_dir, task.frame_file_name};
+  fstream meta_file{meta_path, std::ios::out};
+  bake::serialize_bake(
+      task.frame_cache->state, blob_writer, *task.request->blob_sharing, meta_file);
+  *task.written_size += blob_writer.written_size();
+  *task.written_size += meta_file.tellp();
+}
+
+static void free_frame_write_task(TaskPool *__restrict /*pool*/, void *taskdata)
+{
+  MEM_delete(static_cast<DiskFrameWriteTask *>(taskdata));
+}
+
 static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *worker_status)
 {
   BakeGeometryNodesJob &job = *static_cast<BakeGeometryNodesJob *>(customdata);
@@ -278,7 +312,15 @@ static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *wo
   };
 
   Map<NodeBakeRequest *, PackedBake> packed_data_by_bake;
+  /* Add all sizes in advance, so that pointers to them stay valid while frames are written. */
   Map<NodeBakeRequest *, int64_t> size_by_bake;
+  for (NodeBakeRequest &request : job.bake_requests) {
+    size_by_bake.add(&request, 0);
+  }
+
+  /* Frames are written in order, because the blob sharing of a bake is not thread-safe and later
+   * frames may reference data written by earlier frames. */
+  TaskPool *write_pool = BLI_task_pool_create_background_serial(nullptr, TASK_PRIORITY_LOW);
 
   for (float frame_f = global_bake_start_frame; frame_f <= global_bake_end_frame;
        frame_f += frame_step_size)
@@ -315,20 +357,13 @@ static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *wo
         continue;
       }
 
-      int64_t &written_size = size_by_bake.lookup_or_add(&request, 0);
+      int64_t &written_size = size_by_bake.lookup(&request);
 
       if (request.path.has_value()) {
-        char meta_path[FILE_MAX];
-        BLI_path_join(meta_path,
-                      sizeof(meta_path),
-                      request.path->meta_dir.c_str(),
-                      (frame_file_name + ".json").c_str());
-        BLI_file_ensure_parent_dir_exists(meta_path);
-        bake::DiskBlobWriter blob_writer{request.path->blobs_dir, frame_file_name};
-        fstream meta_file{meta_path, std::ios::out};
-        bake::serialize_bake(frame_cache.state, blob_writer, *request.blob_sharing, meta_file);
-        written_size += blob_writer.written_size();
-        written_size += meta_file.tellp();
+        DiskFrameWriteTask *task = MEM_new<DiskFrameWriteTask>(
+            __func__, &request, &frame_cache, frame_file_name, &written_size);
+        BLI_task_pool_push(
+            write_pool, write_frame_to_disk_task, task, false, free_frame_write_task);
       }
       else {
         PackedBake &packed_data = packed_data_by_bake.lookup_or_add_default(&request);
@@ -356,6 +391,9 @@ static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *wo
     worker_status->do_update = true;
   }
 
+  BLI_task_pool_work_and_wait(write_pool);
+  BLI_task_pool_free(write_pool);
+
   /* Update bake sizes. */
   for (NodeBakeRequest &request : job.bake_requests) {
     NodesModifierBake *bake = request.nmd->find_bake(request.bake_id);
@@ -379,29 +379,32 @@ static void dilate(ImageBufferAccessor &buffer, int iterations = 1)
 {
   const MutableSpan<ColorGeometry4b> pixels = buffer.pixels();
 
-  blender::Stack<int> active_pixels;
   for ([[maybe_unused]] const int iter : IndexRange(iterations)) {
-    for (const int i : pixels.index_range()) {
-      /* Ignore already filled pixels */
-      if (get_flag(pixels[i], ColorFlag::Fill)) {
-        continue;
-      }
-      const int2 coord = buffer.coord_from_index(i);
-
-      /* Add to stack if any neighbor is filled. */
-      for (const int2 offset : offset_by_direction) {
-        if (buffer.is_valid_coord(coord + offset) &&
-            get_flag(buffer.pixel_from_coord(coord + offset), ColorFlag::Fill))
-        {
-          active_pixels.push(i);
-        }
-      }
-    }
+    /* Find all pixels to change first, so that the result of one iteration does not depend on the
+     * order in which pixels are processed. Both passes are independent per pixel. */
+    IndexMaskMemory memory;
+    const IndexMask active_pixels = IndexMask::from_predicate(
+        pixels.index_range(), GrainSize(4096), memory, [&](const int i) {
+          /* Ignore already filled pixels */
+          if (get_flag(pixels[i], ColorFlag::Fill)) {
+            return false;
+          }
+          const int2 coord = buffer.coord_from_index(i);
+
+          /* Activate if any neighbor is filled. */
+          for (const int2 offset : offset_by_direction) {
+            if (buffer.is_valid_coord(coord + offset) &&
+                get_flag(buffer.pixel_from_coord(coord + offset), ColorFlag::Fill))
+            {
+              return true;
+            }
+          }
+          return false;
+        });
 
-    while (!active_pixels.is_empty()) {
-      const int index = active_pixels.pop();
-      set_flag(buffer.pixels()[index], ColorFlag::Fill, true);
-    }
+    active_pixels.foreach_index(GrainSize(4096), [&](const int index) {
+      set_flag(pixels[index], ColorFlag::Fill, true);
+    });
   }
 }
 
@@ -409,29 +412,30 @@ static void erode(ImageBufferAccessor &buffer, int iterations = 1)
 {
   const MutableSpan<ColorGeometry4b> pixels = buffer.pixels();
 
-  blender::Stack<int> active_pixels;
   for ([[maybe_unused]] const int iter : IndexRange(iterations)) {
-    for (const int i : pixels.index_range()) {
-      /* Ignore empty pixels */
-      if (!get_flag(pixels[i], ColorFlag::Fill)) {
-        continue;
-      }
-      const int2 coord = buffer.coord_from_index(i);
-
-      /* Add to stack if any neighbor is empty. */
-      for (const int2 offset : offset_by_direction) {
-        if (buffer.is_valid_coord(coord + offset) &&
-            !get_flag(buffer.pixel_from_coord(coord + offset), ColorFlag::Fill))
-        {
-          active_pixels.push(i);
-        }
-      }
-    }
+    IndexMaskMemory memory;
+    const IndexMask active_pixels = IndexMask::from_predicate(
+        pixels.index_range(), GrainSize(4096), memory, [&](const int i) {
+          /* Ignore empty pixels */
+          if (!get_flag(pixels[i], ColorFlag::Fill)) {
+            return false;
+          }
+          const int2 coord = buffer.coord_from_index(i);
+
+          /* Activate if any neighbor is empty. */
+          for (const int2 offset : offset_by_direction) {
+            if (buffer.is_valid_coord(coord + offset) &&
+                !get_flag(buffer.pixel_from_coord(coord + offset), ColorFlag::Fill))
+            {
+              return true;
+            }
+          }
+          return false;
+        });
 
-    while (!active_pixels.is_empty()) {
-      const int index = active_pixels.pop();
-      set_flag(buffer.pixels()[index], ColorFlag::Fill, false);
-    }
+    active_pixels.foreach_index(GrainSize(4096), [&](const int index) {
+      set_flag(pixels[index], ColorFlag::Fill, false);
+    });
   }
 }
 
@@ -1995,7 +1995,7 @@ static void vpaint_stroke_update_step(bContext *C,
 
   swap_m4m4(vc.rv3d->persmat, mat);
 
-  BKE_mesh_batch_cache_dirty_tag((Mesh *)ob.data, BKE_MESH_BATCH_DIRTY_ALL);
+  BKE_mesh_batch_cache_dirty_tag((Mesh *)ob.data, BKE_MESH_BATCH_DIRTY_ATTRIBUTES);
 
   Brush &brush = *BKE_paint_brush(&vp.paint);
   if (brush.vertex_brush_type == VPAINT_BRUSH_TYPE_SMEAR) {
@@ -2262,7 +2262,7 @@ static bool fill_active_color(Object &ob,
   DEG_id_tag_update(&mesh->id, ID_RECALC_SYNC_TO_EVAL);
 
   /* NOTE: Original mesh is used for display, so tag it directly here. */
-  BKE_mesh_batch_cache_dirty_tag(mesh, BKE_MESH_BATCH_DIRTY_ALL);
+  BKE_mesh_batch_cache_dirty_tag(mesh, BKE_MESH_BATCH_DIRTY_ATTRIBUTES);
 
   return true;
 }
@@ -7,6 +7,7 @@
  */
 
 #include "BLI_array.hh"
+#include "BLI_enumerable_thread_specific.hh"
 #include "BLI_index_range.hh"
 #include "BLI_math_base.h"
 #include "BLI_math_base.hh"
@@ -1330,48 +1331,67 @@ static void init_boundary_masking_mesh(Object &object,
   const int num_verts = bke::pbvh::vert_positions_eval(depsgraph, object).size();
   Array<int> edge_distance(num_verts, EDGE_DISTANCE_INF);
 
-  for (const int i : IndexRange(num_verts)) {
-    switch (mode) {
-      case BoundaryAutomaskMode::Edges:
-        if (boundary::vert_is_boundary(vert_to_face_map, hide_poly, ss.vertex_info.boundary, i)) {
-          edge_distance[i] = 0;
-        }
-        break;
-      case BoundaryAutomaskMode::FaceSets:
-        if (!face_set::vert_has_unique_face_set(vert_to_face_map, face_sets, i)) {
-          edge_distance[i] = 0;
-        }
-        break;
+  threading::parallel_for(IndexRange(num_verts), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      switch (mode) {
+        case BoundaryAutomaskMode::Edges:
+          if (boundary::vert_is_boundary(vert_to_face_map, hide_poly, ss.vertex_info.boundary, i))
+          {
+            edge_distance[i] = 0;
+          }
+          break;
+        case BoundaryAutomaskMode::FaceSets:
+          if (!face_set::vert_has_unique_face_set(vert_to_face_map, face_sets, i)) {
+            edge_distance[i] = 0;
+          }
+          break;
+      }
     }
-  }
+  });
 
-  Vector<int> neighbors;
+  /* Vertices reached in a propagation step are gathered first and only written afterwards, so
+   * that the parallel neighbor lookups only read distances from previous steps. */
+  threading::EnumerableThreadSpecific<Vector<int>> all_reached_verts;
   for (const int propagation_it : IndexRange(propagation_steps)) {
-    for (const int i : IndexRange(num_verts)) {
-      if (edge_distance[i] != EDGE_DISTANCE_INF) {
-        continue;
-      }
+    threading::parallel_for(IndexRange(num_verts), 1024, [&](const IndexRange range) {
+      Vector<int> &reached_verts = all_reached_verts.local();
+      Vector<int> neighbors;
+      for (const int i : range) {
+        if (edge_distance[i] != EDGE_DISTANCE_INF) {
+          continue;
+        }
 
-      for (const int neighbor :
-           vert_neighbors_get_mesh(faces, corner_verts, vert_to_face_map, hide_poly, i, neighbors))
-      {
-        if (edge_distance[neighbor] == propagation_it) {
-          edge_distance[i] = propagation_it + 1;
+        for (const int neighbor : vert_neighbors_get_mesh(
+                 faces, corner_verts, vert_to_face_map, hide_poly, i, neighbors))
+        {
+          if (edge_distance[neighbor] == propagation_it) {
+            reached_verts.append(i);
+            break;
+          }
         }
       }
+    });
+
+    for (Vector<int> &reached_verts : all_reached_verts) {
+      for (const int i : reached_verts) {
+        edge_distance[i] = propagation_it + 1;
+      }
+      reached_verts.clear();
     }
   }
 
-  for (const int i : IndexRange(num_verts)) {
-    if (edge_distance[i] == EDGE_DISTANCE_INF) {
-      continue;
-    }
+  threading::parallel_for(IndexRange(num_verts), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      if (edge_distance[i] == EDGE_DISTANCE_INF) {
+        continue;
+      }
 
-    const float p = 1.0f - (float(edge_distance[i]) / float(propagation_steps));
-    const float edge_boundary_automask = pow2f(p);
+      const float p = 1.0f - (float(edge_distance[i]) / float(propagation_steps));
+      const float edge_boundary_automask = pow2f(p);
 
-    factors[i] *= (1.0f - edge_boundary_automask);
-  }
+      factors[i] *= (1.0f - edge_boundary_automask);
+    }
+  });
 }
 
 static void init_boundary_masking_grids(Object &object,
@@ -1768,7 +1788,7 @@ void Cache::calc_cavity_factor(const Depsgraph &depsgraph,
     case bke::pbvh::Type::BMesh: {
       const Span<bke::pbvh::BMeshNode> nodes = pbvh.nodes<bke::pbvh::BMeshNode>();
       node_mask.foreach_index(GrainSize(1), [&](const int i) {
-        const Set<BMVert *, 0> verts = nodes[i].bm_unique_verts_;
+        const Set<BMVert *, 0> &verts = nodes[i].bm_unique_verts_;
         for (BMVert *vert : verts) {
           calc_cavity_factor_bmesh(*this, vert, BM_elem_index_get(vert));
         }
@@ -1182,8 +1182,9 @@ static void store_positions_mesh(const Depsgraph &depsgraph, const Object &objec
                                                                   mesh.verts_num) :
                                                              mesh.vert_positions();
 
-    gather_data_mesh(
-        orig_positions, unode.vert_indices.as_span(), unode.orig_position.as_mutable_span());
+    gather_data_mesh(orig_positions,
+                     unode.vert_indices.as_span().take_front(unode.unique_verts_num),
+                     unode.orig_position.as_mutable_span());
   }
 }
 
@@ -1335,7 +1336,8 @@ static void fill_node_data_mesh(const Depsgraph &depsgraph,
       /* Needed for original data lookup. */
       unode.normal.reinitialize(verts_num);
       if (ss.deform_modifiers_active) {
-        unode.orig_position.reinitialize(verts_num);
+        /* Only used for restoring, which only writes the node's unique vertices. */
+        unode.orig_position.reinitialize(unode.unique_verts_num);
       }
       store_positions_mesh(depsgraph, object, unode);
       break;
@@ -1798,10 +1800,29 @@ void push_end_ex(Object &ob, const bool use_nested_undo)
   for (std::unique_ptr<Node> &unode : step_data->nodes) {
     unode->normal = {};
   }
-  /* TODO: When #Node.orig_positions is stored, #Node.positions is unnecessary, don't keep it in
-   * the stored undo step. In the future the stored undo step should use a different format with
-   * just one positions array that has a different semantic meaning depending on whether there are
-   * deform modifiers. */
+
+  /* Positions of all the node's vertices are only needed for original data lookups during the
+   * stroke. Restoring mesh positions only writes the unique vertices of each node, and uses
+   * #Node.orig_position instead of #Node.position when it is stored. In the future the stored undo
+   * step should use a different format with just one positions array that has a different
+   * semantic meaning depending on whether there are deform modifiers. */
+  if (step_data->type == Type::Position) {
+    threading::parallel_for(step_data->nodes.index_range(), 16, [&](const IndexRange range) {
+      for (const int i : range) {
+        Node &unode = *step_data->nodes[i];
+        if (!unode.grids.is_empty()) {
+          continue;
+        }
+        if (!unode.orig_position.is_empty()) {
+          unode.position = {};
+        }
+        else if (unode.position.size() > unode.unique_verts_num) {
+          unode.position = Array<float3, 0>(unode.position.as_span().take_front(
+              unode.unique_verts_num));
+        }
+      }
+    });
+  }
 
   step_data->undo_size = threading::parallel_reduce(
       step_data->nodes.index_range(),
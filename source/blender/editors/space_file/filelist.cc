@@ -14,6 +14,7 @@
 #include <ctime>
 #include <memory>
 #include <optional>
+#include <string>
 #include <sys/stat.h>
 
 #ifndef WIN32
@@ -30,20 +31,24 @@
 
 #include "BLF_api.hh"
 
+#include "BLI_array.hh"
 #include "BLI_fileops.h"
 #include "BLI_fileops_types.h"
 #include "BLI_fnmatch.h"
 #include "BLI_ghash.h"
 #include "BLI_linklist.h"
 #include "BLI_listbase.h"
+#include "BLI_map.hh"
 #include "BLI_math_vector.h"
 #include "BLI_path_utils.hh"
 #include "BLI_stack.h"
 #include "BLI_string.h"
 #include "BLI_string_utils.hh"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #ifdef WIN32
 #  include "BLI_winstuff.h"
@@ -3338,33 +3343,68 @@ static int filelist_readjob_list_lib_populate_from_index(FileListReadJob *job_pa
 }
 
 /**
- * \return The number of entries found if the \a root path points to a valid library file.
- *         Otherwise returns no value (#std::nullopt).
+ * A group of data-blocks in a library file, see #FileListLibReadData.
  */
-static std::optional<int> filelist_readjob_list_lib(FileListReadJob *job_params,
-                                                    const char *root,
-                                                    ListBase *entries,
-                                                    const ListLibOptions options,
-                                                    FileIndexer *indexer_runtime)
+struct FileListLibGroup {
+  std::string name;
+  int idcode;
+  /** #BLODataBlockInfo of the group, only read when the data-blocks are listed. */
+  LinkNode *datablock_infos = nullptr;
+  int datablock_len = 0;
+};
+
+/**
+ * Content of a library file, read by #filelist_readjob_list_lib_read. Reading doesn't depend on
+ * the state of the read job, so multiple libraries can be read in parallel. The file list entries
+ * are created afterwards by #filelist_readjob_list_lib_populate.
+ */
+struct FileListLibReadData {
+  char dir[FILE_MAX_LIBEXTRA];
+  /** The root path contains an ID group (e.g. "Materials" or "Objects"). */
+  std::optional<std::string> group;
+
+  /** When true, the entries were read from the index and the library file wasn't opened. */
+  bool is_from_index = false;
+  int read_from_index = 0;
+  FileIndexerEntries indexer_entries = {nullptr};
+
+  /** Groups read from the library file, a single one when listing inside of #group. */
+  Vector<FileListLibGroup> groups;
+
+  ~FileListLibReadData()
+  {
+    for (FileListLibGroup &lib_group : this->groups) {
+      BLO_datablock_info_linklist_free(lib_group.datablock_infos);
+    }
+    ED_file_indexer_entries_clear(&this->indexer_entries);
+  }
+};
+
+/**
+ * Read the index or otherwise the content of the library file that \a root points to.
+ *
+ * \return Nothing if \a root doesn't point to a valid library file.
+ */
+static std::unique_ptr<FileListLibReadData> filelist_readjob_list_lib_read(
+    const char *root, const ListLibOptions options, FileIndexer *indexer_runtime)
 {
   BLI_assert(indexer_runtime);
 
-  char dir[FILE_MAX_LIBEXTRA], *group;
-
-  BlendHandle *libfiledata = nullptr;
+  std::unique_ptr<FileListLibReadData> lib_data = std::make_unique<FileListLibReadData>();
+  char *group;
 
   /* Check if the given root is actually a library. All folders are passed to
    * `filelist_readjob_list_lib` and based on the number of found entries `filelist_readjob_do`
    * will do a dir listing only when this function does not return any entries. */
   /* TODO(jbakker): We should consider introducing its own function to detect if it is a lib and
    * call it directly from `filelist_readjob_do` to increase readability. */
-  const bool is_lib = BKE_blendfile_library_path_explode(root, dir, &group, nullptr);
+  const bool is_lib = BKE_blendfile_library_path_explode(root, lib_data->dir, &group, nullptr);
   if (!is_lib) {
-    return std::nullopt;
+    return nullptr;
+  }
+  if (group != nullptr) {
+    lib_data->group = group;
   }
-
-  /* The root path contains an ID group (e.g. "Materials" or "Objects"). */
-  const bool has_group = group != nullptr;
 
   /* Try read from indexer_runtime. */
   /* Indexing returns all entries in a blend file. We should ignore the index when listing a group
@@ -3374,25 +3414,71 @@ static std::optional<int> filelist_readjob_list_lib(FileListReadJob *job_params,
    *
    * Adding support for partial reading/updating indexes would increase the complexity.
    */
-  const bool use_indexer = !has_group;
-  FileIndexerEntries indexer_entries = {nullptr};
-  if (use_indexer) {
-    int read_from_index = 0;
+  if (!lib_data->group) {
     eFileIndexerResult indexer_result = indexer_runtime->callbacks->read_index(
-        dir, &indexer_entries, &read_from_index, indexer_runtime->user_data);
+        lib_data->dir,
+        &lib_data->indexer_entries,
+        &lib_data->read_from_index,
+        indexer_runtime->user_data);
     if (indexer_result == FILE_INDEXER_ENTRIES_LOADED) {
-      int entries_read = filelist_readjob_list_lib_populate_from_index(
-          job_params, entries, options, read_from_index, &indexer_entries);
-      ED_file_indexer_entries_clear(&indexer_entries);
-      return entries_read;
+      lib_data->is_from_index = true;
+      return lib_data;
     }
   }
 
   /* Open the library file. */
   BlendFileReadReport bf_reports{};
-  libfiledata = BLO_blendhandle_from_file(dir, &bf_reports);
+  BlendHandle *libfiledata = BLO_blendhandle_from_file(lib_data->dir, &bf_reports);
   if (libfiledata == nullptr) {
-    return std::nullopt;
+    return nullptr;
+  }
+
+  const bool assets_only = options & LIST_LIB_ASSETS_ONLY;
+  /* Read only the datablocks from this group. */
+  if (lib_data->group) {
+    FileListLibGroup &lib_group = lib_data->groups.append_as();
+    lib_group.name = *lib_data->group;
+    lib_group.idcode = groupname_to_code(lib_group.name.c_str());
+    lib_group.datablock_infos = BLO_blendhandle_get_datablock_info(
+        libfiledata, lib_group.idcode, assets_only, &lib_group.datablock_len);
+  }
+  /* Read all datablocks from all groups. */
+  else {
+    LinkNode *groups = BLO_blendhandle_get_linkable_groups(libfiledata);
+
+    for (LinkNode *ln = groups; ln; ln = ln->next) {
+      FileListLibGroup &lib_group = lib_data->groups.append_as();
+      lib_group.name = static_cast<char *>(ln->link);
+      lib_group.idcode = groupname_to_code(lib_group.name.c_str());
+
+      if (options & LIST_LIB_RECURSIVE) {
+        lib_group.datablock_infos = BLO_blendhandle_get_datablock_info(
+            libfiledata, lib_group.idcode, assets_only, &lib_group.datablock_len);
+      }
+    }
+
+    BLI_linklist_freeN(groups);
+  }
+
+  BLO_blendhandle_close(libfiledata);
+
+  return lib_data;
+}
+
+/**
+ * Create the file list entries for a library read by #filelist_readjob_list_lib_read.
+ *
+ * \return The number of entries added to \a entries.
+ */
+static int filelist_readjob_list_lib_populate(FileListReadJob *job_params,
+                                              ListBase *entries,
+                                              const ListLibOptions options,
+                                              FileListLibReadData &lib_data,
+                                              FileIndexer *indexer_runtime)
+{
+  if (lib_data.is_from_index) {
+    return filelist_readjob_list_lib_populate_from_index(
+        job_params, entries, options, lib_data.read_from_index, &lib_data.indexer_entries);
   }
 
   /* Add current parent when requested. */
@@ -3409,51 +3495,40 @@ static std::optional<int> filelist_readjob_list_lib(FileListReadJob *job_params,
 
   int group_len = 0;
   int datablock_len = 0;
-  /* Read only the datablocks from this group. */
-  if (has_group) {
-    const int idcode = groupname_to_code(group);
-    LinkNode *datablock_infos = BLO_blendhandle_get_datablock_info(
-        libfiledata, idcode, options & LIST_LIB_ASSETS_ONLY, &datablock_len);
-    filelist_readjob_list_lib_add_datablocks(
-        job_params, entries, datablock_infos, false, idcode, group);
-    BLO_datablock_info_linklist_free(datablock_infos);
+  if (lib_data.group) {
+    const FileListLibGroup &lib_group = lib_data.groups.first();
+    filelist_readjob_list_lib_add_datablocks(job_params,
+                                             entries,
+                                             lib_group.datablock_infos,
+                                             false,
+                                             lib_group.idcode,
+                                             lib_group.name.c_str());
+    datablock_len = lib_group.datablock_len;
   }
-  /* Read all datablocks from all groups. */
   else {
-    LinkNode *groups = BLO_blendhandle_get_linkable_groups(libfiledata);
-    group_len = BLI_linklist_count(groups);
+    group_len = lib_data.groups.size();
 
-    for (LinkNode *ln = groups; ln; ln = ln->next) {
-      const char *group_name = static_cast<char *>(ln->link);
-      const int idcode = groupname_to_code(group_name);
+    for (const FileListLibGroup &lib_group : lib_data.groups) {
       FileListInternEntry *group_entry = filelist_readjob_list_lib_group_create(
-          job_params, idcode, group_name);
+          job_params, lib_group.idcode, lib_group.name.c_str());
       BLI_addtail(entries, group_entry);
 
       if (options & LIST_LIB_RECURSIVE) {
-        int group_datablock_len;
-        LinkNode *group_datablock_infos = BLO_blendhandle_get_datablock_info(
-            libfiledata, idcode, options & LIST_LIB_ASSETS_ONLY, &group_datablock_len);
-        filelist_readjob_list_lib_add_datablocks(
-            job_params, entries, group_datablock_infos, true, idcode, group_name);
-        if (use_indexer) {
-          ED_file_indexer_entries_extend_from_datablock_infos(
-              &indexer_entries, group_datablock_infos, idcode);
-        }
-        BLO_datablock_info_linklist_free(group_datablock_infos);
-        datablock_len += group_datablock_len;
+        filelist_readjob_list_lib_add_datablocks(job_params,
+                                                 entries,
+                                                 lib_group.datablock_infos,
+                                                 true,
+                                                 lib_group.idcode,
+                                                 lib_group.name.c_str());
+        ED_file_indexer_entries_extend_from_datablock_infos(
+            &lib_data.indexer_entries, lib_group.datablock_infos, lib_group.idcode);
+        datablock_len += lib_group.datablock_len;
       }
     }
 
-    BLI_linklist_freeN(groups);
-  }
-
-  BLO_blendhandle_close(libfiledata);
-
-  /* Update the index. */
-  if (use_indexer) {
-    indexer_runtime->callbacks->update_index(dir, &indexer_entries, indexer_runtime->user_data);
-    ED_file_indexer_entries_clear(&indexer_entries);
+    /* Update the index. */
+    indexer_runtime->callbacks->update_index(
+        lib_data.dir, &lib_data.indexer_entries, indexer_runtime->user_data);
   }
 
   /* Return the number of items added to entries. */
@@ -3461,6 +3536,67 @@ static std::optional<int> filelist_readjob_list_lib(FileListReadJob *job_params,
   return added_entries_len;
 }
 
+/**
+ * Libraries read in advance by #filelist_readjob_list_libs_prefetch, by path.
+ * A null value means the path is not a valid library.
+ */
+using FileListLibPrefetch = Map<std::string, std::unique_ptr<FileListLibReadData>>;
+
+/**
+ * \return The number of entries found if the \a root path points to a valid library file.
+ *         Otherwise returns no value (#std::nullopt).
+ */
+static std::optional<int> filelist_readjob_list_lib(FileListReadJob *job_params,
+                                                    const char *root,
+                                                    ListBase *entries,
+                                                    const ListLibOptions options,
+                                                    FileIndexer *indexer_runtime,
+                                                    FileListLibPrefetch &prefetched_libs)
+{
+  std::unique_ptr<FileListLibReadData> lib_data;
+  if (std::optional<std::unique_ptr<FileListLibReadData>> prefetched = prefetched_libs.pop_try(
+          root))
+  {
+    lib_data = std::move(*prefetched);
+  }
+  else {
+    lib_data = filelist_readjob_list_lib_read(root, options, indexer_runtime);
+  }
+  if (!lib_data) {
+    return std::nullopt;
+  }
+  return filelist_readjob_list_lib_populate(
+      job_params, entries, options, *lib_data, indexer_runtime);
+}
+
+/**
+ * Read the library files in \a lib_paths in parallel, so that listing a directory with many
+ * libraries doesn't wait for each of them to be opened one after the other.
+ */
+static void filelist_readjob_list_libs_prefetch(Span<std::string> lib_paths,
+                                                const ListLibOptions options,
+                                                FileIndexer *indexer_runtime,
+                                                const bool *stop,
+                                                FileListLibPrefetch &prefetched_libs)
+{
+  Array<std::unique_ptr<FileListLibReadData>> lib_datas(lib_paths.size());
+  threading::parallel_for(lib_paths.index_range(), 1, [&](const IndexRange range) {
+    for (const int i : range) {
+      if (*stop) {
+        return;
+      }
+      lib_datas[i] = filelist_readjob_list_lib_read(
+          lib_paths[i].c_str(), options, indexer_runtime);
+    }
+  });
+  if (*stop) {
+    return;
+  }
+  for (const int i : lib_paths.index_range()) {
+    prefetched_libs.add(lib_paths[i], std::move(lib_datas[i]));
+  }
+}
+
 #if 0
 /* Kept for reference here, in case we want to add back that feature later.
  * We do not need it currently. */
@@ -3725,6 +3861,19 @@ static void filelist_readjob_recursive_dir_add_items(const bool do_lib,
   if (indexer_runtime.callbacks->init_user_data) {
     indexer_runtime.user_data = indexer_runtime.callbacks->init_user_data(dir, sizeof(dir));
   }
+  FileListLibPrefetch prefetched_libs;
+
+  /* Libraries are loaded recursively when max_recursion is set. It doesn't check if there is
+   * still a recursion level over. */
+  ListLibOptions list_lib_base_options = LIST_LIB_OPTION_NONE;
+  if (max_recursion > 0) {
+    list_lib_base_options |= LIST_LIB_RECURSIVE;
+  }
+  /* Only load assets when browsing an asset library. For normal file browsing we return all
+   * entries. `FLF_ASSETS_ONLY` filter can be enabled/disabled by the user. */
+  if (job_params->load_asset_library) {
+    list_lib_base_options |= LIST_LIB_ASSETS_ONLY;
+  }
 
   while (!BLI_stack_is_empty(todo_dirs) && !(*stop)) {
     int entries_num = 0;
@@ -3756,23 +3905,13 @@ static void filelist_readjob_recursive_dir_add_items(const bool do_lib,
 
     bool is_lib = false;
     if (do_lib) {
-      ListLibOptions list_lib_options = LIST_LIB_OPTION_NONE;
+      ListLibOptions list_lib_options = list_lib_base_options;
       if (!skip_currpar) {
         list_lib_options |= LIST_LIB_ADD_PARENT;
       }
 
-      /* Libraries are loaded recursively when max_recursion is set. It doesn't check if there is
-       * still a recursion level over. */
-      if (max_recursion > 0) {
-        list_lib_options |= LIST_LIB_RECURSIVE;
-      }
-      /* Only load assets when browsing an asset library. For normal file browsing we return all
-       * entries. `FLF_ASSETS_ONLY` filter can be enabled/disabled by the user. */
-      if (job_params->load_asset_library) {
-        list_lib_options |= LIST_LIB_ASSETS_ONLY;
-      }
       std::optional<int> lib_entries_num = filelist_readjob_list_lib(
-          job_params, subdir, &entries, list_lib_options, &indexer_runtime);
+          job_params, subdir, &entries, list_lib_options, &indexer_runtime, prefetched_libs);
       if (lib_entries_num) {
         is_lib = true;
         entries_num += *lib_entries_num;
@@ -3789,6 +3928,7 @@ static void filelist_readjob_recursive_dir_add_items(const bool do_lib,
                                               skip_currpar);
     }
 
+    Vector<std::string> lib_paths;
     LISTBASE_FOREACH (FileListInternEntry *, entry, &entries) {
       entry->uid = filelist_uid_generate(filelist);
       entry->name = fileentry_uiname(root, entry, dir);
@@ -3806,9 +3946,21 @@ static void filelist_readjob_recursive_dir_add_items(const bool do_lib,
         td_dir->level = recursion_level + 1;
         td_dir->dir = BLI_strdup(dir);
         dirs_todo_count++;
+
+        if (do_lib && (entry->typeflag & (FILE_TYPE_BLENDER | FILE_TYPE_BLENDER_BACKUP))) {
+          lib_paths.append(dir);
+        }
       }
     }
 
+    /* Opening library files is the slow part of listing directories with many of them, especially
+     * on network drives. Read them all at once, the entries are still created in listing order
+     * when they are popped from the todo list. */
+    if (lib_paths.size() > 1) {
+      filelist_readjob_list_libs_prefetch(
+          lib_paths, list_lib_base_options, &indexer_runtime, stop, prefetched_libs);
+    }
+
     if (filelist_readjob_append_entries(job_params, &entries, entries_num)) {
       *do_update = true;
     }
@@ -352,6 +352,10 @@ static void compo_completejob(void *cjv)
   Scene *scene = cj->scene;
   BKE_callback_exec_id(bmain, &scene->id, BKE_CB_EVT_COMPOSITE_POST);
 
+  if (G.debug & G_DEBUG_JOBS) {
+    cj->profiler.print_nodes_evaluation_times(*cj->ntree);
+  }
+
   scene->runtime->compositor.per_node_execution_time = cj->profiler.get_nodes_evaluation_times();
 }
 
@@ -175,7 +175,9 @@ class TreeDisplayLibraries final : public AbstractTreeDisplay {
   ListBase build_tree(const TreeSourceData &source_data) override;
 
  private:
-  TreeElement *add_library_contents(Main &, ListBase &, Library *);
+  struct MainIDLists;
+
+  TreeElement *add_library_contents(const MainIDLists &id_lists, ListBase &, Library *);
   bool library_id_filter_poll(const Library *lib, ID *id) const;
   short id_filter_get() const;
 };
@@ -6,8 +6,11 @@
  * \ingroup spoutliner
  */
 
+#include "BLI_array.hh"
 #include "BLI_listbase.h"
 #include "BLI_listbase_wrapper.hh"
+#include "BLI_map.hh"
+#include "BLI_vector.hh"
 
 #include "BKE_collection.hh"
 #include "BKE_library.hh"
@@ -26,6 +29,17 @@ namespace blender::ed::outliner {
 
 template<typename T> using List = ListBaseWrapper<T>;
 
+/**
+ * The #Main lists to display, with their IDs grouped by library. Gathered once per tree build,
+ * so adding the contents of a library doesn't have to iterate over the IDs of all libraries.
+ */
+struct TreeDisplayLibraries::MainIDLists {
+  Main *bmain;
+  Vector<ListBase *> lbarray;
+  /** For each library (null for the current file), its IDs of every list in #lbarray. */
+  Map<const Library *, Array<Vector<ID *>>> ids_per_lib;
+};
+
 TreeDisplayLibraries::TreeDisplayLibraries(SpaceOutliner &space_outliner)
     : AbstractTreeDisplay(space_outliner)
 {
@@ -35,9 +49,29 @@ ListBase TreeDisplayLibraries::build_tree(const TreeSourceData &source_data)
 {
   ListBase tree = {nullptr};
 
+  MainIDLists id_lists;
+  id_lists.bmain = source_data.bmain;
+  if (const short filter_id_type = id_filter_get()) {
+    id_lists.lbarray.append(which_libbase(source_data.bmain, filter_id_type));
+  }
+  else {
+    id_lists.lbarray.extend(BKE_main_lists_get(*source_data.bmain));
+  }
+  for (const int a : id_lists.lbarray.index_range()) {
+    if (!id_lists.lbarray[a]) {
+      continue;
+    }
+    for (ID *id : List<ID>(id_lists.lbarray[a])) {
+      id_lists.ids_per_lib
+          .lookup_or_add_cb(id->lib,
+                            [&]() { return Array<Vector<ID *>>(id_lists.lbarray.size()); })[a]
+          .append(id);
+    }
+  }
+
   {
     /* current file first - mainvar provides tselem with unique pointer - not used */
-    TreeElement *ten = add_library_contents(*source_data.bmain, tree, nullptr);
+    TreeElement *ten = add_library_contents(id_lists, tree, nullptr);
     TreeStoreElem *tselem;
 
     if (ten) {
@@ -50,7 +84,7 @@ ListBase TreeDisplayLibraries::build_tree(const TreeSourceData &source_data)
 
   for (ID *id : List<ID>(source_data.bmain->libraries)) {
     Library *lib = reinterpret_cast<Library *>(id);
-    TreeElement *ten = add_library_contents(*source_data.bmain, tree, lib);
+    TreeElement *ten = add_library_contents(id_lists, tree, lib);
     /* Null-check matters, due to filtering there may not be a new element. */
     if (ten) {
       lib->id.newid = (ID *)ten;
@@ -81,7 +115,7 @@ ListBase TreeDisplayLibraries::build_tree(const TreeSourceData &source_data)
     }
     else {
       /* Else, make a new copy of the libtree for our parent. */
-      TreeElement *dupten = add_library_contents(*source_data.bmain, parent->subtree, lib);
+      TreeElement *dupten = add_library_contents(id_lists, parent->subtree, lib);
       if (dupten) {
         dupten->parent = parent;
       }
@@ -95,17 +129,13 @@ ListBase TreeDisplayLibraries::build_tree(const TreeSourceData &source_data)
   return tree;
 }
 
-TreeElement *TreeDisplayLibraries::add_library_contents(Main &mainvar, ListBase &lb, Library *lib)
+TreeElement *TreeDisplayLibraries::add_library_contents(const MainIDLists &id_lists,
+                                                        ListBase &lb,
+                                                        Library *lib)
 {
   const short filter_id_type = id_filter_get();
-
-  Vector<ListBase *> lbarray;
-  if (filter_id_type) {
-    lbarray.append(which_libbase(&mainvar, space_outliner_.filter_id_type));
-  }
-  else {
-    lbarray.extend(BKE_main_lists_get(mainvar));
-  }
+  const Span<ListBase *> lbarray = id_lists.lbarray;
+  const Array<Vector<ID *>> *lib_ids = id_lists.ids_per_lib.lookup_ptr(lib);
 
   TreeElement *tenlib = nullptr;
   for (int a = 0; a < lbarray.size(); a++) {
@@ -122,11 +152,8 @@ TreeElement *TreeDisplayLibraries::add_library_contents(Main &mainvar, ListBase
     }
 
     /* check if there's data in current lib */
-    for (ID *id_iter : List<ID>(lbarray[a])) {
-      if (id_iter->lib == lib) {
-        id = id_iter;
-        break;
-      }
+    if (lib_ids && !(*lib_ids)[a].is_empty()) {
+      id = (*lib_ids)[a].first();
     }
 
     /* We always want to create an entry for libraries, even if/when we have no more IDs from them.
@@ -138,7 +165,7 @@ TreeElement *TreeDisplayLibraries::add_library_contents(Main &mainvar, ListBase
           tenlib = add_element(&lb, reinterpret_cast<ID *>(lib), nullptr, nullptr, TSE_SOME_ID, 0);
         }
         else {
-          tenlib = add_element(&lb, nullptr, &mainvar, nullptr, TSE_ID_BASE, 0);
+          tenlib = add_element(&lb, nullptr, id_lists.bmain, nullptr, TSE_ID_BASE, 0);
           tenlib->name = IFACE_("Current File");
         }
       }
@@ -157,9 +184,11 @@ TreeElement *TreeDisplayLibraries::add_library_contents(Main &mainvar, ListBase
           ten->name = outliner_idcode_to_plural(GS(id->name));
         }
 
-        for (ID *id : List<ID>(lbarray[a])) {
-          if (library_id_filter_poll(lib, id)) {
-            add_element(&ten->subtree, id, nullptr, ten, TSE_SOME_ID, 0);
+        if (lib_ids) {
+          for (ID *id : (*lib_ids)[a]) {
+            if (library_id_filter_poll(lib, id)) {
+              add_element(&ten->subtree, id, nullptr, ten, TSE_SOME_ID, 0);
+            }
           }
         }
       }
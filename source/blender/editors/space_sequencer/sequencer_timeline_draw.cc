@@ -444,20 +444,19 @@ static void waveform_job_start_if_needed(const bContext *C, const Strip *strip)
 {
   bSound *sound = strip->sound;
 
+  /* Load the waveform data if it hasn't been loaded and cached already, and isn't being loaded
+   * already. Many strips can share the same sound, so it is only loaded once. */
   BLI_spin_lock(static_cast<SpinLock *>(sound->spinlock));
-  if (!sound->waveform) {
-    /* Load the waveform data if it hasn't been loaded and cached already. */
-    if (!(sound->tags & SOUND_TAGS_WAVEFORM_LOADING)) {
-      /* Prevent sounds from reloading. */
-      sound->tags |= SOUND_TAGS_WAVEFORM_LOADING;
-      BLI_spin_unlock(static_cast<SpinLock *>(sound->spinlock));
-      sequencer_preview_add_sound(C, strip);
-    }
-    else {
-      BLI_spin_unlock(static_cast<SpinLock *>(sound->spinlock));
-    }
+  const bool needs_loading = !sound->waveform && !(sound->tags & SOUND_TAGS_WAVEFORM_LOADING);
+  if (needs_loading) {
+    /* Prevent sounds from reloading. */
+    sound->tags |= SOUND_TAGS_WAVEFORM_LOADING;
   }
   BLI_spin_unlock(static_cast<SpinLock *>(sound->spinlock));
+
+  if (needs_loading) {
+    sequencer_preview_add_sound(C, strip);
+  }
 }
 
 static float align_frame_with_pixel(float frame_coord, float frames_per_pixel)
@@ -23,6 +23,17 @@ static IndexMask apply_filter_operation(const VArray<T> &data,
                                         const IndexMask &mask,
                                         IndexMaskMemory &memory)
 {
+  if (data.is_single()) {
+    /* All rows have the same value, so the whole mask is either kept or discarded. */
+    return check_fn(data.get_internal_single()) ? mask : IndexMask();
+  }
+  if (data.is_span()) {
+    /* Avoid a virtual function call per row for the common case of attributes stored in arrays,
+     * which matters for geometries with many millions of elements. */
+    const Span<T> span = data.get_internal_span();
+    return IndexMask::from_predicate(
+        mask, GrainSize(1024), memory, [&](const int64_t i) { return check_fn(span[i]); });
+  }
   return IndexMask::from_predicate(
       mask, GrainSize(1024), memory, [&](const int64_t i) { return check_fn(data[i]); });
 }
@@ -11,12 +11,14 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_alloca.h"
+#include "BLI_array.hh"
 #include "BLI_linklist_stack.h"
 #include "BLI_math_geom.h"
 #include "BLI_math_matrix.h"
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
 #include "BLI_memarena.h"
+#include "BLI_task.hh"
 
 #include "BKE_context.hh"
 #include "BKE_crazyspace.hh"
@@ -1615,52 +1617,74 @@ static void createTransEditVerts(bContext * /*C*/, TransInfo *t)
           MEM_callocN(tc->data_len * sizeof(TransDataExtension), "TransObData ext"));
     }
 
-    TransData *tob = tc->data;
-    TransDataMirror *td_mirror = tc->data_mirror;
+    /* Index of the #TransData or #TransDataMirror of every vertex, so that they can be filled in
+     * parallel. */
+    Array<int> vert_td_indices(bm->totvert, -1);
+    Array<int> vert_td_mirror_indices(bm->totvert, -1);
+    int td_len = 0;
+    int td_mirror_len = 0;
     BM_ITER_MESH_INDEX (eve, &iter, bm, BM_VERTS_OF_MESH, a) {
       if (BM_elem_flag_test(eve, BM_ELEM_HIDDEN)) {
         continue;
       }
-
-      int island_index = -1;
-      if (island_data.island_vert_map) {
-        const int connected_index = (dists_index && dists_index[a] != -1) ? dists_index[a] : a;
-        island_index = island_data.island_vert_map[connected_index];
+      if (mirror_data.vert_map && mirror_data.vert_map[a].index != -1) {
+        vert_td_mirror_indices[a] = td_mirror_len++;
+      }
+      else if (prop_mode || BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
+        vert_td_indices[a] = td_len++;
       }
+    }
+    BLI_assert(td_len == tc->data_len);
+    BLI_assert(td_mirror_len == tc->data_mirror_len);
+    BM_mesh_elem_table_ensure(bm, BM_VERT);
 
-      if (mirror_data.vert_map && mirror_data.vert_map[a].index != -1) {
-        int elem_index = mirror_data.vert_map[a].index;
-        BMVert *v_src = BM_vert_at_index(bm, elem_index);
+    threading::parallel_for(IndexRange(bm->totvert), 1024, [&](const IndexRange range) {
+      for (const int i : range) {
+        const int td_index = vert_td_indices[i];
+        const int td_mirror_index = vert_td_mirror_indices[i];
+        if (td_index == -1 && td_mirror_index == -1) {
+          continue;
+        }
+        BMVert *v = BM_vert_at_index(bm, i);
 
-        if (BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
-          mirror_data.vert_map[a].flag |= TD_SELECTED;
+        int island_index = -1;
+        if (island_data.island_vert_map) {
+          const int connected_index = (dists_index && dists_index[i] != -1) ? dists_index[i] : i;
+          island_index = island_data.island_vert_map[connected_index];
         }
 
-        td_mirror->extra = eve;
-        td_mirror->loc = eve->co;
-        copy_v3_v3(td_mirror->iloc, eve->co);
-        td_mirror->flag = mirror_data.vert_map[a].flag;
-        td_mirror->loc_src = v_src->co;
-        mesh_transdata_center_copy(&island_data, island_index, td_mirror->iloc, td_mirror->center);
+        if (td_mirror_index != -1) {
+          TransDataMirror *td_mirror = &tc->data_mirror[td_mirror_index];
+          int elem_index = mirror_data.vert_map[i].index;
+          BMVert *v_src = BM_vert_at_index(bm, elem_index);
 
-        td_mirror++;
-      }
-      else if (prop_mode || BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
+          if (BM_elem_flag_test(v, BM_ELEM_SELECT)) {
+            mirror_data.vert_map[i].flag |= TD_SELECTED;
+          }
+
+          td_mirror->extra = v;
+          td_mirror->loc = v->co;
+          copy_v3_v3(td_mirror->iloc, v->co);
+          td_mirror->flag = mirror_data.vert_map[i].flag;
+          td_mirror->loc_src = v_src->co;
+          mesh_transdata_center_copy(
+              &island_data, island_index, td_mirror->iloc, td_mirror->center);
+          continue;
+        }
+
+        TransData *tob = &tc->data[td_index];
         /* Do not use the island center in case we are using islands
          * only to get axis for snap/rotate to normal... */
-        VertsToTransData(t, tob, tx, em, eve, &island_data, island_index);
-        if (tx) {
-          tx++;
-        }
+        VertsToTransData(t, tob, tx ? &tx[td_index] : nullptr, em, v, &island_data, island_index);
 
         /* Selected. */
-        if (BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
+        if (BM_elem_flag_test(v, BM_ELEM_SELECT)) {
           tob->flag |= TD_SELECTED;
         }
 
         if (prop_mode) {
           if (prop_mode & T_PROP_CONNECTED) {
-            tob->dist = dists[a];
+            tob->dist = dists[i];
           }
           else {
             tob->dist = FLT_MAX;
@@ -1671,9 +1695,9 @@ static void createTransEditVerts(bContext * /*C*/, TransInfo *t)
         transform_convert_mesh_crazyspace_transdata_set(
             mtx,
             smtx,
-            !crazyspace_data.defmats.is_empty() ? crazyspace_data.defmats[a].ptr() : nullptr,
-            crazyspace_data.quats && BM_elem_flag_test(eve, BM_ELEM_TAG) ?
-                crazyspace_data.quats[a] :
+            !crazyspace_data.defmats.is_empty() ? crazyspace_data.defmats[i].ptr() : nullptr,
+            crazyspace_data.quats && BM_elem_flag_test(v, BM_ELEM_TAG) ?
+                crazyspace_data.quats[i] :
                 nullptr,
             tob);
 
@@ -1688,10 +1712,8 @@ static void createTransEditVerts(bContext * /*C*/, TransInfo *t)
             tob->flag |= TD_MIRROR_EDGE_Z;
           }
         }
-
-        tob++;
       }
-    }
+    });
 
     transform_convert_mesh_islanddata_free(&island_data);
     transform_convert_mesh_mirrordata_free(&mirror_data);
@@ -2017,35 +2039,38 @@ static void mesh_partial_update(TransInfo *t,
 static void mesh_transdata_mirror_apply(TransDataContainer *tc)
 {
   if (tc->use_mirror_axis_any) {
-    int i;
-    TransData *td;
-    for (i = 0, td = tc->data; i < tc->data_len; i++, td++) {
-      if (td->flag & (TD_MIRROR_EDGE_X | TD_MIRROR_EDGE_Y | TD_MIRROR_EDGE_Z)) {
-        if (td->flag & TD_MIRROR_EDGE_X) {
-          td->loc[0] = 0.0f;
-        }
-        if (td->flag & TD_MIRROR_EDGE_Y) {
-          td->loc[1] = 0.0f;
-        }
-        if (td->flag & TD_MIRROR_EDGE_Z) {
-          td->loc[2] = 0.0f;
+    threading::parallel_for(IndexRange(tc->data_len), 4096, [&](const IndexRange range) {
+      for (const int i : range) {
+        TransData *td = &tc->data[i];
+        if (td->flag & (TD_MIRROR_EDGE_X | TD_MIRROR_EDGE_Y | TD_MIRROR_EDGE_Z)) {
+          if (td->flag & TD_MIRROR_EDGE_X) {
+            td->loc[0] = 0.0f;
+          }
+          if (td->flag & TD_MIRROR_EDGE_Y) {
+            td->loc[1] = 0.0f;
+          }
+          if (td->flag & TD_MIRROR_EDGE_Z) {
+            td->loc[2] = 0.0f;
+          }
         }
       }
-    }
+    });
 
-    TransDataMirror *td_mirror = tc->data_mirror;
-    for (i = 0; i < tc->data_mirror_len; i++, td_mirror++) {
-      copy_v3_v3(td_mirror->loc, td_mirror->loc_src);
-      if (td_mirror->flag & TD_MIRROR_X) {
-        td_mirror->loc[0] *= -1;
-      }
-      if (td_mirror->flag & TD_MIRROR_Y) {
-        td_mirror->loc[1] *= -1;
-      }
-      if (td_mirror->flag & TD_MIRROR_Z) {
-        td_mirror->loc[2] *= -1;
+    threading::parallel_for(IndexRange(tc->data_mirror_len), 4096, [&](const IndexRange range) {
+      for (const int i : range) {
+        TransDataMirror *td_mirror = &tc->data_mirror[i];
+        copy_v3_v3(td_mirror->loc, td_mirror->loc_src);
+        if (td_mirror->flag & TD_MIRROR_X) {
+          td_mirror->loc[0] *= -1;
+        }
+        if (td_mirror->flag & TD_MIRROR_Y) {
+          td_mirror->loc[1] *= -1;
+        }
+        if (td_mirror->flag & TD_MIRROR_Z) {
+          td_mirror->loc[2] *= -1;
+        }
       }
-    }
+    });
   }
 }
 
@@ -12,6 +12,7 @@
 #include "BLI_math_matrix.h"
 #include "BLI_math_matrix.hh"
 #include "BLI_math_vector.h"
+#include "BLI_task.hh"
 
 #include "DNA_screen_types.h"
 
@@ -402,6 +403,18 @@ using IterSnapObjsCallback = eSnapMode (*)(SnapObjectContext *sctx,
                                            bool is_object_active,
                                            bool use_hide);
 
+struct SnapObjectCandidate {
+  const Object *ob_eval;
+  const ID *ob_data;
+  float4x4 obmat;
+  bool is_object_active;
+  bool use_hide;
+};
+
+/** Prepares data for #IterSnapObjsCallback, called from multiple threads. */
+using IterSnapObjsPrefetch = void (*)(const SnapObjectContext *sctx,
+                                      const SnapObjectCandidate &candidate);
+
 static bool snap_object_is_snappable(const SnapObjectContext *sctx,
                                      const eSnapTargetOP snap_target_select,
                                      const Base *base_act,
@@ -461,7 +474,9 @@ static bool snap_object_is_snappable(const SnapObjectContext *sctx,
 /**
  * Walks through all objects in the scene to create the list of objects to snap.
  */
-static eSnapMode iter_snap_objects(SnapObjectContext *sctx, IterSnapObjsCallback sob_callback)
+static eSnapMode iter_snap_objects(SnapObjectContext *sctx,
+                                   IterSnapObjsCallback sob_callback,
+                                   IterSnapObjsPrefetch sob_prefetch = nullptr)
 {
   eSnapMode ret = SCE_SNAP_TO_NONE;
   eSnapMode tmp;
@@ -472,6 +487,11 @@ static eSnapMode iter_snap_objects(SnapObjectContext *sctx, IterSnapObjsCallback
   BKE_view_layer_synced_ensure(scene, view_layer);
   Base *base_act = BKE_view_layer_active_base_get(view_layer);
 
+  /* Gather the candidates first so per-object data can be prepared in parallel. The callbacks
+   * themselves run in order, since they cull against the result of the previous objects. */
+  Vector<SnapObjectCandidate> candidates;
+  Vector<ListBase *> duplilists;
+
   LISTBASE_FOREACH (Base *, base, BKE_view_layer_object_bases_get(view_layer)) {
     if (!snap_object_is_snappable(sctx, snap_target_select, base_act, base)) {
       continue;
@@ -485,28 +505,41 @@ static eSnapMode iter_snap_objects(SnapObjectContext *sctx, IterSnapObjsCallback
       ListBase *lb = object_duplilist(sctx->runtime.depsgraph, sctx->scene, obj_eval);
       LISTBASE_FOREACH (DupliObject *, dupli_ob, lb) {
         BLI_assert(DEG_is_evaluated_object(dupli_ob->ob));
-        if ((tmp = sob_callback(sctx,
-                                dupli_ob->ob,
-                                dupli_ob->ob_data,
-                                float4x4(dupli_ob->mat),
-                                is_object_active,
-                                false)) != SCE_SNAP_TO_NONE)
-        {
-          ret = tmp;
-        }
+        candidates.append(
+            {dupli_ob->ob, dupli_ob->ob_data, float4x4(dupli_ob->mat), is_object_active, false});
       }
-      free_object_duplilist(lb);
+      duplilists.append(lb);
     }
 
     bool use_hide = false;
     ID *ob_data = data_for_snap(obj_eval, sctx->runtime.params.edit_mode_type, &use_hide);
-    if ((tmp = sob_callback(
-             sctx, obj_eval, ob_data, obj_eval->object_to_world(), is_object_active, use_hide)) !=
-        SCE_SNAP_TO_NONE)
+    candidates.append(
+        {obj_eval, ob_data, obj_eval->object_to_world(), is_object_active, use_hide});
+  }
+
+  if (sob_prefetch && candidates.size() > 1) {
+    threading::parallel_for(candidates.index_range(), 1, [&](const IndexRange range) {
+      for (const SnapObjectCandidate &candidate : candidates.as_span().slice(range)) {
+        sob_prefetch(sctx, candidate);
+      }
+    });
+  }
+
+  for (const SnapObjectCandidate &candidate : candidates) {
+    if ((tmp = sob_callback(sctx,
+                            candidate.ob_eval,
+                            candidate.ob_data,
+                            candidate.obmat,
+                            candidate.is_object_active,
+                            candidate.use_hide)) != SCE_SNAP_TO_NONE)
     {
       ret = tmp;
     }
   }
+
+  for (ListBase *lb : duplilists) {
+    free_object_duplilist(lb);
+  }
   return ret;
 }
 
@@ -627,6 +660,35 @@ static eSnapMode raycast_obj_fn(SnapObjectContext *sctx,
   return SCE_SNAP_TO_NONE;
 }
 
+/**
+ * Build the ray-cast BVH trees of the meshes #raycast_obj_fn is going to test.
+ * Edit-meshes are skipped, their trees are stored in the (non thread-safe) snap context cache.
+ */
+static void raycast_obj_prefetch_fn(const SnapObjectContext *sctx,
+                                    const SnapObjectCandidate &candidate)
+{
+  const Object *ob_eval = candidate.ob_eval;
+  const ID *ob_data = candidate.ob_data;
+  if (ob_data == nullptr || GS(ob_data->name) != ID_ME) {
+    return;
+  }
+  if ((sctx->runtime.params.occlusion_test == SNAP_OCCLUSION_AS_SEEM) &&
+      ELEM(ob_eval->dt, OB_BOUNDBOX, OB_WIRE))
+  {
+    return;
+  }
+  if (ELEM(ob_eval->type, OB_CURVES_LEGACY, OB_SURF) &&
+      (sctx->runtime.params.edit_mode_type != SNAP_GEOM_FINAL) &&
+      BKE_object_is_in_editmode(ob_eval))
+  {
+    return;
+  }
+  snap_object_mesh_raycast_prefetch(sctx,
+                                    reinterpret_cast<const Mesh *>(ob_data),
+                                    candidate.obmat,
+                                    candidate.use_hide);
+}
+
 /**
  * Main RayCast Function
  * ======================
@@ -643,7 +705,7 @@ static eSnapMode raycast_obj_fn(SnapObjectContext *sctx,
  */
 static bool raycastObjects(SnapObjectContext *sctx)
 {
-  return iter_snap_objects(sctx, raycast_obj_fn) != SCE_SNAP_TO_NONE;
+  return iter_snap_objects(sctx, raycast_obj_fn, raycast_obj_prefetch_fn) != SCE_SNAP_TO_NONE;
 }
 
 /** \} */
@@ -247,6 +247,15 @@ eSnapMode snap_object_mesh(SnapObjectContext *sctx,
                            bool skip_hidden,
                            bool is_editmesh = false);
 
+/**
+ * Build the #BVHTree that #snap_object_mesh would use to ray-cast \a mesh_eval, if its bounds
+ * are hit by the ray. Thread-safe, the trees are cached in the mesh runtime data.
+ */
+void snap_object_mesh_raycast_prefetch(const SnapObjectContext *sctx,
+                                       const Mesh *mesh_eval,
+                                       const float4x4 &obmat,
+                                       bool skip_hidden);
+
 eSnapMode snap_polygon_mesh(SnapObjectContext *sctx,
                             const Object *ob_eval,
                             const ID *id,
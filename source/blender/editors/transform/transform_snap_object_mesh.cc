@@ -185,6 +185,32 @@ static bool raycastMesh(SnapObjectContext *sctx,
   return retval;
 }
 
+void snap_object_mesh_raycast_prefetch(const SnapObjectContext *sctx,
+                                       const Mesh *mesh_eval,
+                                       const float4x4 &obmat,
+                                       bool skip_hidden)
+{
+  if (mesh_eval->faces_num == 0) {
+    return;
+  }
+
+  /* Same bounding-box test as #raycastMesh, so only trees that will be queried get built. */
+  if (std::optional<Bounds<float3>> bounds = mesh_eval->bounds_min_max()) {
+    const float4x4 imat = math::invert(obmat);
+    const float3 ray_start_local = math::transform_point(imat, sctx->runtime.ray_start);
+    const float3 ray_normal_local = math::normalize(
+        math::transform_direction(imat, sctx->runtime.ray_dir));
+    if (!isect_ray_aabb_v3_simple(
+            ray_start_local, ray_normal_local, bounds->min, bounds->max, nullptr, nullptr))
+    {
+      return;
+    }
+  }
+
+  bke::BVHTreeFromMesh treedata;
+  snap_object_data_mesh_get(mesh_eval, skip_hidden, &treedata);
+}
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -50,6 +50,40 @@ struct MemFileUndoStep {
   MemFileUndoData *data;
 };
 
+/**
+ * Compress the memory of older global undo steps which is not shared with other steps,
+ * decompressing happens on demand when the step is restored.
+ */
+#define USE_MEMFILE_UNDO_COMPRESS
+/** Number of more recent global undo steps before a step gets compressed. */
+#define MEMFILE_UNDO_COMPRESS_STEP_DISTANCE 3
+
+/** Sync the step size used for the undo memory limit after its memfile changed. */
+static void memfile_undosys_step_size_update(MemFileUndoStep *us)
+{
+  us->data->undo_size = us->data->memfile.size;
+  us->step.data_size = us->data->undo_size;
+}
+
+#ifdef USE_MEMFILE_UNDO_COMPRESS
+static void memfile_undosys_step_compress_old(MemFileUndoStep *us)
+{
+  UndoStep *us_iter = &us->step;
+  for (int i = 0; i < MEMFILE_UNDO_COMPRESS_STEP_DISTANCE && us_iter; i++) {
+    us_iter = BKE_undosys_step_same_type_prev(us_iter);
+  }
+  if (us_iter == nullptr) {
+    return;
+  }
+  MemFileUndoStep *us_old = (MemFileUndoStep *)us_iter;
+  if (us_old->data->memfile.is_compressed) {
+    return;
+  }
+  BLO_memfile_compress(&us_old->data->memfile);
+  memfile_undosys_step_size_update(us_old);
+}
+#endif
+
 static bool memfile_undosys_poll(bContext *C)
 {
   /* other poll functions must run first, this is a catch-all. */
@@ -83,6 +117,14 @@ static bool memfile_undosys_step_encode(bContext * /*C*/, Main *bmain, UndoStep
   us->data = BKE_memfile_undo_encode(bmain, us_prev ? us_prev->data : nullptr);
   us->step.data_size = us->data->undo_size;
 
+  if (us_prev != nullptr) {
+    /* The previous step may have been decompressed to be used as reference. */
+    memfile_undosys_step_size_update(us_prev);
+  }
+#ifdef USE_MEMFILE_UNDO_COMPRESS
+  memfile_undosys_step_compress_old(us);
+#endif
+
   /* Store the fact that we should not re-use old data with that undo step, and reset the Main
    * flag. */
   us->step.use_old_bmain_data = !bmain->use_memfile_full_barrier;
@@ -199,6 +241,8 @@ static void memfile_undosys_step_decode(
 
   MemFileUndoStep *us = (MemFileUndoStep *)us_p;
   BKE_memfile_undo_decode(us->data, undo_direction, use_old_bmain_data, C);
+  /* Reading decompresses the step. */
+  memfile_undosys_step_size_update(us);
 
   for (UndoStep *us_iter = us_p->next; us_iter; us_iter = us_iter->next) {
     if (BKE_UNDOSYS_TYPE_IS_MEMFILE_SKIP(us_iter->type)) {
@@ -12,11 +12,18 @@
 
 namespace blender::fn::multi_function {
 
+class ValueAllocator;
+
 /** A multi-function that executes a procedure internally. */
 class ProcedureExecutor : public MultiFunction {
  private:
   Signature signature_;
   const Procedure &procedure_;
+  /**
+   * Number of elements that are processed through the whole procedure at once, or zero when the
+   * procedure can't be executed in chunks.
+   */
+  int64_t chunk_size_ = 0;
 
  public:
   ProcedureExecutor(const Procedure &procedure);
@@ -24,6 +31,11 @@ class ProcedureExecutor : public MultiFunction {
   void call(const IndexMask &mask, Params params, Context context) const override;
 
  private:
+  void call_chunk(const IndexMask &full_mask,
+                  Params params,
+                  Context context,
+                  ValueAllocator &value_allocator) const;
+
   ExecutionHints get_execution_hints() const override;
 };
 
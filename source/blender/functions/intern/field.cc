@@ -278,6 +278,84 @@ static void build_multi_function_procedure_for_fields(mf::Procedure &procedure,
   BLI_assert(procedure.validate());
 }
 
+/**
+ * Evaluate a field that is computed by a single operation directly on field inputs and constants
+ * by calling its multi-function, without building a procedure for it. This avoids the overhead of
+ * the procedure executor for the common case of small field trees.
+ *
+ * \return False if the field can't be evaluated this way, nothing is computed then.
+ */
+static bool try_evaluate_operation_field_directly(const GFieldRef field,
+                                                  const FieldTreeInfo &field_tree_info,
+                                                  const Span<GVArray> field_context_inputs,
+                                                  const IndexMask &mask,
+                                                  const GMutableSpan dst)
+{
+  if (field.node().node_type() != FieldNodeType::Operation) {
+    return false;
+  }
+  const FieldOperation &operation_node = static_cast<const FieldOperation &>(field.node());
+  const mf::MultiFunction &multi_function = operation_node.multi_function();
+
+  for (const int param_index : multi_function.param_indices()) {
+    const mf::ParamType param_type = multi_function.param_type(param_index);
+    if (param_type.interface_type() == mf::ParamType::Mutable ||
+        !param_type.data_type().is_single())
+    {
+      return false;
+    }
+  }
+
+  Vector<GVArray, 8> inputs;
+  for (const GField &input_field : operation_node.inputs()) {
+    const FieldNode &input_node = input_field.node();
+    switch (input_node.node_type()) {
+      case FieldNodeType::Input: {
+        const FieldInput &field_input = static_cast<const FieldInput &>(input_node);
+        const int field_input_index = field_tree_info.deduplicated_field_inputs.index_of(
+            field_input);
+        inputs.append(field_context_inputs[field_input_index]);
+        break;
+      }
+      case FieldNodeType::Constant: {
+        const FieldConstant &field_constant = static_cast<const FieldConstant &>(input_node);
+        inputs.append(GVArray::ForSingleRef(
+            field_constant.type(), mask.min_array_size(), field_constant.value().get()));
+        break;
+      }
+      case FieldNodeType::Operation: {
+        /* Intermediate values need a procedure. */
+        return false;
+      }
+    }
+  }
+
+  mf::ParamsBuilder mf_params{multi_function, &mask};
+  mf::ContextBuilder mf_context;
+
+  int param_input_index = 0;
+  int param_output_index = 0;
+  for (const int param_index : multi_function.param_indices()) {
+    const mf::ParamType param_type = multi_function.param_type(param_index);
+    if (param_type.interface_type() == mf::ParamType::Input) {
+      mf_params.add_readonly_single_input(inputs[param_input_index]);
+      param_input_index++;
+    }
+    else {
+      if (param_output_index == field.node_output_index()) {
+        mf_params.add_uninitialized_single_output(dst);
+      }
+      else {
+        mf_params.add_ignored_single_output();
+      }
+      param_output_index++;
+    }
+  }
+
+  multi_function.call_auto(mask, mf_params, mf_context);
+  return true;
+}
+
 Vector<GVArray> evaluate_fields(ResourceScope &scope,
                                 Span<GFieldRef> fields_to_evaluate,
                                 const IndexMask &mask,
@@ -367,20 +445,7 @@ Vector<GVArray> evaluate_fields(ResourceScope &scope,
 
   /* Evaluate varying fields if necessary. */
   if (!varying_fields_to_evaluate.is_empty()) {
-    /* Build the procedure for those fields. */
-    mf::Procedure procedure;
-    build_multi_function_procedure_for_fields(
-        procedure, scope, field_tree_info, varying_fields_to_evaluate);
-    mf::ProcedureExecutor procedure_executor{procedure};
-
-    mf::ParamsBuilder mf_params{procedure_executor, &mask};
-    mf::ContextBuilder mf_context;
-
-    /* Provide inputs to the procedure executor. */
-    for (const GVArray &varray : field_context_inputs) {
-      mf_params.add_readonly_single_input(varray);
-    }
-
+    Vector<GMutableSpan> output_spans;
     for (const int i : varying_fields_to_evaluate.index_range()) {
       const GFieldRef &field = varying_fields_to_evaluate[i];
       const CPPType &type = field.cpp_type();
@@ -409,12 +474,37 @@ Vector<GVArray> evaluate_fields(ResourceScope &scope,
         is_output_written_to_dst[out_index] = true;
       }
 
-      /* Pass output buffer to the procedure executor. */
-      const GMutableSpan span{type, buffer, array_size};
-      mf_params.add_uninitialized_single_output(span);
+      output_spans.append({type, buffer, array_size});
     }
 
-    procedure_executor.call_auto(mask, mf_params, mf_context);
+    const bool evaluated_directly = varying_fields_to_evaluate.size() == 1 &&
+                                    try_evaluate_operation_field_directly(
+                                        varying_fields_to_evaluate[0],
+                                        field_tree_info,
+                                        field_context_inputs,
+                                        mask,
+                                        output_spans[0]);
+    if (!evaluated_directly) {
+      /* Build the procedure for those fields. */
+      mf::Procedure procedure;
+      build_multi_function_procedure_for_fields(
+          procedure, scope, field_tree_info, varying_fields_to_evaluate);
+      mf::ProcedureExecutor procedure_executor{procedure};
+
+      mf::ParamsBuilder mf_params{procedure_executor, &mask};
+      mf::ContextBuilder mf_context;
+
+      /* Provide inputs to the procedure executor. */
+      for (const GVArray &varray : field_context_inputs) {
+        mf_params.add_readonly_single_input(varray);
+      }
+      /* Pass output buffers to the procedure executor. */
+      for (const GMutableSpan span : output_spans) {
+        mf_params.add_uninitialized_single_output(span);
+      }
+
+      procedure_executor.call_auto(mask, mf_params, mf_context);
+    }
   }
 
   /* Evaluate constant fields if necessary. */
@@ -839,56 +839,13 @@ class Executor {
         node, node_state, current_task, local_data, [&](LockedNode &locked_node) {
           BLI_assert(node_state.schedule_state == NodeScheduleState::Scheduled);
           node_state.schedule_state = NodeScheduleState::Running;
-
-          if (node_state.node_has_finished) {
-            return;
-          }
-
-          bool required_uncomputed_output_exists = false;
-          for (const int output_index : node.outputs().index_range()) {
-            OutputState &output_state = node_state.outputs[output_index];
-            output_state.usage_for_execution = output_state.usage;
-            if (output_state.usage == ValueUsage::Used && !output_state.has_been_computed) {
-              required_uncomputed_output_exists = true;
-            }
+          node_needs_execution = this->prepare_node_for_execution(locked_node);
+          if (!node_needs_execution) {
+            /* Nodes often run without having to be executed, e.g. when they are only scheduled to
+             * request their inputs or to free unused ones. Finish the run right away in that case
+             * instead of locking the node again. */
+            this->finish_node_run(locked_node, current_task, false, local_data);
           }
-          if (!required_uncomputed_output_exists && !node_state.has_side_effects) {
-            return;
-          }
-
-          if (!node_state.always_used_inputs_requested) {
-            /* Request linked inputs that are always needed. */
-            const Span<Input> fn_inputs = fn.inputs();
-            for (const int input_index : fn_inputs.index_range()) {
-              const Input &fn_input = fn_inputs[input_index];
-              if (fn_input.usage == ValueUsage::Used) {
-                const InputSocket &input_socket = node.input(input_index);
-                if (input_socket.origin() != nullptr) {
-                  this->set_input_required(locked_node, input_socket);
-                }
-              }
-            }
-
-            node_state.always_used_inputs_requested = true;
-          }
-
-          for (const int input_index : node.inputs().index_range()) {
-            InputState &input_state = node_state.inputs[input_index];
-            if (input_state.was_ready_for_execution) {
-              continue;
-            }
-            if (input_state.value != nullptr) {
-              input_state.was_ready_for_execution = true;
-              continue;
-            }
-            if (!fn.allow_missing_requested_inputs()) {
-              if (input_state.usage == ValueUsage::Used) {
-                return;
-              }
-            }
-          }
-
-          node_needs_execution = true;
         });
 
     if (node_needs_execution) {
@@ -922,23 +879,98 @@ class Executor {
        * being hold very long in some cases and results in multiple locks being hold by the same
        * thread in the same graph which can lead to deadlocks. */
       this->execute_node(node, node_state, current_task, local_data);
+
+      this->with_locked_node(
+          node, node_state, current_task, local_data, [&](LockedNode &locked_node) {
+            this->finish_node_run(locked_node, current_task, true, local_data);
+          });
     }
+  }
 
-    this->with_locked_node(
-        node, node_state, current_task, local_data, [&](LockedNode &locked_node) {
-#ifndef NDEBUG
-          if (node_needs_execution) {
-            this->assert_expected_outputs_have_been_computed(locked_node, local_data);
+  /**
+   * Updates the state of a node that is about to run and checks whether its function has to be
+   * executed. This also requests the inputs that are always used the first time the node runs.
+   */
+  bool prepare_node_for_execution(LockedNode &locked_node)
+  {
+    const FunctionNode &node = static_cast<const FunctionNode &>(locked_node.node);
+    NodeState &node_state = locked_node.node_state;
+    const LazyFunction &fn = node.function();
+
+    if (node_state.node_has_finished) {
+      return false;
+    }
+
+    bool required_uncomputed_output_exists = false;
+    for (const int output_index : node.outputs().index_range()) {
+      OutputState &output_state = node_state.outputs[output_index];
+      output_state.usage_for_execution = output_state.usage;
+      if (output_state.usage == ValueUsage::Used && !output_state.has_been_computed) {
+        required_uncomputed_output_exists = true;
+      }
+    }
+    if (!required_uncomputed_output_exists && !node_state.has_side_effects) {
+      return false;
+    }
+
+    if (!node_state.always_used_inputs_requested) {
+      /* Request linked inputs that are always needed. */
+      const Span<Input> fn_inputs = fn.inputs();
+      for (const int input_index : fn_inputs.index_range()) {
+        const Input &fn_input = fn_inputs[input_index];
+        if (fn_input.usage == ValueUsage::Used) {
+          const InputSocket &input_socket = node.input(input_index);
+          if (input_socket.origin() != nullptr) {
+            this->set_input_required(locked_node, input_socket);
           }
+        }
+      }
+
+      node_state.always_used_inputs_requested = true;
+    }
+
+    for (const int input_index : node.inputs().index_range()) {
+      InputState &input_state = node_state.inputs[input_index];
+      if (input_state.was_ready_for_execution) {
+        continue;
+      }
+      if (input_state.value != nullptr) {
+        input_state.was_ready_for_execution = true;
+        continue;
+      }
+      if (!fn.allow_missing_requested_inputs()) {
+        if (input_state.usage == ValueUsage::Used) {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  /**
+   * Called at the end of every node run, while the node is still locked.
+   */
+  void finish_node_run(LockedNode &locked_node,
+                       CurrentTask &current_task,
+                       const bool node_was_executed,
+                       const LocalData &local_data)
+  {
+    NodeState &node_state = locked_node.node_state;
+#ifndef NDEBUG
+    if (node_was_executed) {
+      this->assert_expected_outputs_have_been_computed(locked_node, local_data);
+    }
+#else
+    UNUSED_VARS(node_was_executed, local_data);
 #endif
-          this->finish_node_if_possible(locked_node);
-          const bool reschedule_requested = node_state.schedule_state ==
-                                            NodeScheduleState::RunningAndRescheduled;
-          node_state.schedule_state = NodeScheduleState::NotScheduled;
-          if (reschedule_requested && !node_state.node_has_finished) {
-            this->schedule_node(locked_node, current_task, false);
-          }
-        });
+    this->finish_node_if_possible(locked_node);
+    const bool reschedule_requested = node_state.schedule_state ==
+                                      NodeScheduleState::RunningAndRescheduled;
+    node_state.schedule_state = NodeScheduleState::NotScheduled;
+    if (reschedule_requested && !node_state.node_has_finished) {
+      this->schedule_node(locked_node, current_task, false);
+    }
   }
 
   void assert_expected_outputs_have_been_computed(LockedNode &locked_node,
@@ -8,6 +8,34 @@
 
 namespace blender::fn::multi_function {
 
+/**
+ * Approximate amount of memory that the variables of a procedure may use for one chunk of
+ * elements. Chosen so that the intermediate buffers stay in the L2 cache while all instructions of
+ * the procedure process the chunk.
+ */
+static constexpr int64_t chunk_memory_budget = 256 * 1024;
+static constexpr int64_t min_chunk_size = 1024;
+static constexpr int64_t max_chunk_size = 4096;
+
+/**
+ * Compute how many elements are processed through the whole procedure at once, or zero if
+ * the procedure can't be executed in chunks.
+ */
+static int64_t compute_chunk_size(const Procedure &procedure)
+{
+  int64_t bytes_per_element = 0;
+  for (const Variable *variable : procedure.variables()) {
+    const DataType data_type = variable->data_type();
+    if (data_type.is_vector()) {
+      /* Vector values can't be sliced. */
+      return 0;
+    }
+    bytes_per_element += data_type.single_type().size();
+  }
+  const int64_t size = chunk_memory_budget / std::max<int64_t>(bytes_per_element, 1);
+  return std::clamp(size, min_chunk_size, max_chunk_size);
+}
+
 ProcedureExecutor::ProcedureExecutor(const Procedure &procedure) : procedure_(procedure)
 {
   SignatureBuilder builder("Procedure Executor", signature_);
@@ -17,6 +45,8 @@ ProcedureExecutor::ProcedureExecutor(const Procedure &procedure) : procedure_(pr
   }
 
   this->set_signature(&signature_);
+
+  chunk_size_ = compute_chunk_size(procedure);
 }
 
 using IndicesSplitVectors = std::array<Vector<int64_t>, 2>;
@@ -148,8 +178,18 @@ class ValueAllocator : NonCopyable, NonMovable {
   Stack<void *> small_single_value_free_list_;
   Map<const CPPType *, Stack<void *>> single_value_free_lists_;
 
+  /**
+   * Span buffers are allocated for at least this many elements. When a procedure is evaluated in
+   * chunks, this is the largest array size of all chunks, so that the buffers can be reused for
+   * every chunk.
+   */
+  int64_t min_span_size_ = 0;
+
  public:
-  ValueAllocator(LinearAllocator<> &linear_allocator) : linear_allocator_(linear_allocator) {}
+  ValueAllocator(LinearAllocator<> &linear_allocator, const int64_t min_span_size = 0)
+      : linear_allocator_(linear_allocator), min_span_size_(min_span_size)
+  {
+  }
 
   VariableValue_GVArray *obtain_GVArray(const GVArray &varray)
   {
@@ -166,10 +206,12 @@ class ValueAllocator : NonCopyable, NonMovable {
     return this->obtain<VariableValue_Span>(buffer, false);
   }
 
-  VariableValue_Span *obtain_Span(const CPPType &type, int size)
+  VariableValue_Span *obtain_Span(const CPPType &type, int64_t size)
   {
     void *buffer = nullptr;
 
+    size = std::max(size, min_span_size_);
+
     const int64_t element_size = type.size();
     const int64_t alignment = type.alignment();
 
@@ -813,17 +855,17 @@ class VariableState : NonCopyable, NonMovable {
 /** Keeps track of the states of all variables during evaluation. */
 class VariableStates {
  private:
-  ValueAllocator value_allocator_;
+  ValueAllocator &value_allocator_;
   const Procedure &procedure_;
   /** The state of every variable, indexed by #Variable::index_in_procedure(). */
   Array<VariableState> variable_states_;
   const IndexMask &full_mask_;
 
  public:
-  VariableStates(LinearAllocator<> &linear_allocator,
+  VariableStates(ValueAllocator &value_allocator,
                  const Procedure &procedure,
                  const IndexMask &full_mask)
-      : value_allocator_(linear_allocator),
+      : value_allocator_(value_allocator),
         procedure_(procedure),
         variable_states_(procedure.variables().size()),
         full_mask_(full_mask)
@@ -1157,6 +1199,38 @@ class InstructionScheduler {
   }
 };
 
+static void add_sliced_parameters(const ProcedureExecutor &fn,
+                                  Params &full_params,
+                                  const IndexRange slice_range,
+                                  ParamsBuilder &r_sliced_params)
+{
+  for (const int param_index : fn.param_indices()) {
+    switch (fn.param_type(param_index).category()) {
+      case ParamCategory::SingleInput: {
+        const GVArray &varray = full_params.readonly_single_input(param_index);
+        r_sliced_params.add_readonly_single_input(varray.slice(slice_range));
+        break;
+      }
+      case ParamCategory::SingleMutable: {
+        const GMutableSpan span = full_params.single_mutable(param_index);
+        r_sliced_params.add_single_mutable(span.slice(slice_range));
+        break;
+      }
+      case ParamCategory::SingleOutput: {
+        const GMutableSpan span = full_params.uninitialized_single_output(param_index);
+        r_sliced_params.add_uninitialized_single_output(span.slice(slice_range));
+        break;
+      }
+      case ParamCategory::VectorInput:
+      case ParamCategory::VectorMutable:
+      case ParamCategory::VectorOutput: {
+        BLI_assert_unreachable();
+        break;
+      }
+    }
+  }
+}
+
 void ProcedureExecutor::call(const IndexMask &full_mask, Params params, Context context) const
 {
   BLI_assert(procedure_.validate());
@@ -1165,7 +1239,46 @@ void ProcedureExecutor::call(const IndexMask &full_mask, Params params, Context
   LinearAllocator<> linear_allocator;
   linear_allocator.provide_buffer(local_buffer);
 
-  VariableStates variable_states{linear_allocator, procedure_, full_mask};
+  if (chunk_size_ == 0 || full_mask.size() <= chunk_size_) {
+    ValueAllocator value_allocator{linear_allocator};
+    this->call_chunk(full_mask, params, context, value_allocator);
+    return;
+  }
+
+  /* Process the elements in chunks through the whole procedure, instead of the whole mask one
+   * instruction at a time. This keeps the intermediate buffers in the cache, and the buffers are
+   * reused for every chunk. The chunks are shifted so that their indices start at zero. */
+  auto chunk_range = [&](const int64_t start) {
+    return IndexRange(start, std::min(chunk_size_, full_mask.size() - start));
+  };
+  int64_t max_chunk_array_size = 0;
+  for (int64_t start = 0; start < full_mask.size(); start += chunk_size_) {
+    const IndexRange range = chunk_range(start);
+    max_chunk_array_size = std::max(max_chunk_array_size,
+                                    full_mask[range.last()] - full_mask[range.first()] + 1);
+  }
+
+  ValueAllocator value_allocator{linear_allocator, max_chunk_array_size};
+  for (int64_t start = 0; start < full_mask.size(); start += chunk_size_) {
+    const IndexRange range = chunk_range(start);
+    const int64_t slice_start = full_mask[range.first()];
+    const IndexRange slice_range{slice_start, full_mask[range.last()] - slice_start + 1};
+
+    IndexMaskMemory memory;
+    const IndexMask chunk_mask = full_mask.slice_and_shift(range, -slice_start, memory);
+
+    ParamsBuilder chunk_params{*this, &chunk_mask};
+    add_sliced_parameters(*this, params, slice_range, chunk_params);
+    this->call_chunk(chunk_mask, chunk_params, context, value_allocator);
+  }
+}
+
+void ProcedureExecutor::call_chunk(const IndexMask &full_mask,
+                                   Params params,
+                                   Context context,
+                                   ValueAllocator &value_allocator) const
+{
+  VariableStates variable_states{value_allocator, procedure_, full_mask};
   variable_states.add_initial_variable_states(*this, procedure_, params);
 
   InstructionScheduler scheduler;
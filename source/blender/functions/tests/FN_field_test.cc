@@ -123,6 +123,30 @@ TEST(field, InputAndFunction)
   EXPECT_EQ(result[8], 16);
 }
 
+TEST(field, InputAndConstantFunction)
+{
+  GField index_field{std::make_shared<IndexFieldInput>()};
+  GField constant_field = make_constant_field<int>(10);
+
+  auto add_fn = mf::build::SI2_SO<int, int, int>("add", [](int a, int b) { return a + b; });
+  GField output_field{FieldOperation::Create(add_fn, {index_field, constant_field}), 0};
+
+  Array<int> result(10);
+
+  const Array<int64_t> indices = {2, 4, 6, 8};
+  IndexMaskMemory memory;
+  const IndexMask mask = IndexMask::from_indices<int64_t>(indices, memory);
+
+  FieldContext context;
+  FieldEvaluator evaluator{context, &mask};
+  evaluator.add_with_destination(output_field, result.as_mutable_span());
+  evaluator.evaluate();
+  EXPECT_EQ(result[2], 12);
+  EXPECT_EQ(result[4], 14);
+  EXPECT_EQ(result[6], 16);
+  EXPECT_EQ(result[8], 18);
+}
+
 TEST(field, TwoFunctions)
 {
   GField index_field{std::make_shared<IndexFieldInput>()};
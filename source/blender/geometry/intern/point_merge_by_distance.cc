@@ -2,6 +2,8 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include "atomic_ops.h"
+
 #include "BLI_array_utils.hh"
 #include "BLI_kdtree.h"
 #include "BLI_offset_indices.hh"
@@ -52,7 +54,7 @@ PointCloud *point_merge_by_distance(const PointCloud &src_points,
   Array<int> merge_indices(src_size);
   array_utils::fill_index_range<int>(merge_indices);
 
-  selection.foreach_index([&](const int src_index, const int pos) {
+  selection.foreach_index(GrainSize(4096), [&](const int src_index, const int pos) {
     const int merge_index = selection_merge_indices[pos];
     if (merge_index != -1) {
       const int src_merge_index = selection[merge_index];
@@ -60,48 +62,51 @@ PointCloud *point_merge_by_distance(const PointCloud &src_points,
     }
   });
 
-  /* For every source index, find the corresponding index in the result by iterating through the
-   * source indices and counting how many merges happened before that point. */
-  int merged_points = 0;
+  /* Points that are not merged into another point are kept in the result, in their original
+   * order. Every other point is merged into one of the kept points. */
+  IndexMaskMemory memory;
+  const IndexMask kept_points = IndexMask::from_predicate(
+      IndexRange(src_size), GrainSize(4096), memory, [&](const int i) {
+        return merge_indices[i] == i;
+      });
+  BLI_assert(kept_points.size() == dst_size);
   Array<int> src_to_dst_indices(src_size);
-  for (const int i : IndexRange(src_size)) {
-    src_to_dst_indices[i] = i - merged_points;
-    if (merge_indices[i] != i) {
-      merged_points++;
+  index_mask::build_reverse_map<int>(kept_points, src_to_dst_indices);
+
+  /* Find the result point of every source point. */
+  Array<int> dst_indices(src_size);
+  threading::parallel_for(IndexRange(src_size), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      BLI_assert(merge_indices[merge_indices[i]] == merge_indices[i]);
+      dst_indices[i] = src_to_dst_indices[merge_indices[i]];
     }
-  }
+  });
 
   /* In order to use a contiguous array as the storage for every destination point's source
-   * indices, first the number of source points must be counted for every result point. */
-  Array<int> point_merge_counts(dst_size, 0);
-  for (const int i : IndexRange(src_size)) {
-    const int merge_index = merge_indices[i];
-    const int dst_index = src_to_dst_indices[merge_index];
-    point_merge_counts[dst_index]++;
-  }
-
-  /* This array stores an offset into `merge_map` for every result point. */
-  Array<int> map_offsets_data(dst_size + 1);
-  int offset = 0;
-  for (const int i : IndexRange(dst_size)) {
-    map_offsets_data[i] = offset;
-    offset += point_merge_counts[i];
-  }
-  map_offsets_data.last() = offset;
+   * indices, first the number of source points must be counted for every result point. This
+   * array stores an offset into `merge_map` for every result point. */
+  Array<int> map_offsets_data(dst_size + 1, 0);
+  offset_indices::build_reverse_offsets(dst_indices, map_offsets_data);
   OffsetIndices<int> map_offsets(map_offsets_data);
 
-  point_merge_counts.fill(0);
-
   /* This array stores all of the source indices for every result point. The size is the source
-   * size because every input point is either merged with another or copied directly. */
+   * size because every input point is either merged with another or copied directly. The indices
+   * are added in parallel, and sorted afterwards to keep the order of the source points. */
   Array<int> merge_map_indices(src_size);
-  for (const int i : IndexRange(src_size)) {
-    const int merge_index = merge_indices[i];
-    const int dst_index = src_to_dst_indices[merge_index];
-
-    merge_map_indices[map_offsets[dst_index].first() + point_merge_counts[dst_index]] = i;
-    point_merge_counts[dst_index]++;
-  }
+  Array<int> point_merge_counts(dst_size, 0);
+  threading::parallel_for(IndexRange(src_size), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      const int dst_index = dst_indices[i];
+      const int index_in_group = atomic_fetch_and_add_int32(&point_merge_counts[dst_index], 1);
+      merge_map_indices[map_offsets[dst_index][index_in_group]] = i;
+    }
+  });
+  threading::parallel_for(map_offsets.index_range(), 1024, [&](const IndexRange range) {
+    for (const int i_dst : range) {
+      MutableSpan<int> group = merge_map_indices.as_mutable_span().slice(map_offsets[i_dst]);
+      std::sort(group.begin(), group.end());
+    }
+  });
 
   Set<StringRefNull> attribute_ids = src_attributes.all_ids();
 
@@ -421,6 +421,50 @@ static void threaded_fill(const GPointer value, GMutableSpan dst)
   });
 }
 
+/**
+ * The number of tasks can be very large for huge instance trees while the individual tasks can
+ * have very different sizes. To distribute the work evenly, the tasks are grouped based on the
+ * number of elements they write instead of only their count. Since the start indices of all tasks
+ * are already computed as prefix sums, the accumulated size of a range of tasks is known in
+ * constant time.
+ */
+static constexpr int64_t realize_tasks_grain_size = 4096;
+
+static int64_t pointcloud_tasks_size(const Span<RealizePointCloudTask> tasks,
+                                     const IndexRange range)
+{
+  const RealizePointCloudTask &first = tasks[range.first()];
+  const RealizePointCloudTask &last = tasks[range.last()];
+  /* Add the number of tasks to account for the constant overhead of every task. */
+  return last.start_index + last.pointcloud_info->pointcloud->totpoint - first.start_index +
+         range.size();
+}
+
+static int64_t mesh_task_start(const RealizeMeshTask &task)
+{
+  const MeshElementStartIndices &start = task.start_indices;
+  return int64_t(start.vertex) + start.edge + start.face + start.loop;
+}
+
+static int64_t mesh_tasks_size(const Span<RealizeMeshTask> tasks, const IndexRange range)
+{
+  const RealizeMeshTask &last = tasks[range.last()];
+  const Mesh &last_mesh = *last.mesh_info->mesh;
+  const int64_t end = mesh_task_start(last) + last_mesh.verts_num + last_mesh.edges_num +
+                      last_mesh.faces_num + last_mesh.corners_num;
+  return end - mesh_task_start(tasks[range.first()]) + range.size();
+}
+
+static int64_t curve_tasks_size(const Span<RealizeCurveTask> tasks, const IndexRange range)
+{
+  const CurvesElementStartIndices &first = tasks[range.first()].start_indices;
+  const RealizeCurveTask &last = tasks[range.last()];
+  const bke::CurvesGeometry &last_curves = last.curve_info->curves->geometry.wrap();
+  const int64_t end = int64_t(last.start_indices.point) + last.start_indices.curve +
+                      last_curves.points_num() + last_curves.curves_num();
+  return end - first.point - first.curve + range.size();
+}
+
 static void copy_generic_attributes_to_result(
     const Span<std::optional<GVArraySpan>> src_attributes,
     const AttributeFallbacksArray &attribute_fallbacks,
@@ -1258,18 +1302,23 @@ static void execute_realize_pointcloud_tasks(const RealizeInstancesOptions &opti
   }
 
   /* Actually execute all tasks. */
-  threading::parallel_for(tasks.index_range(), 100, [&](const IndexRange task_range) {
-    for (const int task_index : task_range) {
-      const RealizePointCloudTask &task = tasks[task_index];
-      execute_realize_pointcloud_task(options,
-                                      task,
-                                      ordered_attributes,
-                                      dst_attribute_writers,
-                                      point_radii.span,
-                                      point_ids.span,
-                                      positions.span);
-    }
-  });
+  threading::parallel_for(
+      tasks.index_range(),
+      realize_tasks_grain_size,
+      [&](const IndexRange task_range) {
+        for (const int task_index : task_range) {
+          const RealizePointCloudTask &task = tasks[task_index];
+          execute_realize_pointcloud_task(options,
+                                          task,
+                                          ordered_attributes,
+                                          dst_attribute_writers,
+                                          point_radii.span,
+                                          point_ids.span,
+                                          positions.span);
+        }
+      },
+      threading::accumulated_task_sizes(
+          [&](const IndexRange range) { return pointcloud_tasks_size(tasks, range); }));
 
   /* Tag modified attributes. */
   for (GSpanAttributeWriter &dst_attribute : dst_attribute_writers) {
@@ -1647,22 +1696,27 @@ static void execute_realize_mesh_tasks(const RealizeInstancesOptions &options,
     }
   }
   /* Actually execute all tasks. */
-  threading::parallel_for(tasks.index_range(), 100, [&](const IndexRange task_range) {
-    for (const int task_index : task_range) {
-      const RealizeMeshTask &task = tasks[task_index];
-      execute_realize_mesh_task(options,
-                                task,
-                                ordered_attributes,
-                                dst_attribute_writers,
-                                dst_positions,
-                                dst_edges,
-                                dst_face_offsets,
-                                dst_corner_verts,
-                                dst_corner_edges,
-                                vertex_ids.span,
-                                material_indices.span);
-    }
-  });
+  threading::parallel_for(
+      tasks.index_range(),
+      realize_tasks_grain_size,
+      [&](const IndexRange task_range) {
+        for (const int task_index : task_range) {
+          const RealizeMeshTask &task = tasks[task_index];
+          execute_realize_mesh_task(options,
+                                    task,
+                                    ordered_attributes,
+                                    dst_attribute_writers,
+                                    dst_positions,
+                                    dst_edges,
+                                    dst_face_offsets,
+                                    dst_corner_verts,
+                                    dst_corner_edges,
+                                    vertex_ids.span,
+                                    material_indices.span);
+        }
+      },
+      threading::accumulated_task_sizes(
+          [&](const IndexRange range) { return mesh_tasks_size(tasks, range); }));
 
   /* Tag modified attributes. */
   for (GSpanAttributeWriter &dst_attribute : dst_attribute_writers) {
@@ -1968,22 +2022,27 @@ static void execute_realize_curve_tasks(const RealizeInstancesOptions &options,
   }
 
   /* Actually execute all tasks. */
-  threading::parallel_for(tasks.index_range(), 100, [&](const IndexRange task_range) {
-    for (const int task_index : task_range) {
-      const RealizeCurveTask &task = tasks[task_index];
-      execute_realize_curve_task(options,
-                                 all_curves_info,
-                                 task,
-                                 ordered_attributes,
-                                 dst_curves,
-                                 dst_attribute_writers,
-                                 point_ids.span,
-                                 handle_left.span,
-                                 handle_right.span,
-                                 radius.span,
-                                 custom_normal.span);
-    }
-  });
+  threading::parallel_for(
+      tasks.index_range(),
+      realize_tasks_grain_size,
+      [&](const IndexRange task_range) {
+        for (const int task_index : task_range) {
+          const RealizeCurveTask &task = tasks[task_index];
+          execute_realize_curve_task(options,
+                                     all_curves_info,
+                                     task,
+                                     ordered_attributes,
+                                     dst_curves,
+                                     dst_attribute_writers,
+                                     point_ids.span,
+                                     handle_left.span,
+                                     handle_right.span,
+                                     radius.span,
+                                     custom_normal.span);
+        }
+      },
+      threading::accumulated_task_sizes(
+          [&](const IndexRange range) { return curve_tasks_size(tasks, range); }));
 
   /* Type counts have to be updated eagerly. */
   dst_curves.runtime->type_counts.fill(0);
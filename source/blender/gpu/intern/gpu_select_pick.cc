@@ -128,7 +128,7 @@ static bool depth_buf_subrect_depth_any(const DepthBufCache *rect_depth,
   const depth_t *curr = rect_depth->buf + sub_rect->start;
   for (uint i = 0; i < sub_rect->span_len; i++) {
     const depth_t *curr_end = curr + sub_rect->span;
-    for (; curr < curr_end; curr++, curr++) {
+    for (; curr < curr_end; curr++) {
       if (*curr != DEPTH_MAX) {
         return true;
       }
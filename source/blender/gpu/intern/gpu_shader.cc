@@ -6,8 +6,13 @@
  * \ingroup gpu
  */
 
+#include "BLI_fileops.hh"
 #include "BLI_math_matrix.h"
 #include "BLI_string.h"
+#include "BLI_vector.hh"
+#ifdef _WIN32
+#  include "BLI_winstuff.h"
+#endif
 
 #include "GPU_capabilities.hh"
 #include "GPU_debug.hh"
@@ -23,6 +28,8 @@
 #include "gpu_shader_dependency_private.hh"
 #include "gpu_shader_private.hh"
 
+#include <algorithm>
+#include <ctime>
 #include <string>
 
 extern "C" char datatoc_gpu_shader_colorspace_lib_glsl[];
@@ -390,6 +397,50 @@ void GPU_shader_cache_dir_clear_old()
   GPUBackend::get()->shader_cache_dir_clear_old();
 }
 
+namespace blender::gpu {
+
+void shader_cache_dir_clear_old(StringRefNull cache_dir, const int64_t max_size_in_bytes)
+{
+  direntry *entries = nullptr;
+  const uint32_t dir_len = BLI_filelist_dir_contents(cache_dir.c_str(), &entries);
+
+  const time_t ts_now = time(nullptr);
+  const time_t delete_threshold = 60 /*seconds*/ * 60 /*minutes*/ * 24 /*hours*/ * 30 /*days*/;
+
+  Vector<const direntry *> kept_entries;
+  int64_t kept_size = 0;
+  for (const int i : IndexRange(dir_len)) {
+    const direntry &entry = entries[i];
+    if (S_ISDIR(entry.s.st_mode)) {
+      continue;
+    }
+    if (entry.s.st_mtime + delete_threshold < ts_now) {
+      BLI_delete(entry.path, false, false);
+      continue;
+    }
+    kept_entries.append(&entry);
+    kept_size += entry.s.st_size;
+  }
+
+  if (kept_size > max_size_in_bytes) {
+    /* Evict the least recently used files first. */
+    std::sort(kept_entries.begin(),
+              kept_entries.end(),
+              [](const direntry *a, const direntry *b) { return a->s.st_mtime < b->s.st_mtime; });
+    for (const direntry *entry : kept_entries) {
+      if (kept_size <= max_size_in_bytes) {
+        break;
+      }
+      BLI_delete(entry->path, false, false);
+      kept_size -= entry->s.st_size;
+    }
+  }
+
+  BLI_filelist_free(entries, dir_len);
+}
+
+}  // namespace blender::gpu
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
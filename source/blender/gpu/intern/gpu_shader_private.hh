@@ -254,6 +254,15 @@ class GPULogParser {
 void printf_begin(Context *ctx);
 void printf_end(Context *ctx);
 
+/**
+ * Remove files from an on-disk shader cache directory (SPIR-V modules, program binaries).
+ * Files that haven't been used for a month are always removed. When the remaining files are
+ * larger than \a max_size_in_bytes, the least recently used ones are removed until the
+ * directory fits. Cache readers touch the files they use, so the modification time is used as
+ * the last access time.
+ */
+void shader_cache_dir_clear_old(StringRefNull cache_dir, int64_t max_size_in_bytes);
+
 }  // namespace blender::gpu
 
 /* XXX do not use it. Special hack to use OCIO with batch API. */
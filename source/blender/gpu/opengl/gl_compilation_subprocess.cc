@@ -14,6 +14,7 @@
 #  include "GHOST_C-api.h"
 #  include "GPU_context.hh"
 #  include "GPU_init_exit.hh"
+#  include "gpu_shader_private.hh"
 #  include <iostream>
 #  include <string>
 
@@ -287,22 +288,9 @@ void GPU_compilation_subprocess_run(const char *subprocess_name)
 namespace blender::gpu {
 void GL_shader_cache_dir_clear_old()
 {
-  std::string cache_dir = cache_dir_get();
-
-  direntry *entries = nullptr;
-  uint32_t dir_len = BLI_filelist_dir_contents(cache_dir.c_str(), &entries);
-  for (int i : blender::IndexRange(dir_len)) {
-    direntry entry = entries[i];
-    if (S_ISDIR(entry.s.st_mode)) {
-      continue;
-    }
-    const time_t ts_now = time(nullptr);
-    const time_t delete_threshold = 60 /*seconds*/ * 60 /*minutes*/ * 24 /*hours*/ * 30 /*days*/;
-    if (entry.s.st_mtime + delete_threshold < ts_now) {
-      BLI_delete(entry.path, false, false);
-    }
-  }
-  BLI_filelist_free(entries, dir_len);
+  /* Program binaries are driver specific and fairly large, keep the cache bounded. */
+  constexpr int64_t max_cache_size = int64_t(1024) * 1024 * 1024;
+  shader_cache_dir_clear_old(cache_dir_get(), max_cache_size);
 }
 }  // namespace blender::gpu
 
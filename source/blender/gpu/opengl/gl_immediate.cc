@@ -90,13 +90,6 @@ uchar *GLImmediate::begin()
     buffer_size() = bytes_needed;
     recreate_buffer = true;
   }
-  else if (bytes_needed < DEFAULT_INTERNAL_BUFFER_SIZE &&
-           buffer_size() > DEFAULT_INTERNAL_BUFFER_SIZE)
-  {
-    /* shrink the internal buffer */
-    buffer_size() = DEFAULT_INTERNAL_BUFFER_SIZE;
-    recreate_buffer = true;
-  }
 
   uint vert_alignment = vertex_format.stride;
   if (unwrap(this->shader)->is_polyline) {
@@ -111,6 +104,13 @@ uchar *GLImmediate::begin()
     buffer_offset() += pre_padding;
   }
   else {
+    /* Shrink the internal buffer only when it is orphaned anyway. Shrinking it as soon as a small
+     * draw follows a large one would reallocate it for every large draw when both are mixed. */
+    if (bytes_needed < DEFAULT_INTERNAL_BUFFER_SIZE &&
+        buffer_size() > DEFAULT_INTERNAL_BUFFER_SIZE)
+    {
+      buffer_size() = DEFAULT_INTERNAL_BUFFER_SIZE;
+    }
     /* orphan this buffer & start with a fresh one */
     glBufferData(GL_ARRAY_BUFFER, buffer_size(), nullptr, GL_DYNAMIC_DRAW);
     buffer_offset() = 0;
@@ -85,6 +85,7 @@ void VKCommandBuilder::groups_extract_barriers(VKRenderGraph &render_graph,
   bool rendering_active = false;
 
   for (const int64_t group_index : group_nodes_.index_range()) {
+    std::scoped_lock lock_resources(render_graph.resources_.mutex);
     /* Extract the pre-barriers of this group. */
     Barriers group_pre_barriers(barrier_list_.size(), 0);
     const GroupNodes &node_group = group_nodes_[group_index];
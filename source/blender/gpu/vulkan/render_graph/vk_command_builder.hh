@@ -178,7 +178,10 @@ class VKCommandBuilder {
  public:
   /**
    * Build execution groups and barriers.
-   * This method should be performed when the resources are locked.
+   *
+   * The resources are locked per execution group while its barriers are extracted. Releasing the
+   * lock between groups allows other threads to add nodes to the next render graph while a large
+   * render graph is being built.
    */
   void build_nodes(VKRenderGraph &render_graph,
                    VKCommandBufferInterface &command_buffer,
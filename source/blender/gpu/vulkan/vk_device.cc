@@ -483,10 +483,7 @@ void VKDevice::submission_runner(TaskPool *__restrict pool, void *task_data)
 
     render_graph::VKRenderGraph &render_graph = *submit_task->render_graph;
     Span<render_graph::NodeHandle> node_handles = scheduler.select_nodes(render_graph);
-    {
-      std::scoped_lock lock_resources(device->resources.mutex);
-      command_builder.build_nodes(render_graph, *command_buffer, node_handles);
-    }
+    command_builder.build_nodes(render_graph, *command_buffer, node_handles);
     command_builder.record_commands(render_graph, *command_buffer, node_handles);
 
     if (submit_task->submit_to_device) {
@@ -137,21 +137,10 @@ void VKShaderCompiler::cache_dir_clear_old()
   if (!cache_dir.has_value()) {
     return;
   }
-
-  direntry *entries = nullptr;
-  uint32_t dir_len = BLI_filelist_dir_contents(cache_dir->c_str(), &entries);
-  for (int i : blender::IndexRange(dir_len)) {
-    direntry entry = entries[i];
-    if (S_ISDIR(entry.s.st_mode)) {
-      continue;
-    }
-    const time_t ts_now = time(nullptr);
-    const time_t delete_threshold = 60 /*seconds*/ * 60 /*minutes*/ * 24 /*hours*/ * 30 /*days*/;
-    if (entry.s.st_mtime + delete_threshold < ts_now) {
-      BLI_delete(entry.path, false, false);
-    }
-  }
-  BLI_filelist_free(entries, dir_len);
+  /* SPIR-V modules are device independent and small, but every material variant adds a module
+   * and its sidecar. Keep the cache bounded. */
+  constexpr int64_t max_cache_size = int64_t(512) * 1024 * 1024;
+  shader_cache_dir_clear_old(*cache_dir, max_cache_size);
 }
 
 /** \} */
@@ -61,14 +61,16 @@ void VKStateManager::texture_bind(Texture *texture, GPUSamplerState sampler, int
 
 void VKStateManager::texture_unbind(Texture *texture)
 {
-  textures_.unbind(texture);
-  is_dirty = true;
+  if (textures_.unbind(texture)) {
+    is_dirty = true;
+  }
 }
 
 void VKStateManager::texture_unbind_all()
 {
-  textures_.unbind_all();
-  is_dirty = true;
+  if (textures_.unbind_all()) {
+    is_dirty = true;
+  }
 }
 
 void VKStateManager::image_bind(Texture *tex, int binding)
@@ -81,14 +83,16 @@ void VKStateManager::image_bind(Texture *tex, int binding)
 void VKStateManager::image_unbind(Texture *tex)
 {
   VKTexture *texture = unwrap(tex);
-  images_.unbind(texture);
-  is_dirty = true;
+  if (images_.unbind(texture)) {
+    is_dirty = true;
+  }
 }
 
 void VKStateManager::image_unbind_all()
 {
-  images_.unbind_all();
-  is_dirty = true;
+  if (images_.unbind_all()) {
+    is_dirty = true;
+  }
 }
 
 void VKStateManager::uniform_buffer_bind(VKUniformBuffer *uniform_buffer, int binding)
@@ -99,23 +103,28 @@ void VKStateManager::uniform_buffer_bind(VKUniformBuffer *uniform_buffer, int bi
 
 void VKStateManager::uniform_buffer_unbind(VKUniformBuffer *uniform_buffer)
 {
-  uniform_buffers_.unbind(uniform_buffer);
-  is_dirty = true;
+  if (uniform_buffers_.unbind(uniform_buffer)) {
+    is_dirty = true;
+  }
 }
 
 void VKStateManager::uniform_buffer_unbind_all()
 {
-  uniform_buffers_.unbind_all();
-  is_dirty = true;
+  if (uniform_buffers_.unbind_all()) {
+    is_dirty = true;
+  }
 }
 
 void VKStateManager::unbind_from_all_namespaces(void *resource)
 {
-  uniform_buffers_.unbind(resource);
-  storage_buffers_.unbind(resource);
-  images_.unbind(resource);
-  textures_.unbind(resource);
-  is_dirty = true;
+  bool unbound = false;
+  unbound |= uniform_buffers_.unbind(resource);
+  unbound |= storage_buffers_.unbind(resource);
+  unbound |= images_.unbind(resource);
+  unbound |= textures_.unbind(resource);
+  if (unbound) {
+    is_dirty = true;
+  }
 }
 
 void VKStateManager::texel_buffer_bind(VKVertexBuffer &vertex_buffer, int binding)
@@ -129,8 +138,9 @@ void VKStateManager::texel_buffer_bind(VKVertexBuffer &vertex_buffer, int bindin
 
 void VKStateManager::texel_buffer_unbind(VKVertexBuffer &vertex_buffer)
 {
-  textures_.unbind(&vertex_buffer);
-  is_dirty = true;
+  if (textures_.unbind(&vertex_buffer)) {
+    is_dirty = true;
+  }
 }
 
 void VKStateManager::storage_buffer_bind(BindSpaceStorageBuffers::Type resource_type,
@@ -144,14 +154,16 @@ void VKStateManager::storage_buffer_bind(BindSpaceStorageBuffers::Type resource_
 
 void VKStateManager::storage_buffer_unbind(void *resource)
 {
-  storage_buffers_.unbind(resource);
-  is_dirty = true;
+  if (storage_buffers_.unbind(resource)) {
+    is_dirty = true;
+  }
 }
 
 void VKStateManager::storage_buffer_unbind_all()
 {
-  storage_buffers_.unbind_all();
-  is_dirty = true;
+  if (storage_buffers_.unbind_all()) {
+    is_dirty = true;
+  }
 }
 
 void VKStateManager::texture_unpack_row_length_set(uint len)
@@ -50,18 +50,23 @@ class BindSpaceUniformBuffers {
     return bound_resources[binding];
   }
 
-  void unbind(void *resource)
+  bool unbind(void *resource)
   {
+    bool unbound = false;
     for (int index : IndexRange(bound_resources.size())) {
       if (bound_resources[index] == resource) {
         bound_resources[index] = nullptr;
+        unbound = true;
       }
     }
+    return unbound;
   }
 
-  void unbind_all()
+  bool unbind_all()
   {
+    const bool unbound = !bound_resources.is_empty();
     bound_resources.clear();
+    return unbound;
   }
 };
 
@@ -91,18 +96,23 @@ template<int Offset> class BindSpaceImages {
     return bound_resources[binding];
   }
 
-  void unbind(void *resource)
+  bool unbind(void *resource)
   {
+    bool unbound = false;
     for (int index : IndexRange(bound_resources.size())) {
       if (bound_resources[index] == resource) {
         bound_resources[index] = nullptr;
+        unbound = true;
       }
     }
+    return unbound;
   }
 
-  void unbind_all()
+  bool unbind_all()
   {
+    const bool unbound = !bound_resources.is_empty();
     bound_resources.clear();
+    return unbound;
   }
 };
 
@@ -139,20 +149,25 @@ class BindSpaceStorageBuffers {
     return bound_resources[binding];
   }
 
-  void unbind(void *resource)
+  bool unbind(void *resource)
   {
+    bool unbound = false;
     for (int index : IndexRange(bound_resources.size())) {
       if (bound_resources[index].resource == resource) {
+        unbound = true;
         bound_resources[index].resource = nullptr;
         bound_resources[index].resource_type = Type::Unused;
         bound_resources[index].offset = 0u;
       }
     }
+    return unbound;
   }
 
-  void unbind_all()
+  bool unbind_all()
   {
+    const bool unbound = !bound_resources.is_empty();
     bound_resources.clear();
+    return unbound;
   }
 };
 
@@ -186,20 +201,25 @@ class BindSpaceTextures {
     return bound_resources[binding];
   }
 
-  void unbind(void *resource)
+  bool unbind(void *resource)
   {
+    bool unbound = false;
     for (int index : IndexRange(bound_resources.size())) {
       if (bound_resources[index].resource == resource) {
+        unbound = true;
         bound_resources[index].resource = nullptr;
         bound_resources[index].resource_type = Type::Unused;
         bound_resources[index].sampler = GPUSamplerState::default_sampler();
       }
     }
+    return unbound;
   }
 
-  void unbind_all()
+  bool unbind_all()
   {
+    const bool unbound = !bound_resources.is_empty();
     bound_resources.clear();
+    return unbound;
   }
 };
 
@@ -214,6 +234,11 @@ class VKStateManager : public StateManager {
   BindSpaceStorageBuffers storage_buffers_;
 
  public:
+  /**
+   * Bindings changed since the last descriptor set was allocated. Unbinding resources that
+   * aren't bound doesn't tag the state dirty. Textures and buffers unbind themselves from all
+   * namespaces when freed, which would otherwise force a new descriptor set for the next draw.
+   */
   bool is_dirty = false;
 
   void apply_state() override;
@@ -28,6 +28,7 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_array.hh"
 #include "BLI_listbase.h"
 #include "BLI_math_color.h"
 #include "BLI_math_color.hh"
@@ -4065,13 +4066,16 @@ void IMB_colormanagement_processor_apply_byte(
    * but for now it's not so important.
    */
   BLI_assert(channels == 4);
-  float pixel[4];
+  /* Convert a row at a time, so OCIO processes whole rows instead of being invoked per pixel. */
+  blender::Array<float> row(size_t(channels) * width);
   for (int y = 0; y < height; y++) {
+    uchar *row_bytes = buffer + size_t(channels) * y * width;
     for (int x = 0; x < width; x++) {
-      size_t offset = channels * (size_t(y) * width + x);
-      rgba_uchar_to_float(pixel, buffer + offset);
-      IMB_colormanagement_processor_apply_v4(cm_processor, pixel);
-      rgba_float_to_uchar(buffer + offset, pixel);
+      rgba_uchar_to_float(&row[size_t(channels) * x], row_bytes + size_t(channels) * x);
+    }
+    IMB_colormanagement_processor_apply(cm_processor, row.data(), width, 1, channels, false);
+    for (int x = 0; x < width; x++) {
+      rgba_float_to_uchar(row_bytes + size_t(channels) * x, &row[size_t(channels) * x]);
     }
   }
 }
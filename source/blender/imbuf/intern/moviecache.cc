@@ -63,7 +63,12 @@ struct MovieCache {
   void *last_userkey;
 
   int totseg, *points, proxy, render_flags; /* for visual statistics optimization */
-  int pad;
+
+  /**
+   * Set when the cache limiter destroyed the buffer of one of the items, so that the keys without
+   * buffer only need to be looked for when there can be any.
+   */
+  bool has_destroyed_items;
 };
 
 struct MovieCacheKey {
@@ -178,6 +183,7 @@ static void moviecache_destructor(void *p)
 
     item->ibuf = nullptr;
     item->c_handle = nullptr;
+    cache->has_destroyed_items = true;
 
     /* force cached segments to be updated */
     MEM_SAFE_FREE(cache->points);
@@ -358,7 +364,10 @@ static void do_moviecache_put(MovieCache *cache, void *userkey, ImBuf *ibuf, boo
   }
 
   /* cache limiter can't remove unused keys which points to destroyed values */
-  check_unused_keys(cache);
+  if (cache->has_destroyed_items) {
+    cache->has_destroyed_items = false;
+    check_unused_keys(cache);
+  }
 
   MEM_SAFE_FREE(cache->points);
 }
@@ -1305,11 +1305,12 @@ void IMB_exr_read_channels(void *handle)
   for (int i = 0; i < numparts; i++) {
     /* Read part header. */
     InputPart in(*data->ifile, i);
-    Header header = in.header();
+    const Header &header = in.header();
     Box2i dw = header.dataWindow();
 
     /* Insert all matching channel into frame-buffer. */
     FrameBuffer frameBuffer;
+    bool has_slices = false;
 
     LISTBASE_FOREACH (ExrChannel *, echan, &data->channels) {
       if (echan->m->part_number != i) {
@@ -1341,9 +1342,15 @@ void IMB_exr_read_channels(void *handle)
 
         frameBuffer.insert(echan->m->internal_name,
                            Slice(Imf::FLOAT, (char *)rect, xstride, ystride));
+        has_slices = true;
       }
     }
 
+    /* Nothing is read from this part, avoid decompressing all of its chunks for nothing. */
+    if (!has_slices) {
+      continue;
+    }
+
     /* Read pixels. */
     try {
       in.setFrameBuffer(frameBuffer);
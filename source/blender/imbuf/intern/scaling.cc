@@ -234,7 +234,6 @@ MINLINE void premul_ushort_to_straight_uchar(uchar *result, const ushort color[4
 
 void imb_onehalf_no_alloc(ImBuf *ibuf2, ImBuf *ibuf1)
 {
-  int x, y;
   const bool do_rect = (ibuf1->byte_buffer.data != nullptr);
   const bool do_float = (ibuf1->float_buffer.data != nullptr) &&
                         (ibuf2->float_buffer.data != nullptr);
@@ -252,61 +251,56 @@ void imb_onehalf_no_alloc(ImBuf *ibuf2, ImBuf *ibuf1)
     return;
   }
 
-  if (do_rect) {
-    uchar *cp1, *cp2, *dest;
-
-    cp1 = ibuf1->byte_buffer.data;
-    dest = ibuf2->byte_buffer.data;
-
-    for (y = ibuf2->y; y > 0; y--) {
-      cp2 = cp1 + (ibuf1->x << 2);
-      for (x = ibuf2->x; x > 0; x--) {
-        ushort p1i[8], p2i[8], desti[4];
-
-        straight_uchar_to_premul_ushort(p1i, cp1);
-        straight_uchar_to_premul_ushort(p2i, cp2);
-        straight_uchar_to_premul_ushort(p1i + 4, cp1 + 4);
-        straight_uchar_to_premul_ushort(p2i + 4, cp2 + 4);
+  /* Each destination row only reads two source rows, so rows are independent. */
+  const int64_t src_stride = int64_t(ibuf1->x) * 4;
+  const int64_t dst_stride = int64_t(ibuf2->x) * 4;
 
-        desti[0] = (uint(p1i[0]) + p2i[0] + p1i[4] + p2i[4]) >> 2;
-        desti[1] = (uint(p1i[1]) + p2i[1] + p1i[5] + p2i[5]) >> 2;
-        desti[2] = (uint(p1i[2]) + p2i[2] + p1i[6] + p2i[6]) >> 2;
-        desti[3] = (uint(p1i[3]) + p2i[3] + p1i[7] + p2i[7]) >> 2;
-
-        premul_ushort_to_straight_uchar(dest, desti);
-
-        cp1 += 8;
-        cp2 += 8;
-        dest += 4;
-      }
-      cp1 = cp2;
-      if (ibuf1->x & 1) {
-        cp1 += 4;
-      }
-    }
+  if (do_rect) {
+    const uchar *src = ibuf1->byte_buffer.data;
+    uchar *dst = ibuf2->byte_buffer.data;
+    blender::threading::parallel_for(
+        blender::IndexRange(ibuf2->y), 64, [&](const blender::IndexRange y_range) {
+          for (const int64_t y : y_range) {
+            const uchar *cp1 = src + 2 * y * src_stride;
+            const uchar *cp2 = cp1 + src_stride;
+            uchar *dest = dst + y * dst_stride;
+            for (int x = ibuf2->x; x > 0; x--) {
+              ushort p1i[8], p2i[8], desti[4];
+
+              straight_uchar_to_premul_ushort(p1i, cp1);
+              straight_uchar_to_premul_ushort(p2i, cp2);
+              straight_uchar_to_premul_ushort(p1i + 4, cp1 + 4);
+              straight_uchar_to_premul_ushort(p2i + 4, cp2 + 4);
+
+              desti[0] = (uint(p1i[0]) + p2i[0] + p1i[4] + p2i[4]) >> 2;
+              desti[1] = (uint(p1i[1]) + p2i[1] + p1i[5] + p2i[5]) >> 2;
+              desti[2] = (uint(p1i[2]) + p2i[2] + p1i[6] + p2i[6]) >> 2;
+              desti[3] = (uint(p1i[3]) + p2i[3] + p1i[7] + p2i[7]) >> 2;
+
+              premul_ushort_to_straight_uchar(dest, desti);
+
+              cp1 += 8;
+              cp2 += 8;
+              dest += 4;
+            }
+          }
+        });
   }
 
   if (do_float) {
-    float *p1f, *p2f, *destf;
-
-    p1f = ibuf1->float_buffer.data;
-    destf = ibuf2->float_buffer.data;
-    for (y = ibuf2->y; y > 0; y--) {
-      p2f = p1f + (ibuf1->x << 2);
-      for (x = ibuf2->x; x > 0; x--) {
-        destf[0] = 0.25f * (p1f[0] + p2f[0] + p1f[4] + p2f[4]);
-        destf[1] = 0.25f * (p1f[1] + p2f[1] + p1f[5] + p2f[5]);
-        destf[2] = 0.25f * (p1f[2] + p2f[2] + p1f[6] + p2f[6]);
-        destf[3] = 0.25f * (p1f[3] + p2f[3] + p1f[7] + p2f[7]);
-        p1f += 8;
-        p2f += 8;
-        destf += 4;
-      }
-      p1f = p2f;
-      if (ibuf1->x & 1) {
-        p1f += 4;
-      }
-    }
+    const float *src = ibuf1->float_buffer.data;
+    float *dst = ibuf2->float_buffer.data;
+    blender::threading::parallel_for(
+        blender::IndexRange(ibuf2->y), 64, [&](const blender::IndexRange y_range) {
+          for (const int64_t y : y_range) {
+            const float4 *p1f = reinterpret_cast<const float4 *>(src + 2 * y * src_stride);
+            const float4 *p2f = reinterpret_cast<const float4 *>(src + (2 * y + 1) * src_stride);
+            float4 *destf = reinterpret_cast<float4 *>(dst + y * dst_stride);
+            for (int64_t x = 0; x < ibuf2->x; x++) {
+              destf[x] = 0.25f * (p1f[2 * x] + p2f[2 * x] + p1f[2 * x + 1] + p2f[2 * x + 1]);
+            }
+          }
+        });
   }
 }
 
@@ -17,6 +17,7 @@
 
 #include "BLI_path_utils.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
@@ -628,20 +629,27 @@ static void ffmpeg_postprocess(MovieReader *anim, AVFrame *input, ImBuf *ibuf)
                        anim->pFrameRGB->linesize[2] == src_linesize &&
                        anim->pFrameRGB->linesize[3] == src_linesize,
                    "ffmpeg frame should be 4 same size planes for a floating point image case");
-    for (int y = 0; y < ibuf->y; y++) {
-      size_t src_offset = src_linesize * (ibuf->y - y - 1);
-      const float *src_g = reinterpret_cast<const float *>(anim->pFrameRGB->data[0] + src_offset);
-      const float *src_b = reinterpret_cast<const float *>(anim->pFrameRGB->data[1] + src_offset);
-      const float *src_r = reinterpret_cast<const float *>(anim->pFrameRGB->data[2] + src_offset);
-      const float *src_a = reinterpret_cast<const float *>(anim->pFrameRGB->data[3] + src_offset);
-      float *dst = ibuf->float_buffer.data + ibuf->x * y * 4;
-      for (int x = 0; x < ibuf->x; x++) {
-        *dst++ = *src_r++;
-        *dst++ = *src_g++;
-        *dst++ = *src_b++;
-        *dst++ = *src_a++;
-      }
-    }
+    blender::threading::parallel_for(
+        blender::IndexRange(ibuf->y), 64, [&](const blender::IndexRange y_range) {
+          for (const int64_t y : y_range) {
+            size_t src_offset = src_linesize * (ibuf->y - y - 1);
+            const float *src_g = reinterpret_cast<const float *>(anim->pFrameRGB->data[0] +
+                                                                 src_offset);
+            const float *src_b = reinterpret_cast<const float *>(anim->pFrameRGB->data[1] +
+                                                                 src_offset);
+            const float *src_r = reinterpret_cast<const float *>(anim->pFrameRGB->data[2] +
+                                                                 src_offset);
+            const float *src_a = reinterpret_cast<const float *>(anim->pFrameRGB->data[3] +
+                                                                 src_offset);
+            float *dst = ibuf->float_buffer.data + size_t(ibuf->x) * y * 4;
+            for (int x = 0; x < ibuf->x; x++) {
+              *dst++ = *src_r++;
+              *dst++ = *src_g++;
+              *dst++ = *src_b++;
+              *dst++ = *src_a++;
+            }
+          }
+        });
   }
   else {
     /* If final destination image layout matches that of decoded RGB frame (including
@@ -48,6 +48,10 @@ class AbcMeshReader final : public AbcObjectReader {
                         const Alembic::Abc::ISampleSelector &sample_sel) override;
 
  private:
+  /** Same as #topology_changed, but compares against an already read sample. */
+  bool sample_topology_changed(const Mesh *existing_mesh,
+                               const Alembic::AbcGeom::IPolyMeshSchema::Sample &sample);
+
   void readFaceSetsSample(Main *bmain,
                           Mesh *mesh,
                           const Alembic::AbcGeom::ISampleSelector &sample_sel);
@@ -215,7 +215,8 @@ static Array<std::optional<GArray<>>> flatten_valid_attribute_chunks(
               /* This chunk was read entirely as integers, so it still has to be converted to
                * floats. */
               BLI_assert(int_vec->size() == dst_range.size());
-              uninitialized_convert_n(int_vec->data(), dst_range.size(), attribute_buffer);
+              uninitialized_convert_n(
+                  int_vec->data(), dst_range.size(), attribute_buffer + dst_range.first());
             }
             else {
               /* Expected data to be available, because the `found_invalid` flag was not
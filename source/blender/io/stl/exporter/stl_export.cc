@@ -15,8 +15,10 @@
 #include "BKE_report.hh"
 #include "BKE_scene.hh"
 
+#include "BLI_array.hh"
 #include "BLI_string.h"
 #include "BLI_string_utils.hh"
+#include "BLI_task.hh"
 
 #include "DEG_depsgraph_query.hh"
 
@@ -137,18 +139,32 @@ void export_frame(Depsgraph *depsgraph,
     /* Write triangles. */
     const Span<float3> positions = mesh->vert_positions();
     const Span<int> corner_verts = mesh->corner_verts();
-    for (const int3 &tri : mesh->corner_tris()) {
-      PackedTriangle data{};
-      for (int i = 0; i < 3; i++) {
-        /* Reverse face order for mirrored objects. */
-        int idx = mirrored ? 2 - i : i;
-        float3 pos = positions[corner_verts[tri[idx]]];
-        mul_m4_v3(xform, pos);
-        pos *= global_scale;
-        data.vertices[i] = pos;
-      }
-      data.normal = math::normal_tri(data.vertices[0], data.vertices[1], data.vertices[2]);
-      writer->write_triangle(data);
+    const Span<int3> corner_tris = mesh->corner_tris();
+    /* Fill blocks of triangles in parallel, so memory use stays bounded for dense meshes. */
+    const int64_t block_size = 64 * 1024;
+    Array<PackedTriangle> block(std::min<int64_t>(block_size, corner_tris.size()));
+    for (int64_t block_start = 0; block_start < corner_tris.size(); block_start += block_size) {
+      const IndexRange block_range = corner_tris.index_range().slice_safe(block_start,
+                                                                          block_size);
+      MutableSpan<PackedTriangle> block_tris = block.as_mutable_span().take_front(
+          block_range.size());
+      threading::parallel_for(block_range.index_range(), 4096, [&](const IndexRange range) {
+        for (const int64_t tri_i : range) {
+          const int3 &tri = corner_tris[block_range[tri_i]];
+          PackedTriangle data{};
+          for (int i = 0; i < 3; i++) {
+            /* Reverse face order for mirrored objects. */
+            int idx = mirrored ? 2 - i : i;
+            float3 pos = positions[corner_verts[tri[idx]]];
+            mul_m4_v3(xform, pos);
+            pos *= global_scale;
+            data.vertices[i] = pos;
+          }
+          data.normal = math::normal_tri(data.vertices[0], data.vertices[1], data.vertices[2]);
+          block_tris[tri_i] = data;
+        }
+      });
+      writer->write_triangles(block_tris);
     }
   }
   DEG_OBJECT_ITER_END;
@@ -11,6 +11,8 @@
 #include <cstdint>
 #include <cstdio>
 
+#include "BLI_span.hh"
+
 namespace blender::io::stl {
 
 struct PackedTriangle;
@@ -19,7 +21,8 @@ class FileWriter {
  public:
   FileWriter(const char *filepath, bool ascii);
   ~FileWriter();
-  void write_triangle(const PackedTriangle &data);
+  /** Write many triangles at once, ASCII text is formatted in parallel. */
+  void write_triangles(Span<PackedTriangle> tris);
 
  private:
   FILE *file_;
@@ -8,6 +8,7 @@
 #include "BLI_math_quaternion_types.hh"
 #include "BLI_math_vector_types.hh"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 #include "BLI_virtual_array.hh"
 
 #include "BKE_attribute.hh"
@@ -178,9 +179,13 @@ void copy_blender_buffer_to_primvar(const VArray<BlenderT> &buffer,
     }
     else {
       usd_data.resize(data.size());
-      for (const int i : data.index_range()) {
-        usd_data[i] = detail::convert_value<BlenderT, USDT>(data[i]);
-      }
+      /* Write through a span, #pxr::VtArray checks for copy-on-write on every element access. */
+      MutableSpan<USDT> dst(usd_data.data(), usd_data.size());
+      threading::parallel_for(data.index_range(), 4096, [&](const IndexRange range) {
+        for (const int i : range) {
+          dst[i] = detail::convert_value<BlenderT, USDT>(data[i]);
+        }
+      });
     }
   }
 
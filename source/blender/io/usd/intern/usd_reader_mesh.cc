@@ -17,6 +17,7 @@
 #include "BKE_attribute.hh"
 #include "BKE_customdata.hh"
 #include "BKE_geometry_set.hh"
+#include "BKE_lib_id.hh"
 #include "BKE_main.hh"
 #include "BKE_material.hh"
 #include "BKE_mesh.hh"
@@ -175,17 +176,39 @@ void USDMeshReader::create_object(Main *bmain, const double /*motionSampleTime*/
   object_->data = mesh;
 }
 
-void USDMeshReader::read_object_data(Main *bmain, const double motionSampleTime)
+USDMeshReader::~USDMeshReader()
 {
+  /* Only free a mesh that was left unused, e.g. when the import was canceled. */
+  if (prepared_mesh_ && (prepared_mesh_->id.tag & ID_TAG_NO_MAIN)) {
+    BKE_id_free(nullptr, prepared_mesh_);
+  }
+}
+
+void USDMeshReader::read_object_data_prepare(const double motionSampleTime)
+{
+  /* Reads the USD data into a new mesh outside of #Main. The mesh in #Main is only used as
+   * template, it is modified in place only when the USD mesh is empty. */
   Mesh *mesh = (Mesh *)object_->data;
 
   is_initial_load_ = true;
   const USDMeshReadParams params = create_mesh_read_params(motionSampleTime,
                                                            import_params_.mesh_read_flag);
 
-  Mesh *read_mesh = this->read_mesh(mesh, params, nullptr);
+  prepared_mesh_ = this->read_mesh(mesh, params, nullptr);
 
   is_initial_load_ = false;
+}
+
+void USDMeshReader::read_object_data(Main *bmain, const double motionSampleTime)
+{
+  Mesh *mesh = (Mesh *)object_->data;
+
+  if (prepared_mesh_ == nullptr) {
+    read_object_data_prepare(motionSampleTime);
+  }
+  Mesh *read_mesh = prepared_mesh_;
+  prepared_mesh_ = nullptr;
+
   if (read_mesh != mesh) {
     BKE_mesh_nomain_to_mesh(read_mesh, mesh, object_);
   }
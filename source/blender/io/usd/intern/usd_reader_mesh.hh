@@ -39,6 +39,9 @@ class USDMeshReader : public USDGeomReader {
    * implemented.  Note this will break if faces or positions vary. */
   bool is_initial_load_ = false;
 
+  /* Mesh read by #read_object_data_prepare, consumed by #read_object_data. */
+  Mesh *prepared_mesh_ = nullptr;
+
  public:
   USDMeshReader(const pxr::UsdPrim &prim,
                 const USDImportParams &import_params,
@@ -46,6 +49,7 @@ class USDMeshReader : public USDGeomReader {
       : USDGeomReader(prim, import_params, settings), mesh_prim_(prim)
   {
   }
+  ~USDMeshReader() override;
 
   bool valid() const override
   {
@@ -53,6 +57,7 @@ class USDMeshReader : public USDGeomReader {
   }
 
   void create_object(Main *bmain, double motionSampleTime) override;
+  void read_object_data_prepare(double motionSampleTime) override;
   void read_object_data(Main *bmain, double motionSampleTime) override;
 
   void read_geometry(bke::GeometrySet &geometry_set,
@@ -96,6 +96,11 @@ class USDPrimReader {
 
   virtual void create_object(Main *bmain, double motionSampleTime) = 0;
   virtual void read_object_data(Main * /*bmain*/, double /*motionSampleTime*/){};
+  /**
+   * Read the parts of the object data that don't touch #Main ahead of #read_object_data.
+   * Called after #create_object, possibly from multiple threads for different readers.
+   */
+  virtual void read_object_data_prepare(double /*motionSampleTime*/){};
 
   Object *object() const;
   void object(Object *ob);
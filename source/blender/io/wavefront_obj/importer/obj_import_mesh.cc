@@ -7,6 +7,7 @@
  */
 
 #include <algorithm>
+#include <atomic>
 
 #include "DNA_customdata_types.h"
 #include "DNA_material_types.h"
@@ -23,6 +24,7 @@
 
 #include "BLI_math_vector.h"
 #include "BLI_set.hh"
+#include "BLI_task.hh"
 
 #include "IO_wavefront_obj.hh"
 #include "importer_mesh_utils.hh"
@@ -318,24 +320,34 @@ void MeshFromGeometry::create_uv_verts(Mesh *mesh)
   bke::SpanAttributeWriter<float2> uv_map = attributes.lookup_or_add_for_write_only_span<float2>(
       "UVMap", bke::AttrDomain::Corner);
 
-  int corner_index = 0;
-  bool added_uv = false;
-
-  for (const FaceElem &curr_face : mesh_geometry_.face_elements_) {
-    for (int idx = 0; idx < curr_face.corner_count_; ++idx) {
-      const FaceCorner &curr_corner = mesh_geometry_.face_corners_[curr_face.start_index_ + idx];
-      if (curr_corner.uv_vert_index >= 0 &&
-          curr_corner.uv_vert_index < global_vertices_.uv_vertices.size())
-      {
-        uv_map.span[corner_index] = global_vertices_.uv_vertices[curr_corner.uv_vert_index];
-        added_uv = true;
-      }
-      else {
-        uv_map.span[corner_index] = {0.0f, 0.0f};
+  /* Faces have been created already, use their offsets to fill the corners in parallel. */
+  const OffsetIndices faces = mesh->faces();
+  std::atomic<bool> added_uv = false;
+
+  threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+    bool added_uv_in_range = false;
+    for (const int face_idx : range) {
+      const FaceElem &curr_face = mesh_geometry_.face_elements_[face_idx];
+      const int corner_start = faces[face_idx].start();
+      for (int idx = 0; idx < curr_face.corner_count_; ++idx) {
+        const FaceCorner &curr_corner =
+            mesh_geometry_.face_corners_[curr_face.start_index_ + idx];
+        if (curr_corner.uv_vert_index >= 0 &&
+            curr_corner.uv_vert_index < global_vertices_.uv_vertices.size())
+        {
+          uv_map.span[corner_start + idx] =
+              global_vertices_.uv_vertices[curr_corner.uv_vert_index];
+          added_uv_in_range = true;
+        }
+        else {
+          uv_map.span[corner_start + idx] = {0.0f, 0.0f};
+        }
       }
-      corner_index++;
     }
-  }
+    if (added_uv_in_range) {
+      added_uv.store(true, std::memory_order_relaxed);
+    }
+  });
 
   uv_map.finish();
 
@@ -409,20 +421,24 @@ void MeshFromGeometry::create_normals(Mesh *mesh)
     return;
   }
 
+  const OffsetIndices faces = mesh->faces();
   Array<float3> corner_normals(mesh_geometry_.total_corner_);
-  int corner_index = 0;
-  for (const FaceElem &curr_face : mesh_geometry_.face_elements_) {
-    for (int idx = 0; idx < curr_face.corner_count_; ++idx) {
-      const FaceCorner &curr_corner = mesh_geometry_.face_corners_[curr_face.start_index_ + idx];
-      int n_index = curr_corner.vertex_normal_index;
-      float3 normal(0, 0, 0);
-      if (n_index >= 0 && n_index < global_vertices_.vert_normals.size()) {
-        normal = global_vertices_.vert_normals[n_index];
+  threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+    for (const int face_idx : range) {
+      const FaceElem &curr_face = mesh_geometry_.face_elements_[face_idx];
+      const int corner_start = faces[face_idx].start();
+      for (int idx = 0; idx < curr_face.corner_count_; ++idx) {
+        const FaceCorner &curr_corner =
+            mesh_geometry_.face_corners_[curr_face.start_index_ + idx];
+        int n_index = curr_corner.vertex_normal_index;
+        float3 normal(0, 0, 0);
+        if (n_index >= 0 && n_index < global_vertices_.vert_normals.size()) {
+          normal = global_vertices_.vert_normals[n_index];
+        }
+        corner_normals[corner_start + idx] = normal;
       }
-      corner_normals[corner_index] = normal;
-      corner_index++;
     }
-  }
+  });
   bke::mesh_set_custom_normals(*mesh, corner_normals);
 }
 
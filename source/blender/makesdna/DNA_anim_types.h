@@ -657,6 +657,13 @@ typedef struct FCurve {
   float color[3];
 
   float prev_norm_factor, prev_offset;
+
+  /**
+   * Index of the keyframe ending the segment found by the last evaluation of the curve. Only used
+   * as a starting point for the next evaluation, always validated before use.
+   */
+  int eval_segment_hint;
+  char _pad1[4];
 } FCurve;
 
 /* user-editable flags/settings */
@@ -1204,6 +1211,8 @@ typedef struct AnimData {
 
   /** Runtime data, for depsgraph evaluation. */
   FCurve **driver_array;
+  /** Runtime data, resolved RNA paths of the animation F-Curves of an evaluated ID. */
+  struct AnimDataPathCache *path_cache;
 
   /* settings for animation evaluation */
   /** User-defined settings. */
@@ -2905,6 +2905,7 @@ enum {
   SCE_EEVEE_SHADOW_JITTERED_VIEWPORT = (1 << 26),
   SCE_EEVEE_VOLUME_CUSTOM_RANGE = (1 << 27),
   SCE_EEVEE_FAST_GI_ENABLED = (1 << 28),
+  SCE_EEVEE_NAVIGATION_LOW_RESOLUTION = (1 << 29),
 };
 
 typedef enum RaytraceEEVEE_Flag {
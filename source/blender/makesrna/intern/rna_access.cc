@@ -4898,6 +4898,34 @@ static int rna_property_array_length_all_dimensions(PointerRNA *ptr, PropertyRNA
   return size;
 }
 
+/**
+ * Copy the values between the contiguous \a in array and the strided \a out array of a
+ * different raw type, using \a T for the conversion.
+ */
+template<typename T>
+static void rna_raw_array_convert(const RawArray &in,
+                                  const RawArray &out,
+                                  const int arraylen,
+                                  const bool set)
+{
+  for (int a = 0; a < out.len; a++) {
+    RawArray out_item = out;
+    out_item.array = (char *)out.array + size_t(a) * out.stride;
+    for (int j = 0; j < arraylen; j++) {
+      const int in_index = a * arraylen + j;
+      T value;
+      if (set) {
+        RAW_GET(T, value, in, in_index);
+        RAW_SET(T, out_item, j, value);
+      }
+      else {
+        RAW_GET(T, value, out_item, j);
+        RAW_SET(T, in, in_index, value);
+      }
+    }
+  }
+}
+
 static int rna_raw_access(ReportList *reports,
                           PointerRNA *ptr,
                           PropertyRNA *prop,
@@ -4990,8 +5018,22 @@ static int rna_raw_access(ReportList *reports,
         return 1;
       }
 
-      /* Could also be faster with non-matching types,
-       * for now we just do slower loop. */
+      /* Non-matching raw types, e.g. double values for a float property. Convert the values
+       * between the raw arrays directly, which is much faster than going through RNA for every
+       * item. */
+      switch (itemtype) {
+        case PROP_FLOAT:
+          rna_raw_array_convert<double>(in, out, arraylen, set);
+          break;
+        case PROP_BOOLEAN:
+          rna_raw_array_convert<bool>(in, out, arraylen, set);
+          break;
+        default:
+          rna_raw_array_convert<int64_t>(in, out, arraylen, set);
+          break;
+      }
+
+      return 1;
     }
     BLI_assert_msg(itemlen == 0 || itemtype != PROP_ENUM,
                    "Enum array properties should not exist");
@@ -8088,6 +8088,15 @@ static void rna_def_scene_eevee(BlenderRNA *brna)
                            "enabled for final renders).");
   RNA_def_property_update(prop, NC_SCENE | ND_RENDER_OPTIONS, nullptr);
 
+  prop = RNA_def_property(srna, "use_low_resolution_navigation", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, nullptr, "flag", SCE_EEVEE_NAVIGATION_LOW_RESOLUTION);
+  RNA_def_property_ui_text(prop,
+                           "Lower Resolution While Navigating",
+                           "Render the viewport with twice the pixel size while navigating or "
+                           "transforming. The full resolution is accumulated again once the view "
+                           "stops moving");
+  RNA_def_property_update(prop, NC_SCENE | ND_RENDER_OPTIONS, nullptr);
+
   /* Clamping */
   prop = RNA_def_property(srna, "clamp_surface_direct", PROP_FLOAT, PROP_NONE);
   RNA_def_property_ui_text(prop,
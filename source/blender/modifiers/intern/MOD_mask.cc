@@ -362,8 +362,16 @@ static void add_interp_verts_copy_edges_to_new_mesh(const Mesh &src_mesh,
   const Span<int2> src_edges = src_mesh.edges();
   MutableSpan<int2> dst_edges = dst_mesh.edges_for_write();
 
-  uint vert_index = dst_mesh.verts_num - verts_add_num;
+  const uint vert_start = dst_mesh.verts_num - verts_add_num;
+  uint vert_index = vert_start;
   uint edge_index = edges_masked_num - verts_add_num;
+
+  /* Every new vertex is interpolated from the two vertices of the cut edge. */
+  Array<int> interp_offsets(verts_add_num + 1);
+  blender::offset_indices::fill_constant_group_size(2, 0, interp_offsets);
+  Array<int> interp_indices(verts_add_num * 2);
+  Array<float> interp_weights(verts_add_num * 2);
+
   for (int i_src : IndexRange(src_mesh.edges_num)) {
     if (r_edge_map[i_src] != -1) {
       int i_dst = r_edge_map[i_src];
@@ -396,19 +404,23 @@ static void add_interp_verts_copy_edges_to_new_mesh(const Mesh &src_mesh,
       float fac = get_interp_factor_from_vgroup(
           dvert, defgrp_index, threshold, e_src[0], e_src[1]);
 
-      float weights[2] = {1.0f - fac, fac};
-      CustomData_interp(&src_mesh.vert_data,
-                        &dst_mesh.vert_data,
-                        (int *)&e_src[0],
-                        weights,
-                        nullptr,
-                        2,
-                        vert_index);
+      const int interp_i = (vert_index - vert_start) * 2;
+      interp_indices[interp_i] = e_src[0];
+      interp_indices[interp_i + 1] = e_src[1];
+      interp_weights[interp_i] = 1.0f - fac;
+      interp_weights[interp_i + 1] = fac;
       vert_index++;
     }
   }
   BLI_assert(vert_index == dst_mesh.verts_num);
   BLI_assert(edge_index == edges_masked_num);
+
+  CustomData_interp_batch(&src_mesh.vert_data,
+                          &dst_mesh.vert_data,
+                          blender::OffsetIndices<int>(interp_offsets),
+                          interp_indices,
+                          interp_weights,
+                          vert_start);
 }
 
 static void copy_masked_edges_to_new_mesh(const Mesh &src_mesh,
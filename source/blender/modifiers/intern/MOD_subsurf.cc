@@ -76,14 +76,7 @@ static void free_runtime_data(void *runtime_data_v)
   if (runtime_data_v == nullptr) {
     return;
   }
-  SubsurfRuntimeData *runtime_data = (SubsurfRuntimeData *)runtime_data_v;
-  if (runtime_data->subdiv_cpu != nullptr) {
-    blender::bke::subdiv::free(runtime_data->subdiv_cpu);
-  }
-  if (runtime_data->subdiv_gpu != nullptr) {
-    blender::bke::subdiv::free(runtime_data->subdiv_gpu);
-  }
-  MEM_freeN(runtime_data);
+  BKE_subsurf_modifier_runtime_free(static_cast<SubsurfRuntimeData *>(runtime_data_v));
 }
 
 static void free_data(ModifierData *md)
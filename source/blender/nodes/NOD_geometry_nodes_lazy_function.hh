@@ -455,6 +455,17 @@ void set_default_value_for_output_socket(lf::Params &params,
                                          const int lf_index,
                                          const bNodeSocket &bsocket);
 
+/**
+ * Executes a geometry node, but reuses its outputs from a previous evaluation if the inputs and
+ * node properties are the same. See #NodeDeclaration::allow_output_caching. All inputs have to be
+ * available already.
+ */
+void execute_geometry_node_with_output_cache(const bNode &node,
+                                             const LazyFunction &fn,
+                                             lf::Params &params,
+                                             const lf::Context &context,
+                                             FunctionRef<void(lf::Params &params)> execute_fn);
+
 std::string make_anonymous_attribute_socket_inspection_string(const bNodeSocket &socket);
 std::string make_anonymous_attribute_socket_inspection_string(StringRef node_name,
                                                               StringRef socket_name);
@@ -142,6 +142,8 @@ class GeometryInfoLog : public ValueLog {
   std::string name;
   Vector<GeometryAttributeInfo> attributes;
   Vector<bke::GeometryComponent::Type> component_types;
+  /** Approximate memory used by the geometry. Data shared between components is counted once. */
+  int64_t memory_bytes = 0;
 
   struct MeshInfo {
     int verts_num, edges_num, faces_num;
@@ -564,6 +564,13 @@ class NodeDeclaration {
    */
   bool is_context_dependent = false;
 
+  /**
+   * The outputs of the node only depend on its inputs and properties, so they can be reused in
+   * later evaluations when neither of those changed. This should only be used for expensive nodes
+   * that don't store pointers in #bNode::storage.
+   */
+  bool allow_output_caching = false;
+
   friend NodeDeclarationBuilder;
 
   /** Asserts that the declaration is considered valid. */
@@ -621,6 +628,14 @@ class NodeDeclarationBuilder : public DeclarationListBuilder {
     is_function_node_ = true;
   }
 
+  /**
+   * See #NodeDeclaration::allow_output_caching.
+   */
+  void allow_output_caching()
+  {
+    declaration_.allow_output_caching = true;
+  }
+
   void finalize();
 
   void use_custom_socket_order(bool enable = true);
@@ -84,7 +84,10 @@ class CompositeOperation : public NodeOperation {
       GPU_texture_clear(output, GPU_DATA_FLOAT, color);
     }
     else {
-      parallel_for(domain.size, [&](const int2 texel) { output.store_pixel(texel, color); });
+      /* Only fill the compositing region, like the other execution paths. */
+      const Bounds<int2> bounds = get_output_bounds();
+      parallel_for(domain.size,
+                   [&](const int2 texel) { output.store_pixel(texel + bounds.min, color); });
     }
   }
 
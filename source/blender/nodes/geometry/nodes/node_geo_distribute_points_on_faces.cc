@@ -28,6 +28,7 @@ namespace blender::nodes::node_geo_distribute_points_on_faces_cc {
 
 static void node_declare(NodeDeclarationBuilder &b)
 {
+  b.allow_output_caching();
   auto enable_random = [](bNode &node) {
     node.custom1 = GEO_NODE_POINT_DISTRIBUTE_POINTS_ON_FACES_RANDOM;
   };
@@ -114,7 +115,9 @@ static void sample_mesh_surface(const Mesh &mesh,
   const Span<int> corner_verts = mesh.corner_verts();
   const Span<int3> corner_tris = mesh.corner_tris();
 
-  for (const int tri_i : corner_tris.index_range()) {
+  /* Every triangle has its own random number generator, so the points can be generated for all
+   * triangles in parallel. The generator has to be used in the same order in both passes below. */
+  auto sample_point_amount = [&](const int tri_i, RandomNumberGenerator &rng) {
     const int3 &tri = corner_tris[tri_i];
     const int v0_loop = tri[0];
     const int v1_loop = tri[1];
@@ -132,22 +135,46 @@ static void sample_mesh_surface(const Mesh &mesh,
                                   3.0f;
     }
     const float area = area_tri_v3(v0_pos, v1_pos, v2_pos);
+    return rng.round_probabilistic(area * base_density * corner_tri_density_factor);
+  };
 
-    const int corner_tri_seed = noise::hash(tri_i, seed);
-    RandomNumberGenerator corner_tri_rng(corner_tri_seed);
-
-    const int point_amount = corner_tri_rng.round_probabilistic(area * base_density *
-                                                                corner_tri_density_factor);
-
-    for (int i = 0; i < point_amount; i++) {
-      const float3 bary_coord = corner_tri_rng.get_barycentric_coordinates();
-      float3 point_pos;
-      interp_v3_v3v3v3(point_pos, v0_pos, v1_pos, v2_pos, bary_coord);
-      r_positions.append(point_pos);
-      r_bary_coords.append(bary_coord);
-      r_tri_indices.append(tri_i);
+  /* Count the points on every triangle first to know where their results are stored. */
+  Array<int> point_offset_data(corner_tris.size() + 1);
+  threading::parallel_for(corner_tris.index_range(), 2048, [&](const IndexRange range) {
+    for (const int tri_i : range) {
+      RandomNumberGenerator corner_tri_rng(noise::hash(tri_i, seed));
+      point_offset_data[tri_i] = sample_point_amount(tri_i, corner_tri_rng);
     }
-  }
+  });
+  const OffsetIndices<int> points_by_tri = offset_indices::accumulate_counts_to_offsets(
+      point_offset_data);
+
+  r_positions.resize(points_by_tri.total_size());
+  r_bary_coords.resize(points_by_tri.total_size());
+  r_tri_indices.resize(points_by_tri.total_size());
+  threading::parallel_for(
+      corner_tris.index_range(),
+      2048,
+      [&](const IndexRange range) {
+        for (const int tri_i : range) {
+          RandomNumberGenerator corner_tri_rng(noise::hash(tri_i, seed));
+          sample_point_amount(tri_i, corner_tri_rng);
+
+          const int3 &tri = corner_tris[tri_i];
+          const float3 &v0_pos = positions[corner_verts[tri[0]]];
+          const float3 &v1_pos = positions[corner_verts[tri[1]]];
+          const float3 &v2_pos = positions[corner_verts[tri[2]]];
+          for (const int point_i : points_by_tri[tri_i]) {
+            const float3 bary_coord = corner_tri_rng.get_barycentric_coordinates();
+            interp_v3_v3v3v3(r_positions[point_i], v0_pos, v1_pos, v2_pos, bary_coord);
+            r_bary_coords[point_i] = bary_coord;
+            r_tri_indices[point_i] = tri_i;
+          }
+        }
+      },
+      threading::accumulated_task_sizes([&](const IndexRange range) {
+        return points_by_tri[range].size() + range.size();
+      }));
 }
 
 BLI_NOINLINE static KDTree_3d *build_kdtree(Span<float3> positions)
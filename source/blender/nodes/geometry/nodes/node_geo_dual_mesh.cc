@@ -330,7 +330,7 @@ static bool sort_vertex_faces(const Span<int2> edges,
   }
 
   /* For each face store the two corners whose edge contains the vertex. */
-  Array<std::pair<int, int>> face_vertex_corners(connected_faces.size());
+  Array<std::pair<int, int>, 16> face_vertex_corners(connected_faces.size());
   for (const int i : connected_faces.index_range()) {
     bool first_edge_done = false;
     for (const int corner : faces[connected_faces[i]]) {
@@ -628,8 +628,11 @@ static Mesh *calc_dual_mesh(const Mesh &src_mesh,
   Array<int> vert_to_face_indices = src_mesh.vert_to_face_map().data;
   const OffsetIndices<int> vert_to_face_offsets = src_mesh.vert_to_face_map().offsets;
 
-  Array<Array<int>> vertex_shared_edges(src_mesh.verts_num);
-  Array<Array<int>> vertex_corners(src_mesh.verts_num);
+  /* The sorted corners and shared edges of every vertex are stored in flat arrays with the same
+   * offsets as the vertex to face map, to avoid separate allocations for every vertex. Boundary
+   * vertices have one shared edge less than connected faces. */
+  Array<int> vertex_shared_edges_data(vert_to_face_indices.size());
+  Array<int> vertex_corners_data(vert_to_face_indices.size());
   threading::parallel_for(src_positions.index_range(), 512, [&](IndexRange range) {
     for (const int i : range) {
       if (vertex_types[i] == VertexType::Loose || vertex_types[i] >= VertexType::NonManifold ||
@@ -638,12 +641,13 @@ static Mesh *calc_dual_mesh(const Mesh &src_mesh,
         /* Bad vertex that we can't work with. */
         continue;
       }
-      MutableSpan<int> corner_indices = vert_to_face_indices.as_mutable_span().slice(
-          vert_to_face_offsets[i]);
-      Array<int> sorted_corners(corner_indices.size());
+      const IndexRange vert_corners = vert_to_face_offsets[i];
+      MutableSpan<int> corner_indices = vert_to_face_indices.as_mutable_span().slice(vert_corners);
+      MutableSpan<int> shared_edges = vertex_shared_edges_data.as_mutable_span().slice(
+          vert_corners);
+      MutableSpan<int> sorted_corners = vertex_corners_data.as_mutable_span().slice(vert_corners);
       bool vertex_ok = true;
       if (vertex_types[i] == VertexType::Normal) {
-        Array<int> shared_edges(corner_indices.size());
         vertex_ok = sort_vertex_faces(src_edges,
                                       src_faces,
                                       src_corner_verts,
@@ -654,10 +658,8 @@ static Mesh *calc_dual_mesh(const Mesh &src_mesh,
                                       corner_indices,
                                       shared_edges,
                                       sorted_corners);
-        vertex_shared_edges[i] = std::move(shared_edges);
       }
       else {
-        Array<int> shared_edges(corner_indices.size() - 1);
         vertex_ok = sort_vertex_faces(src_edges,
                                       src_faces,
                                       src_corner_verts,
@@ -666,17 +668,14 @@ static Mesh *calc_dual_mesh(const Mesh &src_mesh,
                                       true,
                                       edge_types,
                                       corner_indices,
-                                      shared_edges,
+                                      shared_edges.drop_back(1),
                                       sorted_corners);
-        vertex_shared_edges[i] = std::move(shared_edges);
       }
       if (!vertex_ok) {
         /* The sorting failed which means that the vertex is non-manifold and should be ignored
          * further on. */
         vertex_types[i] = VertexType::NonManifold;
-        continue;
       }
-      vertex_corners[i] = std::move(sorted_corners);
     }
   });
 
@@ -740,8 +739,11 @@ static Mesh *calc_dual_mesh(const Mesh &src_mesh,
     }
 
     Vector<int> corner_indices = vert_to_face_map[i];
-    Span<int> shared_edges = vertex_shared_edges[i];
-    Span<int> sorted_corners = vertex_corners[i];
+    Span<int> shared_edges = vertex_shared_edges_data.as_span().slice(vert_to_face_offsets[i]);
+    Span<int> sorted_corners = vertex_corners_data.as_span().slice(vert_to_face_offsets[i]);
+    if (vertex_types[i] == VertexType::Boundary) {
+      shared_edges = shared_edges.drop_back(1);
+    }
     if (vertex_types[i] == VertexType::Normal) {
       if (corner_indices.size() <= 2) {
         /* We can't make a face from 2 vertices. */
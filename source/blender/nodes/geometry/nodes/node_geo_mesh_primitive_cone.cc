@@ -22,6 +22,7 @@ NODE_STORAGE_FUNCS(NodeGeometryMeshCone)
 
 static void node_declare(NodeDeclarationBuilder &b)
 {
+  b.allow_output_caching();
   b.add_input<decl::Int>("Vertices")
       .default_value(32)
       .min(3)
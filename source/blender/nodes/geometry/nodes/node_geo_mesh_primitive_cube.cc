@@ -19,6 +19,7 @@ namespace blender::nodes::node_geo_mesh_primitive_cube_cc {
 
 static void node_declare(NodeDeclarationBuilder &b)
 {
+  b.allow_output_caching();
   b.add_input<decl::Vector>("Size")
       .default_value(float3(1))
       .min(0.0f)
@@ -12,6 +12,7 @@ namespace blender::nodes::node_geo_mesh_primitive_grid_cc {
 
 static void node_declare(NodeDeclarationBuilder &b)
 {
+  b.allow_output_caching();
   b.add_input<decl::Float>("Size X")
       .default_value(1.0f)
       .min(0.0f)
@@ -18,6 +18,7 @@ namespace blender::nodes::node_geo_mesh_primitive_ico_sphere_cc {
 
 static void node_declare(NodeDeclarationBuilder &b)
 {
+  b.allow_output_caching();
   b.add_input<decl::Float>("Radius")
       .default_value(1.0f)
       .min(0.0f)
@@ -246,15 +246,24 @@ class LazyFunctionForGeometryNode : public LazyFunction {
       return this->anonymous_attribute_name_for_output(*user_data, i);
     };
 
-    GeoNodeExecParams geo_params{
-        node_,
-        params,
-        context,
-        own_lf_graph_info_.mapping.lf_input_index_for_output_bsocket_usage,
-        own_lf_graph_info_.mapping.lf_input_index_for_reference_set_for_output,
-        get_anonymous_attribute_name};
-
-    node_.typeinfo->geometry_node_execute(geo_params);
+    auto execute_node = [&](lf::Params &node_params) {
+      GeoNodeExecParams geo_params{
+          node_,
+          node_params,
+          context,
+          own_lf_graph_info_.mapping.lf_input_index_for_output_bsocket_usage,
+          own_lf_graph_info_.mapping.lf_input_index_for_reference_set_for_output,
+          get_anonymous_attribute_name};
+
+      node_.typeinfo->geometry_node_execute(geo_params);
+    };
+
+    if (node_.declaration()->allow_output_caching) {
+      execute_geometry_node_with_output_cache(node_, *this, params, context, execute_node);
+    }
+    else {
+      execute_node(params);
+    }
   }
 
   std::string input_name(const int index) const override
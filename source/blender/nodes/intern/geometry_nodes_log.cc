@@ -5,6 +5,7 @@
 #include "NOD_geometry_nodes_log.hh"
 
 #include "BLI_listbase.h"
+#include "BLI_memory_counter.hh"
 #include "BLI_string_ref.hh"
 #include "BLI_string_utf8.h"
 
@@ -12,6 +13,7 @@
 #include "BKE_compute_contexts.hh"
 #include "BKE_curves.hh"
 #include "BKE_geometry_nodes_gizmos_transforms.hh"
+#include "BKE_instances.hh"
 #include "BKE_node_legacy_types.hh"
 #include "BKE_node_runtime.hh"
 #include "BKE_node_socket_value.hh"
@@ -61,28 +63,79 @@ FieldInfoLog::FieldInfoLog(const GField &field) : type(field.cpp_type())
 {
   const std::shared_ptr<const fn::FieldInputs> &field_input_nodes = field.node().field_inputs();
 
-  /* Put the deduplicated field inputs into a vector so that they can be sorted below. */
-  Vector<std::reference_wrapper<const FieldInput>> field_inputs;
+  /* Put the deduplicated field inputs into a vector so that they can be sorted below. The
+   * inspection names are only built once, instead of in every comparison. */
+  struct NamedFieldInput {
+    int category;
+    std::string name;
+  };
+  Vector<NamedFieldInput> field_inputs;
   if (field_input_nodes) {
-    field_inputs.extend(field_input_nodes->deduplicated_nodes.begin(),
-                        field_input_nodes->deduplicated_nodes.end());
+    for (const FieldInput &field_input : field_input_nodes->deduplicated_nodes) {
+      field_inputs.append({int(field_input.category()), field_input.socket_inspection_name()});
+    }
   }
 
-  std::sort(
-      field_inputs.begin(), field_inputs.end(), [](const FieldInput &a, const FieldInput &b) {
-        const int index_a = int(a.category());
-        const int index_b = int(b.category());
-        if (index_a == index_b) {
-          return a.socket_inspection_name().size() < b.socket_inspection_name().size();
-        }
-        return index_a < index_b;
-      });
+  std::sort(field_inputs.begin(),
+            field_inputs.end(),
+            [](const NamedFieldInput &a, const NamedFieldInput &b) {
+              if (a.category == b.category) {
+                return a.name.size() < b.name.size();
+              }
+              return a.category < b.category;
+            });
 
-  for (const FieldInput &field_input : field_inputs) {
-    this->input_tooltips.append(field_input.socket_inspection_name());
+  for (NamedFieldInput &field_input : field_inputs) {
+    this->input_tooltips.append(std::move(field_input.name));
   }
 }
 
+/**
+ * Same as #GeometrySet::attribute_foreach with instances included, but components that are
+ * referenced many times in an instance tree are only visited once. Since only the attribute names
+ * are logged, visiting them again would not add any information, but can make logging large
+ * instance trees expensive.
+ */
+static void foreach_unique_component_attribute(
+    const bke::GeometrySet &geometry_set,
+    const Span<bke::GeometryComponent::Type> component_types,
+    const FunctionRef<void(StringRef, const bke::AttributeMetaData &)> fn,
+    Set<const bke::GeometryComponent *> &visited_components)
+{
+  bool visit_instances = false;
+  for (const bke::GeometryComponent::Type component_type : component_types) {
+    const bke::GeometryComponent *component = geometry_set.get_component(component_type);
+    if (component == nullptr || !visited_components.add(component)) {
+      continue;
+    }
+    if (component_type == bke::GeometryComponent::Type::Instance) {
+      visit_instances = true;
+    }
+    if (const std::optional<bke::AttributeAccessor> attributes = component->attributes()) {
+      attributes->foreach_attribute(
+          [&](const bke::AttributeIter &iter) { fn(iter.name, {iter.domain, iter.data_type}); });
+    }
+  }
+  if (!visit_instances) {
+    return;
+  }
+  if (const bke::Instances *instances = geometry_set.get_instances()) {
+    instances->foreach_referenced_geometry([&](const bke::GeometrySet &instance_geometry) {
+      foreach_unique_component_attribute(
+          instance_geometry, component_types, fn, visited_components);
+    });
+  }
+}
+
+static void foreach_unique_component_attribute(
+    const bke::GeometrySet &geometry_set,
+    const Span<bke::GeometryComponent::Type> component_types,
+    const FunctionRef<void(StringRef, const bke::AttributeMetaData &)> fn)
+{
+  Set<const bke::GeometryComponent *> visited_components;
+  foreach_unique_component_attribute(geometry_set, component_types, fn, visited_components);
+}
+
 GeometryInfoLog::GeometryInfoLog(const bke::GeometrySet &geometry_set)
 {
   this->name = geometry_set.name;
@@ -99,17 +152,20 @@ GeometryInfoLog::GeometryInfoLog(const bke::GeometrySet &geometry_set)
    * attributes with the same name but different domains or data types on separate components. */
   Set<StringRef> names;
 
-  geometry_set.attribute_foreach(
+  foreach_unique_component_attribute(
+      geometry_set,
       all_component_types,
-      true,
-      [&](const StringRef attribute_id,
-          const bke::AttributeMetaData &meta_data,
-          const bke::GeometryComponent & /*component*/) {
+      [&](const StringRef attribute_id, const bke::AttributeMetaData &meta_data) {
         if (!bke::attribute_name_is_anonymous(attribute_id) && names.add(attribute_id)) {
           this->attributes.append({attribute_id, meta_data.domain, meta_data.data_type});
         }
       });
 
+  memory_counter::MemoryCount memory_count;
+  memory_counter::MemoryCounter memory{memory_count};
+  geometry_set.count_memory(memory);
+  this->memory_bytes = memory_count.total_bytes;
+
   for (const bke::GeometryComponent *component : geometry_set.get_components()) {
     this->component_types.append(component->type());
     switch (component->type()) {
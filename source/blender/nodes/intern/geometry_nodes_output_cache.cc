@@ -0,0 +1,458 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/**
+ * Reuses the outputs of expensive geometry nodes across evaluations when neither their inputs nor
+ * their properties changed. The outputs are stored in the global #memory_cache, so that memory
+ * usage is limited by the same setting as other cached data.
+ *
+ * Input geometries are not hashed by content. Instead, every attribute array is identified by its
+ * #ImplicitSharingInfo and the version of that sharing info. Since the evaluated geometry of an
+ * object shares the arrays of the original geometry, this key stays the same across evaluations
+ * as long as the data is not modified. Only weak users are added to the sharing infos, so cache
+ * keys don't keep the geometry data alive.
+ */
+
+#include <mutex>
+#include <variant>
+
+#include "BLI_memory_cache.hh"
+#include "BLI_memory_counter.hh"
+
+#include "BKE_attribute.hh"
+#include "BKE_geometry_nodes_reference_set.hh"
+#include "BKE_geometry_set.hh"
+#include "BKE_mesh.hh"
+#include "BKE_node_runtime.hh"
+#include "BKE_node_socket_value.hh"
+
+#include "DNA_mesh_types.h"
+#include "DNA_object_types.h"
+
+#include "MEM_guardedalloc.h"
+
+#include "NOD_geometry_nodes_lazy_function.hh"
+
+namespace blender::nodes {
+
+using bke::GeometryNodesReferenceSet;
+using bke::GeometrySet;
+using bke::SocketValueVariant;
+
+struct AttributeKey {
+  std::string name;
+  bke::AttrDomain domain;
+  eCustomDataType data_type;
+  ImplicitSharingVersion data;
+
+  BLI_STRUCT_EQUALITY_OPERATORS_4(AttributeKey, name, domain, data_type, data)
+};
+
+/**
+ * Identifies the data of a geometry without having to look at the actual attribute values.
+ */
+struct GeometryKey {
+  std::string name;
+  bool has_mesh = false;
+  int verts_num = 0;
+  int edges_num = 0;
+  int faces_num = 0;
+  int corners_num = 0;
+  ImplicitSharingVersion face_offsets;
+  Vector<const Material *> materials;
+  Vector<AttributeKey> attributes;
+
+  uint64_t hash() const
+  {
+    uint64_t hash = get_default_hash(
+        this->has_mesh, this->verts_num, this->faces_num, this->face_offsets);
+    for (const AttributeKey &attribute : this->attributes) {
+      hash = get_default_hash(hash, attribute.data);
+    }
+    return hash;
+  }
+
+  friend bool operator==(const GeometryKey &a, const GeometryKey &b)
+  {
+    return a.name == b.name && a.has_mesh == b.has_mesh && a.verts_num == b.verts_num &&
+           a.edges_num == b.edges_num && a.faces_num == b.faces_num &&
+           a.corners_num == b.corners_num && a.face_offsets == b.face_offsets &&
+           a.materials == b.materials && a.attributes == b.attributes;
+  }
+};
+
+/**
+ * Only geometries that are empty or contain just a mesh are supported currently. Other geometry
+ * types could be supported in the same way, but meshes are the most common input of expensive
+ * nodes.
+ */
+static std::optional<GeometryKey> make_geometry_key(const GeometrySet &geometry)
+{
+  GeometryKey key;
+  key.name = geometry.name;
+  for (const bke::GeometryComponent *component : geometry.get_components()) {
+    if (component->type() != bke::GeometryComponent::Type::Mesh) {
+      return std::nullopt;
+    }
+  }
+  const Mesh *mesh = geometry.get_mesh();
+  if (mesh == nullptr) {
+    return key;
+  }
+  key.has_mesh = true;
+  key.verts_num = mesh->verts_num;
+  key.edges_num = mesh->edges_num;
+  key.faces_num = mesh->faces_num;
+  key.corners_num = mesh->corners_num;
+  key.face_offsets = ImplicitSharingVersion(mesh->runtime->face_offsets_sharing_info);
+  key.materials = Span<const Material *>(mesh->mat, mesh->totcol);
+
+  bool all_attributes_shared = true;
+  mesh->attributes().foreach_attribute([&](const bke::AttributeIter &iter) {
+    const bke::GAttributeReader attribute = iter.get();
+    if (attribute.sharing_info == nullptr) {
+      /* The data can't be identified without comparing all values. */
+      all_attributes_shared = false;
+      iter.stop();
+      return;
+    }
+    key.attributes.append({iter.name, iter.domain, iter.data_type, {attribute.sharing_info}});
+  });
+  if (!all_attributes_shared) {
+    return std::nullopt;
+  }
+  return key;
+}
+
+/**
+ * Identifies one of the input values of the node.
+ */
+using InputKey = std::variant<bool, SocketValueVariant, GeometryNodesReferenceSet, GeometryKey>;
+
+static uint64_t input_key_hash(const InputKey &key)
+{
+  if (const bool *value = std::get_if<bool>(&key)) {
+    return get_default_hash(*value);
+  }
+  if (const SocketValueVariant *value = std::get_if<SocketValueVariant>(&key)) {
+    const GPointer single_value = value->get_single_ptr();
+    return single_value.type()->hash_or_fallback(single_value.get(), 0);
+  }
+  if (const GeometryNodesReferenceSet *value = std::get_if<GeometryNodesReferenceSet>(&key)) {
+    return value->names ? value->names->size() : 0;
+  }
+  return std::get<GeometryKey>(key).hash();
+}
+
+static bool input_keys_equal(const InputKey &a, const InputKey &b)
+{
+  if (a.index() != b.index()) {
+    return false;
+  }
+  if (const bool *value_a = std::get_if<bool>(&a)) {
+    return *value_a == std::get<bool>(b);
+  }
+  if (const SocketValueVariant *value_a = std::get_if<SocketValueVariant>(&a)) {
+    const GPointer single_a = value_a->get_single_ptr();
+    const GPointer single_b = std::get<SocketValueVariant>(b).get_single_ptr();
+    if (single_a.type() != single_b.type()) {
+      return false;
+    }
+    return single_a.type()->is_equal(single_a.get(), single_b.get());
+  }
+  if (const GeometryNodesReferenceSet *value_a = std::get_if<GeometryNodesReferenceSet>(&a)) {
+    const GeometryNodesReferenceSet &value_b = std::get<GeometryNodesReferenceSet>(b);
+    if (!value_a->names || !value_b.names) {
+      return !value_a->names && !value_b.names;
+    }
+    return *value_a->names == *value_b.names;
+  }
+  return std::get<GeometryKey>(a) == std::get<GeometryKey>(b);
+}
+
+static std::optional<InputKey> make_input_key(const CPPType &type, const void *value)
+{
+  if (type.is<bool>()) {
+    return *static_cast<const bool *>(value);
+  }
+  if (type.is<SocketValueVariant>()) {
+    const SocketValueVariant &value_variant = *static_cast<const SocketValueVariant *>(value);
+    /* Fields can't be compared generally. */
+    if (!value_variant.is_single()) {
+      return std::nullopt;
+    }
+    if (!value_variant.get_single_ptr().type()->is_equality_comparable()) {
+      return std::nullopt;
+    }
+    return value_variant;
+  }
+  if (type.is<GeometryNodesReferenceSet>()) {
+    return *static_cast<const GeometryNodesReferenceSet *>(value);
+  }
+  if (type.is<GeometrySet>()) {
+    std::optional<GeometryKey> geometry_key = make_geometry_key(
+        *static_cast<const GeometrySet *>(value));
+    if (!geometry_key) {
+      return std::nullopt;
+    }
+    return std::move(*geometry_key);
+  }
+  return std::nullopt;
+}
+
+/**
+ * Identifies the evaluation of a specific node with specific inputs.
+ */
+class NodeOutputsKey : public GenericKey {
+ public:
+  uint32_t tree_session_uid = 0;
+  int32_t node_identifier = 0;
+  /** Inputs are part of the anonymous attribute names created by the node. */
+  ComputeContextHash context_hash;
+  std::string self_object_name;
+  /** Properties of the node that are not exposed as sockets. */
+  int16_t custom1 = 0;
+  int16_t custom2 = 0;
+  float custom3 = 0.0f;
+  float custom4 = 0.0f;
+  Vector<uint8_t> storage;
+  Vector<InputKey> inputs;
+
+  uint64_t hash() const override
+  {
+    uint64_t hash = get_default_hash(
+        this->tree_session_uid, this->node_identifier, this->context_hash);
+    for (const InputKey &input : this->inputs) {
+      hash = get_default_hash(hash, input_key_hash(input));
+    }
+    return hash;
+  }
+
+  bool equal_to(const GenericKey &other) const override
+  {
+    const auto *other_typed = dynamic_cast<const NodeOutputsKey *>(&other);
+    if (other_typed == nullptr) {
+      return false;
+    }
+    const NodeOutputsKey &b = *other_typed;
+    if (this->tree_session_uid != b.tree_session_uid ||
+        this->node_identifier != b.node_identifier || this->context_hash != b.context_hash ||
+        this->self_object_name != b.self_object_name || this->custom1 != b.custom1 ||
+        this->custom2 != b.custom2 || this->custom3 != b.custom3 || this->custom4 != b.custom4 ||
+        this->storage != b.storage || this->inputs.size() != b.inputs.size())
+    {
+      return false;
+    }
+    for (const int i : this->inputs.index_range()) {
+      if (!input_keys_equal(this->inputs[i], b.inputs[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  std::unique_ptr<GenericKey> to_storable() const override
+  {
+    return std::make_unique<NodeOutputsKey>(*this);
+  }
+};
+
+/**
+ * Copies of the outputs that were computed when the node was executed.
+ */
+class CachedNodeOutputs : public memory_cache::CachedValue {
+ public:
+  /** Indexed by the lazy-function output index. Null if the output was not computed. */
+  Array<void *> values;
+  Array<const CPPType *> types;
+
+  CachedNodeOutputs(const int outputs_num) : values(outputs_num, nullptr), types(outputs_num) {}
+
+  ~CachedNodeOutputs() override
+  {
+    for (const int i : values.index_range()) {
+      if (values[i] != nullptr) {
+        types[i]->destruct(values[i]);
+        MEM_freeN(values[i]);
+      }
+    }
+  }
+
+  void count_memory(MemoryCounter &memory) const override
+  {
+    for (const int i : values.index_range()) {
+      if (values[i] == nullptr) {
+        continue;
+      }
+      memory.add(types[i]->size());
+      if (types[i]->is<GeometrySet>()) {
+        static_cast<const GeometrySet *>(values[i])->count_memory(memory);
+      }
+    }
+  }
+};
+
+/**
+ * Forwards everything to the original parameters, but also keeps a copy of every output that is
+ * set by the node.
+ */
+class OutputRecordingParams final : public lf::Params {
+ private:
+  lf::Params &base_params_;
+  CachedNodeOutputs &recorded_outputs_;
+  /** Outputs may be set from multiple threads if the node uses multi-threading. */
+  std::mutex mutex_;
+
+ public:
+  OutputRecordingParams(const LazyFunction &fn,
+                        lf::Params &base_params,
+                        CachedNodeOutputs &recorded_outputs)
+      : Params(fn, false), base_params_(base_params), recorded_outputs_(recorded_outputs)
+  {
+  }
+
+  void *try_get_input_data_ptr_impl(const int index) const override
+  {
+    return base_params_.try_get_input_data_ptr(index);
+  }
+
+  void *try_get_input_data_ptr_or_request_impl(const int index) override
+  {
+    return base_params_.try_get_input_data_ptr_or_request(index);
+  }
+
+  void *get_output_data_ptr_impl(const int index) override
+  {
+    return base_params_.get_output_data_ptr(index);
+  }
+
+  void output_set_impl(const int index) override
+  {
+    const CPPType &type = *fn_.outputs()[index].type;
+    void *copy = MEM_mallocN_aligned(type.size(), type.alignment(), __func__);
+    type.copy_construct(base_params_.get_output_data_ptr(index), copy);
+    if (type.is<GeometrySet>()) {
+      static_cast<GeometrySet *>(copy)->ensure_owns_direct_data();
+    }
+    {
+      std::lock_guard lock{mutex_};
+      recorded_outputs_.values[index] = copy;
+      recorded_outputs_.types[index] = &type;
+    }
+    base_params_.output_set(index);
+  }
+
+  bool output_was_set_impl(const int index) const override
+  {
+    return base_params_.output_was_set(index);
+  }
+
+  lf::ValueUsage get_output_usage_impl(const int index) const override
+  {
+    return base_params_.get_output_usage(index);
+  }
+
+  void set_input_unused_impl(const int index) override
+  {
+    base_params_.set_input_unused(index);
+  }
+
+  bool try_enable_multi_threading_impl() override
+  {
+    return base_params_.try_enable_multi_threading();
+  }
+};
+
+static std::optional<NodeOutputsKey> make_node_outputs_key(const bNode &node,
+                                                           const LazyFunction &fn,
+                                                           lf::Params &params,
+                                                           const GeoNodesLFUserData &user_data)
+{
+  NodeOutputsKey key;
+  key.tree_session_uid = node.owner_tree().id.session_uid;
+  key.node_identifier = node.identifier;
+  key.context_hash = user_data.compute_context->hash();
+  if (const Object *self_object = user_data.call_data->self_object()) {
+    key.self_object_name = self_object->id.name;
+  }
+  key.custom1 = node.custom1;
+  key.custom2 = node.custom2;
+  key.custom3 = node.custom3;
+  key.custom4 = node.custom4;
+  if (node.storage != nullptr) {
+    /* Nodes that allow caching don't have pointers in their storage, so it can be compared
+     * byte-wise. */
+    const uint8_t *storage = static_cast<const uint8_t *>(node.storage);
+    key.storage = Span<uint8_t>(storage, MEM_allocN_len(node.storage));
+  }
+  const Span<lf::Input> inputs = fn.inputs();
+  key.inputs.reserve(inputs.size());
+  for (const int i : inputs.index_range()) {
+    const void *value = params.try_get_input_data_ptr(i);
+    if (value == nullptr) {
+      return std::nullopt;
+    }
+    std::optional<InputKey> input_key = make_input_key(*inputs[i].type, value);
+    if (!input_key) {
+      return std::nullopt;
+    }
+    key.inputs.append(std::move(*input_key));
+  }
+  return key;
+}
+
+static bool try_output_cached_values(const CachedNodeOutputs &cached_outputs, lf::Params &params)
+{
+  const int outputs_num = params.fn_.outputs().size();
+  for (const int i : IndexRange(outputs_num)) {
+    if (params.output_was_set(i) || params.get_output_usage(i) == lf::ValueUsage::Unused) {
+      continue;
+    }
+    if (cached_outputs.values[i] == nullptr) {
+      /* The output was not computed in the cached evaluation. */
+      return false;
+    }
+  }
+  for (const int i : IndexRange(outputs_num)) {
+    if (params.output_was_set(i) || cached_outputs.values[i] == nullptr) {
+      continue;
+    }
+    const CPPType &type = *cached_outputs.types[i];
+    type.copy_construct(cached_outputs.values[i], params.get_output_data_ptr(i));
+    params.output_set(i);
+  }
+  return true;
+}
+
+void execute_geometry_node_with_output_cache(const bNode &node,
+                                             const LazyFunction &fn,
+                                             lf::Params &params,
+                                             const lf::Context &context,
+                                             const FunctionRef<void(lf::Params &)> execute_fn)
+{
+  const GeoNodesLFUserData &user_data = *static_cast<GeoNodesLFUserData *>(context.user_data);
+  std::optional<NodeOutputsKey> key = make_node_outputs_key(node, fn, params, user_data);
+  if (!key) {
+    execute_fn(params);
+    return;
+  }
+
+  bool executed = false;
+  std::shared_ptr<const CachedNodeOutputs> cached_outputs = memory_cache::get<CachedNodeOutputs>(
+      *key, [&]() {
+        auto recorded_outputs = std::make_unique<CachedNodeOutputs>(fn.outputs().size());
+        OutputRecordingParams recording_params{fn, params, *recorded_outputs};
+        execute_fn(recording_params);
+        executed = true;
+        return recorded_outputs;
+      });
+  if (executed) {
+    return;
+  }
+  if (!try_output_cached_values(*cached_outputs, params)) {
+    execute_fn(params);
+  }
+}
+
+}  // namespace blender::nodes
@@ -5,6 +5,7 @@
 #include "NOD_geometry_nodes_lazy_function.hh"
 
 #include "BKE_compute_contexts.hh"
+#include "BKE_node_legacy_types.hh"
 #include "BKE_node_runtime.hh"
 #include "BKE_node_socket_value.hh"
 
@@ -13,6 +14,9 @@
 #include "BLT_translation.hh"
 
 #include "BLI_array_utils.hh"
+#include "BLI_lazy_threading.hh"
+
+#include "GEO_join_geometries.hh"
 
 #include "DEG_depsgraph_query.hh"
 
@@ -20,6 +24,7 @@
 
 namespace blender::nodes {
 
+using bke::GeometrySet;
 using bke::SocketValueVariant;
 
 /**
@@ -32,6 +37,8 @@ class RepeatBodyNodeExecuteWrapper : public lf::GraphExecutorNodeExecuteWrapper
  public:
   const bNode *repeat_output_bnode_ = nullptr;
   VectorSet<lf::FunctionNode *> *lf_body_nodes_ = nullptr;
+  /** See #repeat_zone_iterations_are_independent. */
+  bool iterations_are_independent_ = false;
 
   void execute_node(const lf::FunctionNode &node,
                     lf::Params &params,
@@ -56,6 +63,10 @@ class RepeatBodyNodeExecuteWrapper : public lf::GraphExecutorNodeExecuteWrapper
 
     GeoNodesLFLocalUserData body_local_user_data{body_user_data};
     lf::Context body_context{context.storage, &body_user_data, &body_local_user_data};
+    if (iterations_are_independent_) {
+      /* Allow other threads to work on the remaining iterations in the meantime. */
+      lazy_threading::send_hint();
+    }
     fn.execute(params, body_context);
   }
 };
@@ -91,11 +102,87 @@ class RepeatZoneSideEffectProvider : public lf::GraphExecutorSideEffectProvider
   }
 };
 
+/**
+ * Joins the initial geometry of a repeat item with the geometries generated by all iterations.
+ * This is used instead of chaining the iterations when they are independent of each other.
+ */
+class LazyFunctionForJoinIterations : public LazyFunction {
+ public:
+  LazyFunctionForJoinIterations(const int iterations)
+  {
+    debug_name_ = "Join Iterations";
+    inputs_.append_as("Initial", CPPType::get<GeometrySet>(), lf::ValueUsage::Used);
+    for ([[maybe_unused]] const int i : IndexRange(iterations)) {
+      inputs_.append_as("Iteration", CPPType::get<GeometrySet>(), lf::ValueUsage::Used);
+    }
+    outputs_.append_as("Geometry", CPPType::get<GeometrySet>());
+  }
+
+  void execute_impl(lf::Params &params, const lf::Context & /*context*/) const override
+  {
+    Vector<GeometrySet> geometries(inputs_.size());
+    for (const int i : inputs_.index_range()) {
+      geometries[i] = params.extract_input<GeometrySet>(i);
+      bke::GeometryComponentEditData::remember_deformed_positions_if_necessary(geometries[i]);
+    }
+    params.set_output(0, geometry::join_geometries(geometries, {}));
+  }
+};
+
+/**
+ * Iterations of a repeat zone are independent of each other when every repeat item is a geometry
+ * that is only passed to the first input of a Join Geometry node, whose result is passed to the
+ * next iteration directly. In that case, every iteration only generates a new piece of geometry
+ * and all pieces can be generated in parallel and joined in the end. The order of the joined
+ * geometries is the same as when the iterations are evaluated one after another.
+ */
+static bool repeat_zone_iterations_are_independent(const bke::bNodeTreeZone &zone,
+                                                   const NodeGeometryRepeatOutput &node_storage)
+{
+  if (node_storage.items_num == 0) {
+    return false;
+  }
+  const bNode &input_bnode = *zone.input_node;
+  const bNode &output_bnode = *zone.output_node;
+  for (const int i : IndexRange(node_storage.items_num)) {
+    if (node_storage.items[i].socket_type != SOCK_GEOMETRY) {
+      return false;
+    }
+    /* The first output is the iteration index. */
+    const Span<const bNodeLink *> item_links =
+        input_bnode.output_socket(i + 1).directly_linked_links();
+    if (item_links.size() != 1) {
+      return false;
+    }
+    const bNodeLink &item_link = *item_links[0];
+    const bNode &join_bnode = *item_link.tonode;
+    if (item_link.is_muted() || join_bnode.is_muted() ||
+        join_bnode.type_legacy != GEO_NODE_JOIN_GEOMETRY)
+    {
+      return false;
+    }
+    if (item_link.tosock->directly_linked_links()[0] != &item_link) {
+      /* Joining in a different order would change the order of the elements. */
+      return false;
+    }
+    const Span<const bNodeLink *> join_links = join_bnode.output_socket(0).directly_linked_links();
+    if (join_links.size() != 1) {
+      return false;
+    }
+    const bNodeLink &join_link = *join_links[0];
+    if (join_link.is_muted() || join_link.tosock != &output_bnode.input_socket(i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 struct RepeatEvalStorage {
   LinearAllocator<> allocator;
   VectorSet<lf::FunctionNode *> lf_body_nodes;
   lf::Graph graph;
   std::optional<LazyFunctionForLogicalOr> or_function;
+  std::optional<LazyFunctionForJoinIterations> join_function;
   std::optional<RepeatZoneSideEffectProvider> side_effect_provider;
   std::optional<RepeatBodyNodeExecuteWrapper> body_execute_wrapper;
   std::optional<lf::GraphExecutor> graph_executor;
@@ -113,6 +200,7 @@ class LazyFunctionForRepeatZone : public LazyFunction {
   const bNode &repeat_output_bnode_;
   const ZoneBuildInfo &zone_info_;
   const ZoneBodyFunction &body_fn_;
+  bool iterations_are_independent_ = false;
 
  public:
   LazyFunctionForRepeatZone(const bNodeTree &btree,
@@ -130,6 +218,9 @@ class LazyFunctionForRepeatZone : public LazyFunction {
     initialize_zone_wrapper(zone, zone_info, body_fn, inputs_, outputs_);
     /* Iterations input is always used. */
     inputs_[zone_info.indices.inputs.main[0]].usage = lf::ValueUsage::Used;
+
+    iterations_are_independent_ = repeat_zone_iterations_are_independent(
+        zone, *static_cast<const NodeGeometryRepeatOutput *>(repeat_output_bnode_.storage));
   }
 
   void *init_storage(LinearAllocator<> &allocator) const override
@@ -290,18 +381,24 @@ class LazyFunctionForRepeatZone : public LazyFunction {
 
     static bool static_true = true;
 
-    /* Handle body nodes pair-wise. */
-    for (const int iter_i : lf_body_nodes.index_range().drop_back(1)) {
-      lf::FunctionNode &lf_node = *lf_body_nodes[iter_i];
-      lf::FunctionNode &lf_next_node = *lf_body_nodes[iter_i + 1];
-      for (const int i : IndexRange(num_repeat_items)) {
-        lf_graph.add_link(
-            lf_node.output(body_fn_.indices.outputs.main[i]),
-            lf_next_node.input(body_fn_.indices.inputs.main[i + body_inputs_offset]));
-        /* TODO: Add back-link after being able to check for cyclic dependencies. */
-        // lf_graph.add_link(lf_next_node.output(body_fn_.indices.outputs.input_usages[i]),
-        //                   lf_node.input(body_fn_.indices.inputs.output_usages[i]));
-        lf_node.input(body_fn_.indices.inputs.output_usages[i]).set_default_value(&static_true);
+    if (iterations_are_independent_ && iterations > 0) {
+      this->link_independent_iterations(eval_storage, lf_inputs, lf_outputs, iterations);
+    }
+    else {
+      /* Handle body nodes pair-wise. */
+      for (const int iter_i : lf_body_nodes.index_range().drop_back(1)) {
+        lf::FunctionNode &lf_node = *lf_body_nodes[iter_i];
+        lf::FunctionNode &lf_next_node = *lf_body_nodes[iter_i + 1];
+        for (const int i : IndexRange(num_repeat_items)) {
+          lf_graph.add_link(
+              lf_node.output(body_fn_.indices.outputs.main[i]),
+              lf_next_node.input(body_fn_.indices.inputs.main[i + body_inputs_offset]));
+          /* TODO: Add back-link after being able to check for cyclic dependencies. */
+          // lf_graph.add_link(lf_next_node.output(body_fn_.indices.outputs.input_usages[i]),
+          //                   lf_node.input(body_fn_.indices.inputs.output_usages[i]));
+          lf_node.input(body_fn_.indices.inputs.output_usages[i])
+              .set_default_value(&static_true);
+        }
       }
     }
 
@@ -311,7 +408,10 @@ class LazyFunctionForRepeatZone : public LazyFunction {
                         *lf_outputs[zone_info_.indices.outputs.border_link_usages[i]]);
     }
 
-    if (iterations > 0) {
+    if (iterations_are_independent_ && iterations > 0) {
+      /* The body nodes have been linked to the inputs and outputs above already. */
+    }
+    else if (iterations > 0) {
       {
         /* Link first body node to input/output nodes. */
         lf::FunctionNode &lf_first_body_node = *lf_body_nodes[0];
@@ -382,6 +482,7 @@ class LazyFunctionForRepeatZone : public LazyFunction {
     eval_storage.body_execute_wrapper.emplace();
     eval_storage.body_execute_wrapper->repeat_output_bnode_ = &repeat_output_bnode_;
     eval_storage.body_execute_wrapper->lf_body_nodes_ = &lf_body_nodes;
+    eval_storage.body_execute_wrapper->iterations_are_independent_ = iterations_are_independent_;
     eval_storage.side_effect_provider.emplace();
     eval_storage.side_effect_provider->repeat_output_bnode_ = &repeat_output_bnode_;
     eval_storage.side_effect_provider->lf_body_nodes_ = lf_body_nodes;
@@ -405,6 +506,47 @@ class LazyFunctionForRepeatZone : public LazyFunction {
     }
   }
 
+  /**
+   * Instead of passing the geometry from one iteration to the next, every iteration starts with
+   * an empty geometry and the generated geometries are joined at the end.
+   */
+  void link_independent_iterations(RepeatEvalStorage &eval_storage,
+                                   const Span<lf::GraphInputSocket *> lf_inputs,
+                                   const Span<lf::GraphOutputSocket *> lf_outputs,
+                                   const int iterations) const
+  {
+    static const GeometrySet static_empty_geometry;
+    static bool static_true = true;
+
+    const int main_inputs_offset = 1;
+    const int body_inputs_offset = 1;
+    const int num_repeat_items = body_fn_.indices.outputs.main.size();
+
+    lf::Graph &lf_graph = eval_storage.graph;
+    const Span<lf::FunctionNode *> lf_body_nodes = eval_storage.lf_body_nodes;
+    eval_storage.join_function.emplace(iterations);
+
+    for (const int i : IndexRange(num_repeat_items)) {
+      lf::FunctionNode &lf_join_node = lf_graph.add_function(*eval_storage.join_function);
+      lf_graph.add_link(*lf_inputs[zone_info_.indices.inputs.main[i + main_inputs_offset]],
+                        lf_join_node.input(0));
+      for (const int iter_i : lf_body_nodes.index_range()) {
+        lf::FunctionNode &lf_body_node = *lf_body_nodes[iter_i];
+        lf_body_node.input(body_fn_.indices.inputs.main[i + body_inputs_offset])
+            .set_default_value(&static_empty_geometry);
+        lf_body_node.input(body_fn_.indices.inputs.output_usages[i])
+            .set_default_value(&static_true);
+        lf_graph.add_link(lf_body_node.output(body_fn_.indices.outputs.main[i]),
+                          lf_join_node.input(iter_i + 1));
+      }
+      lf_graph.add_link(lf_join_node.output(0), *lf_outputs[zone_info_.indices.outputs.main[i]]);
+      /* The initial geometry is used when the output is used. */
+      lf_graph.add_link(
+          *lf_inputs[zone_info_.indices.inputs.output_usages[i]],
+          *lf_outputs[zone_info_.indices.outputs.input_usages[i + main_inputs_offset]]);
+    }
+  }
+
   std::string input_name(const int i) const override
   {
     return zone_wrapper_input_name(zone_info_, zone_, inputs_, i);
@@ -632,6 +632,36 @@ static PyObject *bpy_app_help_text(PyObject * /*self*/, PyObject *args, PyObject
   return result;
 }
 
+PyDoc_STRVAR(
+    /* Wrap. */
+    bpy_app_memory_statistics_doc,
+    ".. staticmethod:: memory_statistics()\n"
+    "\n"
+    "   Return statistics of the memory allocated through Blender's own allocator.\n"
+    "\n"
+    "   :return: Dictionary with the ``in_use`` and ``peak`` memory in bytes, "
+    "the number of ``blocks_in_use`` and the number of ``allocations`` since startup.\n"
+    "   :rtype: dict[str, int]\n");
+static PyObject *bpy_app_memory_statistics(PyObject * /*self*/)
+{
+  const struct {
+    const char *id;
+    size_t value;
+  } statistics[] = {
+      {"in_use", MEM_get_memory_in_use()},
+      {"peak", MEM_get_peak_memory()},
+      {"blocks_in_use", size_t(MEM_get_memory_blocks_in_use())},
+      {"allocations", MEM_get_memory_allocations_num()},
+  };
+  PyObject *result = _PyDict_NewPresized(ARRAY_SIZE(statistics));
+  for (int i = 0; i < ARRAY_SIZE(statistics); i++) {
+    PyObject *value = PyLong_FromSize_t(statistics[i].value);
+    PyDict_SetItemString(result, statistics[i].id, value);
+    Py_DECREF(value);
+  }
+  return result;
+}
+
 #if (defined(__GNUC__) && !defined(__clang__))
 #  pragma GCC diagnostic push
 #  pragma GCC diagnostic ignored "-Wcast-function-type"
@@ -646,6 +676,10 @@ static PyMethodDef bpy_app_methods[] = {
      (PyCFunction)bpy_app_help_text,
      METH_VARARGS | METH_KEYWORDS | METH_STATIC,
      bpy_app_help_text_doc},
+    {"memory_statistics",
+     (PyCFunction)bpy_app_memory_statistics,
+     METH_NOARGS | METH_STATIC,
+     bpy_app_memory_statistics_doc},
     {nullptr, nullptr, 0, nullptr},
 };
 
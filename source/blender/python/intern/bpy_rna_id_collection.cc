@@ -14,6 +14,7 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_bitmap.h"
+#include "BLI_memory_counter.hh"
 
 #include "BKE_bpath.hh"
 #include "BKE_global.hh"
@@ -634,6 +635,54 @@ static PyObject *bpy_orphans_purge(PyObject *self, PyObject *args, PyObject *kwd
   return PyLong_FromSize_t(num_datablocks_deleted);
 }
 
+PyDoc_STRVAR(
+    /* Wrap. */
+    bpy_memory_usage_map_doc,
+    ".. method:: memory_usage_map()\n"
+    "\n"
+    "   Returns a mapping of IDs to an estimate of the memory used by their data, in bytes.\n"
+    "\n"
+    "   Only ID types storing geometry (meshes, curves, point clouds, grease pencil and "
+    "volumes) are included.\n"
+    "   Data shared between several IDs is counted for each of them.\n"
+    "\n"
+    "   :return: dictionary of :class:`bpy.types.ID` instances, with the number of bytes "
+    "as values.\n"
+    "   :rtype: dict[:class:`bpy.types.ID`, int]\n");
+static PyObject *bpy_memory_usage_map(PyObject *self, PyObject * /*args*/)
+{
+  Main *bmain = pyrna_bmain_FromPyObject(self);
+  if (!bmain) {
+    return nullptr;
+  }
+
+  PyObject *ret = PyDict_New();
+
+  ListBase *lb;
+  ID *id;
+  FOREACH_MAIN_LISTBASE_BEGIN (bmain, lb) {
+    FOREACH_MAIN_LISTBASE_ID_BEGIN (lb, id) {
+      blender::MemoryCount count;
+      {
+        blender::MemoryCounter memory(count);
+        if (!BKE_id_count_memory(*id, memory)) {
+          /* All IDs of a list-base share the same type. */
+          break;
+        }
+      }
+      PyObject *key = pyrna_id_CreatePyObject(id);
+      PyObject *value = PyLong_FromLongLong(count.total_bytes);
+      PyDict_SetItem(ret, key, value);
+      Py_DECREF(key);
+      Py_DECREF(value);
+    }
+    FOREACH_MAIN_LISTBASE_ID_END;
+  }
+  FOREACH_MAIN_LISTBASE_END;
+
+  return ret;
+}
+
 #if (defined(__GNUC__) && !defined(__clang__))
 #  pragma GCC diagnostic push
 #  pragma GCC diagnostic ignored "-Wcast-function-type"
@@ -663,6 +712,12 @@ PyMethodDef BPY_rna_id_collection_orphans_purge_method_def = {
     METH_VARARGS | METH_KEYWORDS,
     bpy_orphans_purge_doc,
 };
+PyMethodDef BPY_rna_id_collection_memory_usage_map_method_def = {
+    "memory_usage_map",
+    (PyCFunction)bpy_memory_usage_map,
+    METH_NOARGS,
+    bpy_memory_usage_map_doc,
+};
 
 #if (defined(__GNUC__) && !defined(__clang__))
 #  pragma GCC diagnostic pop
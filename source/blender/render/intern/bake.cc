@@ -852,8 +852,7 @@ void RE_bake_normal_world_to_tangent(const BakePixel pixel_array[],
                                      const eBakeNormalSwizzle normal_swizzle[3],
                                      const float mat[4][4])
 {
-  size_t i;
-
+  using namespace blender;
   TriTessFace *triangles;
 
   Mesh *mesh_eval = BKE_mesh_copy_for_eval(*mesh);
@@ -862,104 +861,106 @@ void RE_bake_normal_world_to_tangent(const BakePixel pixel_array[],
 
   BLI_assert(pixels_num >= 3);
 
-  for (i = 0; i < pixels_num; i++) {
-    TriTessFace *triangle;
-    float tangents[3][3];
-    float normals[3][3];
-    float signs[3];
-    int j;
-
-    float tangent[3];
-    float normal[3];
-    float binormal[3];
-    float sign;
-    float u, v, w;
-
-    float tsm[3][3]; /* tangent space matrix */
-    float itsm[3][3];
+  threading::parallel_for(IndexRange(pixels_num), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      TriTessFace *triangle;
+      float tangents[3][3];
+      float normals[3][3];
+      float signs[3];
+      int j;
 
-    size_t offset;
-    float nor[3]; /* texture normal */
+      float tangent[3];
+      float normal[3];
+      float binormal[3];
+      float sign;
+      float u, v, w;
 
-    bool is_smooth;
+      float tsm[3][3]; /* tangent space matrix */
+      float itsm[3][3];
 
-    int primitive_id = pixel_array[i].primitive_id;
+      size_t offset;
+      float nor[3]; /* texture normal */
 
-    offset = i * depth;
+      bool is_smooth;
 
-    if (primitive_id == -1) {
-      if (depth == 4) {
-        copy_v4_fl4(&result[offset], 0.5f, 0.5f, 1.0f, 1.0f);
-      }
-      else {
-        copy_v3_fl3(&result[offset], 0.5f, 0.5f, 1.0f);
-      }
-      continue;
-    }
-
-    triangle = &triangles[primitive_id];
-    is_smooth = triangle->is_smooth;
+      int primitive_id = pixel_array[i].primitive_id;
 
-    for (j = 0; j < 3; j++) {
-      const TSpace *ts;
+      offset = i * depth;
 
-      if (is_smooth) {
-        if (triangle->loop_normal[j]) {
-          copy_v3_v3(normals[j], triangle->loop_normal[j]);
+      if (primitive_id == -1) {
+        if (depth == 4) {
+          copy_v4_fl4(&result[offset], 0.5f, 0.5f, 1.0f, 1.0f);
         }
         else {
-          copy_v3_v3(normals[j], triangle->vert_normals[j]);
+          copy_v3_fl3(&result[offset], 0.5f, 0.5f, 1.0f);
         }
+        continue;
       }
 
-      ts = triangle->tspace[j];
-      copy_v3_v3(tangents[j], ts->tangent);
-      signs[j] = ts->sign;
-    }
+      triangle = &triangles[primitive_id];
+      is_smooth = triangle->is_smooth;
 
-    u = pixel_array[i].uv[0];
-    v = pixel_array[i].uv[1];
-    w = 1.0f - u - v;
+      for (j = 0; j < 3; j++) {
+        const TSpace *ts;
 
-    /* normal */
-    if (is_smooth) {
-      interp_barycentric_tri_v3(normals, u, v, normal);
-    }
-    else {
-      copy_v3_v3(normal, triangle->normal);
-    }
+        if (is_smooth) {
+          if (triangle->loop_normal[j]) {
+            copy_v3_v3(normals[j], triangle->loop_normal[j]);
+          }
+          else {
+            copy_v3_v3(normals[j], triangle->vert_normals[j]);
+          }
+        }
+
+        ts = triangle->tspace[j];
+        copy_v3_v3(tangents[j], ts->tangent);
+        signs[j] = ts->sign;
+      }
+
+      u = pixel_array[i].uv[0];
+      v = pixel_array[i].uv[1];
+      w = 1.0f - u - v;
+
+      /* normal */
+      if (is_smooth) {
+        interp_barycentric_tri_v3(normals, u, v, normal);
+      }
+      else {
+        copy_v3_v3(normal, triangle->normal);
+      }
 
-    /* tangent */
-    interp_barycentric_tri_v3(tangents, u, v, tangent);
+      /* tangent */
+      interp_barycentric_tri_v3(tangents, u, v, tangent);
 
-    /* sign */
-    /* The sign is the same at all face vertices for any non degenerate face.
-     * Just in case we clamp the interpolated value though. */
-    sign = (signs[0] * u + signs[1] * v + signs[2] * w) < 0 ? (-1.0f) : 1.0f;
+      /* sign */
+      /* The sign is the same at all face vertices for any non degenerate face.
+       * Just in case we clamp the interpolated value though. */
+      sign = (signs[0] * u + signs[1] * v + signs[2] * w) < 0 ? (-1.0f) : 1.0f;
 
-    /* binormal */
-    /* `B = sign * cross(N, T)` */
-    cross_v3_v3v3(binormal, normal, tangent);
-    mul_v3_fl(binormal, sign);
+      /* binormal */
+      /* `B = sign * cross(N, T)` */
+      cross_v3_v3v3(binormal, normal, tangent);
+      mul_v3_fl(binormal, sign);
 
-    /* populate tangent space matrix */
-    copy_v3_v3(tsm[0], tangent);
-    copy_v3_v3(tsm[1], binormal);
-    copy_v3_v3(tsm[2], normal);
+      /* populate tangent space matrix */
+      copy_v3_v3(tsm[0], tangent);
+      copy_v3_v3(tsm[1], binormal);
+      copy_v3_v3(tsm[2], normal);
 
-    /* texture values */
-    copy_v3_v3(nor, &result[offset]);
+      /* texture values */
+      copy_v3_v3(nor, &result[offset]);
 
-    /* converts from world space to local space */
-    mul_transposed_mat3_m4_v3(mat, nor);
+      /* converts from world space to local space */
+      mul_transposed_mat3_m4_v3(mat, nor);
 
-    invert_m3_m3(itsm, tsm);
-    mul_m3_v3(itsm, nor);
-    normalize_v3(nor);
+      invert_m3_m3(itsm, tsm);
+      mul_m3_v3(itsm, nor);
+      normalize_v3(nor);
 
-    /* save back the values */
-    normal_compress(&result[offset], nor, normal_swizzle);
-  }
+      /* save back the values */
+      normal_compress(&result[offset], nor, normal_swizzle);
+    }
+  });
 
   /* garbage collection */
   MEM_freeN(triangles);
@@ -976,29 +977,31 @@ void RE_bake_normal_world_to_object(const BakePixel pixel_array[],
                                     Object *ob,
                                     const eBakeNormalSwizzle normal_swizzle[3])
 {
-  size_t i;
+  using namespace blender;
   float iobmat[4][4];
 
   invert_m4_m4(iobmat, ob->object_to_world().ptr());
 
-  for (i = 0; i < pixels_num; i++) {
-    size_t offset;
-    float nor[3];
+  threading::parallel_for(IndexRange(pixels_num), 8192, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      size_t offset;
+      float nor[3];
 
-    if (pixel_array[i].primitive_id == -1) {
-      continue;
-    }
+      if (pixel_array[i].primitive_id == -1) {
+        continue;
+      }
 
-    offset = i * depth;
-    copy_v3_v3(nor, &result[offset]);
+      offset = i * depth;
+      copy_v3_v3(nor, &result[offset]);
 
-    /* rotates only without translation */
-    mul_mat3_m4_v3(iobmat, nor);
-    normalize_v3(nor);
+      /* rotates only without translation */
+      mul_mat3_m4_v3(iobmat, nor);
+      normalize_v3(nor);
 
-    /* save back the values */
-    normal_compress(&result[offset], nor, normal_swizzle);
-  }
+      /* save back the values */
+      normal_compress(&result[offset], nor, normal_swizzle);
+    }
+  });
 }
 
 void RE_bake_normal_world_to_world(const BakePixel pixel_array[],
@@ -1007,22 +1010,24 @@ void RE_bake_normal_world_to_world(const BakePixel pixel_array[],
                                    float result[],
                                    const eBakeNormalSwizzle normal_swizzle[3])
 {
-  size_t i;
+  using namespace blender;
 
-  for (i = 0; i < pixels_num; i++) {
-    size_t offset;
-    float nor[3];
+  threading::parallel_for(IndexRange(pixels_num), 8192, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      size_t offset;
+      float nor[3];
 
-    if (pixel_array[i].primitive_id == -1) {
-      continue;
-    }
+      if (pixel_array[i].primitive_id == -1) {
+        continue;
+      }
 
-    offset = i * depth;
-    copy_v3_v3(nor, &result[offset]);
+      offset = i * depth;
+      copy_v3_v3(nor, &result[offset]);
 
-    /* save back the values */
-    normal_compress(&result[offset], nor, normal_swizzle);
-  }
+      /* save back the values */
+      normal_compress(&result[offset], nor, normal_swizzle);
+    }
+  });
 }
 
 void RE_bake_ibuf_clear(Image *image, const bool is_tangent)
@@ -6,6 +6,7 @@
  * \ingroup render
  */
 
+#include <algorithm>
 #include <cerrno>
 #include <cstdio>
 #include <cstdlib>
@@ -19,6 +20,7 @@
 #include "BLI_rect.h"
 #include "BLI_string.h"
 #include "BLI_string_utils.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "DNA_userdef_types.h"
@@ -206,24 +208,34 @@ static void render_layer_allocate_pass(RenderResult *rr, RenderPass *rp)
    * channels. */
 
   const size_t rectsize = size_t(rr->rectx) * rr->recty * rp->channels;
-  float *buffer_data = MEM_calloc_arrayN<float>(rectsize, rp->name);
-
-  rp->ibuf = IMB_allocImBuf(rr->rectx, rr->recty, get_num_planes_for_pass_ibuf(*rp), 0);
-  rp->ibuf->channels = rp->channels;
-  IMB_assign_float_buffer(rp->ibuf, buffer_data, IB_TAKE_OWNERSHIP);
-  assign_render_pass_ibuf_colorspace(*rp);
 
+  /* Vector and depth passes are filled with their clear value below, so avoid zeroing them
+   * first. */
+  float clear_value = 0.0f;
   if (STREQ(rp->name, RE_PASSNAME_VECTOR)) {
     /* initialize to max speed */
-    for (int x = rectsize - 1; x >= 0; x--) {
-      buffer_data[x] = PASS_VECTOR_MAX;
-    }
+    clear_value = PASS_VECTOR_MAX;
   }
   else if (STREQ(rp->name, RE_PASSNAME_Z)) {
-    for (int x = rectsize - 1; x >= 0; x--) {
-      buffer_data[x] = 10e10;
-    }
+    clear_value = 10e10;
+  }
+
+  float *buffer_data;
+  if (clear_value == 0.0f) {
+    buffer_data = MEM_calloc_arrayN<float>(rectsize, rp->name);
+  }
+  else {
+    buffer_data = MEM_malloc_arrayN<float>(rectsize, rp->name);
+    blender::threading::parallel_for(
+        blender::IndexRange(rectsize), 65536, [&](const blender::IndexRange range) {
+          std::fill_n(buffer_data + range.start(), range.size(), clear_value);
+        });
   }
+
+  rp->ibuf = IMB_allocImBuf(rr->rectx, rr->recty, get_num_planes_for_pass_ibuf(*rp), 0);
+  rp->ibuf->channels = rp->channels;
+  IMB_assign_float_buffer(rp->ibuf, buffer_data, IB_TAKE_OWNERSHIP);
+  assign_render_pass_ibuf_colorspace(*rp);
 }
 
 RenderPass *render_layer_add_pass(RenderResult *rr,
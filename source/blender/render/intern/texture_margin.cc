@@ -6,10 +6,12 @@
  * \ingroup render
  */
 
+#include "BLI_array.hh"
 #include "BLI_assert.h"
 #include "BLI_math_geom.h"
 #include "BLI_math_vector.hh"
 #include "BLI_math_vector_types.hh"
+#include "BLI_task.hh"
 #include "BLI_vector.hh"
 
 #include "BKE_attribute.hh"
@@ -220,78 +222,99 @@ class TextureMarginMap {
    */
   void lookup_pixels(ImBuf *ibuf, char *mask, int maxPolygonSteps)
   {
-    float4 *ibuf_ptr_fl = reinterpret_cast<float4 *>(ibuf->float_buffer.data);
-    uchar4 *ibuf_ptr_ch = reinterpret_cast<uchar4 *>(ibuf->byte_buffer.data);
-    size_t pixel_index = 0;
-    for (int y = 0; y < h_; y++) {
-      for (int x = 0; x < w_; x++) {
-        uint32_t dp = pixel_data_[pixel_index];
-        if (IsDijkstraPixel(dp) && !DijkstraPixelIsUnset(dp)) {
-          int dist = DijkstraPixelGetDistance(dp);
-          int direction = DijkstraPixelGetDirection(dp);
-
-          int xx = x;
-          int yy = y;
-
-          /* Follow the dijkstra directions to find the face this margin pixels belongs to. */
-          while (dist > 0) {
-            xx -= directions[direction][0];
-            yy -= directions[direction][1];
-            dp = get_pixel(xx, yy);
-            dist -= distances[direction];
-            BLI_assert(!dist || (dist == DijkstraPixelGetDistance(dp)));
-            direction = DijkstraPixelGetDirection(dp);
-          }
-
-          uint32_t face = get_pixel(xx, yy);
-
-          BLI_assert(!IsDijkstraPixel(face));
-
-          float destX, destY;
-
-          int other_poly;
-          bool found_pixel_in_polygon = false;
-          if (lookup_pixel_polygon_neighborhood(x, y, &face, &destX, &destY, &other_poly)) {
-
-            for (int i = 0; i < maxPolygonSteps; i++) {
-              /* Force to pixel grid. */
-              int nx = int(round(destX));
-              int ny = int(round(destY));
-              uint32_t polygon_from_map = get_pixel(nx, ny);
-              if (other_poly == polygon_from_map) {
-                found_pixel_in_polygon = true;
-                break;
-              }
+    struct MarginPixel {
+      int x;
+      float2 dest;
+    };
 
-              float dist_to_edge;
-              /* Look up again, but starting from the face we were expected to land in. */
-              if (!lookup_pixel(nx, ny, other_poly, &destX, &destY, &other_poly, &dist_to_edge)) {
-                found_pixel_in_polygon = false;
-                break;
-              }
+    /* Finding the source location of the margin pixels only reads the map, so it is done for all
+     * rows in parallel. The pixels are written afterwards in scan order, because the bilinear
+     * lookups may read margin pixels which were written before. */
+    Array<Vector<MarginPixel>> row_margin_pixels(h_);
+
+    threading::parallel_for(IndexRange(h_), 16, [&](const IndexRange rows) {
+      for (const int y : rows) {
+        Vector<MarginPixel> &margin_pixels = row_margin_pixels[y];
+        size_t pixel_index = size_t(y) * w_;
+        for (int x = 0; x < w_; x++, pixel_index++) {
+          uint32_t dp = pixel_data_[pixel_index];
+          if (IsDijkstraPixel(dp) && !DijkstraPixelIsUnset(dp)) {
+            int dist = DijkstraPixelGetDistance(dp);
+            int direction = DijkstraPixelGetDirection(dp);
+
+            int xx = x;
+            int yy = y;
+
+            /* Follow the dijkstra directions to find the face this margin pixels belongs to. */
+            while (dist > 0) {
+              xx -= directions[direction][0];
+              yy -= directions[direction][1];
+              dp = get_pixel(xx, yy);
+              dist -= distances[direction];
+              BLI_assert(!dist || (dist == DijkstraPixelGetDistance(dp)));
+              direction = DijkstraPixelGetDirection(dp);
             }
 
-            if (found_pixel_in_polygon) {
-              if (ibuf_ptr_fl) {
-                ibuf_ptr_fl[pixel_index] = imbuf::interpolate_bilinear_border_fl(
-                    ibuf, destX, destY);
+            uint32_t face = get_pixel(xx, yy);
+
+            BLI_assert(!IsDijkstraPixel(face));
+
+            float destX, destY;
+
+            int other_poly;
+            bool found_pixel_in_polygon = false;
+            if (lookup_pixel_polygon_neighborhood(x, y, &face, &destX, &destY, &other_poly)) {
+
+              for (int i = 0; i < maxPolygonSteps; i++) {
+                /* Force to pixel grid. */
+                int nx = int(round(destX));
+                int ny = int(round(destY));
+                uint32_t polygon_from_map = get_pixel(nx, ny);
+                if (other_poly == polygon_from_map) {
+                  found_pixel_in_polygon = true;
+                  break;
+                }
+
+                float dist_to_edge;
+                /* Look up again, but starting from the face we were expected to land in. */
+                if (!lookup_pixel(
+                        nx, ny, other_poly, &destX, &destY, &other_poly, &dist_to_edge))
+                {
+                  found_pixel_in_polygon = false;
+                  break;
+                }
               }
-              if (ibuf_ptr_ch) {
-                ibuf_ptr_ch[pixel_index] = imbuf::interpolate_bilinear_border_byte(
-                    ibuf, destX, destY);
+
+              if (found_pixel_in_polygon) {
+                margin_pixels.append({x, float2(destX, destY)});
+                /* Add our new pixels to the assigned pixel map. */
+                mask[pixel_index] = 1;
               }
-              /* Add our new pixels to the assigned pixel map. */
-              mask[pixel_index] = 1;
             }
           }
+          else if (DijkstraPixelIsUnset(dp) || !IsDijkstraPixel(dp)) {
+            /* These are not margin pixels, make sure the extend filter which is run after this
+             * step leaves them alone.
+             */
+            mask[pixel_index] = 1;
+          }
+        }
+      }
+    });
+
+    float4 *ibuf_ptr_fl = reinterpret_cast<float4 *>(ibuf->float_buffer.data);
+    uchar4 *ibuf_ptr_ch = reinterpret_cast<uchar4 *>(ibuf->byte_buffer.data);
+    for (const int y : IndexRange(h_)) {
+      for (const MarginPixel &margin_pixel : row_margin_pixels[y]) {
+        const size_t pixel_index = size_t(y) * w_ + margin_pixel.x;
+        if (ibuf_ptr_fl) {
+          ibuf_ptr_fl[pixel_index] = imbuf::interpolate_bilinear_border_fl(
+              ibuf, margin_pixel.dest.x, margin_pixel.dest.y);
         }
-        else if (DijkstraPixelIsUnset(dp) || !IsDijkstraPixel(dp)) {
-          /* These are not margin pixels, make sure the extend filter which is run after this step
-           * leaves them alone.
-           */
-          mask[pixel_index] = 1;
+        if (ibuf_ptr_ch) {
+          ibuf_ptr_ch[pixel_index] = imbuf::interpolate_bilinear_border_byte(
+              ibuf, margin_pixel.dest.x, margin_pixel.dest.y);
         }
-        pixel_index++;
       }
     }
   }
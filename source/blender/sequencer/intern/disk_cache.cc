@@ -604,8 +604,8 @@ ImBuf *seq_disk_cache_read_file(SeqDiskCache *disk_cache, SeqCacheKey *key)
   DiskCacheHeader header;
 
   seq_disk_cache_get_file_path(disk_cache, key, filepath, sizeof(filepath));
-  BLI_file_ensure_parent_dir_exists(filepath);
 
+  /* No need to create the directory here, a missing directory simply means a cache miss. */
   FILE *file = BLI_fopen(filepath, "rb");
   if (!file) {
     BLI_mutex_unlock(&disk_cache->read_write_mutex);
@@ -74,14 +74,15 @@ static void glow_blur_bitmap(
     }
   });
 
-  /* Blur the columns: read temp, write map */
+  /* Blur the columns: read temp, write map. Rows are the outer loop so that neighboring pixels
+   * of a row are processed together, which keeps memory access contiguous. */
   threading::parallel_for(IndexRange(width), 32, [&](const IndexRange x_range) {
     const float4 one = float4(1.0f);
-    for (const int x : x_range) {
-      for (int y = 0; y < height; y++) {
+    for (int y = 0; y < height; y++) {
+      int ymin = math::max(y - halfWidth, 0);
+      int ymax = math::min(y + halfWidth, height);
+      for (const int x : x_range) {
         float4 curColor = float4(0.0f);
-        int ymin = math::max(y - halfWidth, 0);
-        int ymax = math::min(y + halfWidth, height);
         for (int ny = ymin, index = (ymin - y) + halfWidth; ny < ymax; ny++, index++) {
           curColor += temp[x + ny * width] * filter[index];
         }
@@ -20,6 +20,7 @@
 
 #include "BLI_listbase.h"
 #include "BLI_threads.h"
+#include "BLI_time.h"
 #include "BLI_vector_set.hh"
 
 #include "IMB_imbuf.hh"
@@ -257,8 +258,11 @@ void prefetch_stop(Scene *scene)
 
   pfjob->stop = true;
 
+  /* The job may be in the middle of rendering a frame, so don't spin on the flag and steal a core
+   * from the threads that are busy finishing it. */
   while (pfjob->running) {
     BLI_condition_notify_one(&pfjob->prefetch_suspend_cond);
+    BLI_time_sleep_ms(1);
   }
 }
 
@@ -12,9 +12,12 @@
 
 #  include "MEM_guardedalloc.h"
 
+#  include "BLI_array.hh"
+#  include "BLI_math_base.h"
 #  include "BLI_math_geom.h"
 #  include "BLI_math_matrix.h"
 #  include "BLI_math_vector.h"
+#  include "BLI_task.hh"
 
 #  include "BKE_cloth.hh"
 
@@ -28,6 +31,11 @@
 #    define CLOTH_OPENMP_LIMIT 512
 #  endif
 
+/* Vertex count per task for the long vector operations of the solver. The chunks of the dot
+ * product reduction are fixed so that simulation results don't depend on the number of threads.
+ */
+#  define CLOTH_PARALLEL_GRAIN_SIZE 1024
+
 // #define DEBUG_TIME
 
 #  ifdef DEBUG_TIME
@@ -165,15 +173,35 @@ DO_INLINE void submul_lfvectorS(float (*to)[3], float (*fLongVector)[3], float s
 /* dot product for big vector */
 DO_INLINE float dot_lfvector(float (*fLongVectorA)[3], float (*fLongVectorB)[3], uint verts)
 {
-  long i = 0;
-  float temp = 0.0;
-  /* XXX brecht, disabled this for now (first schedule line was already disabled),
-   * due to non-commutative nature of floating point ops this makes the sim give
-   * different results each time you run it!
-   * schedule(guided, 2) */
-  // #pragma omp parallel for reduction(+: temp) if (verts > CLOTH_OPENMP_LIMIT)
-  for (i = 0; i < long(verts); i++) {
-    temp += dot_v3v3(fLongVectorA[i], fLongVectorB[i]);
+  /* Due to non-commutative nature of floating point ops, a regular parallel reduction makes the
+   * sim give different results each time you run it. Sum fixed-size chunks in parallel and add
+   * the partial sums in order instead. */
+  const uint chunks_num = divide_ceil_u(verts, CLOTH_PARALLEL_GRAIN_SIZE);
+  if (chunks_num <= 1) {
+    float temp = 0.0f;
+    for (uint i = 0; i < verts; i++) {
+      temp += dot_v3v3(fLongVectorA[i], fLongVectorB[i]);
+    }
+    return temp;
+  }
+
+  blender::Array<float, 64> chunk_sums(chunks_num);
+  blender::threading::parallel_for(
+      blender::IndexRange(chunks_num), 1, [&](const blender::IndexRange range) {
+        for (const int64_t chunk : range) {
+          const uint start = uint(chunk) * CLOTH_PARALLEL_GRAIN_SIZE;
+          const uint end = std::min(start + CLOTH_PARALLEL_GRAIN_SIZE, verts);
+          float temp = 0.0f;
+          for (uint i = start; i < end; i++) {
+            temp += dot_v3v3(fLongVectorA[i], fLongVectorB[i]);
+          }
+          chunk_sums[chunk] = temp;
+        }
+      });
+
+  float temp = 0.0f;
+  for (const float chunk_sum : chunk_sums) {
+    temp += chunk_sum;
   }
   return temp;
 }
@@ -183,21 +211,23 @@ DO_INLINE void add_lfvector_lfvector(float (*to)[3],
                                      float (*fLongVectorB)[3],
                                      uint verts)
 {
-  uint i = 0;
-
-  for (i = 0; i < verts; i++) {
-    add_v3_v3v3(to[i], fLongVectorA[i], fLongVectorB[i]);
-  }
+  blender::threading::parallel_for(
+      blender::IndexRange(verts), CLOTH_PARALLEL_GRAIN_SIZE, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          add_v3_v3v3(to[i], fLongVectorA[i], fLongVectorB[i]);
+        }
+      });
 }
 /* `A = B + C * float` -> for big vector. */
 DO_INLINE void add_lfvector_lfvectorS(
     float (*to)[3], float (*fLongVectorA)[3], float (*fLongVectorB)[3], float bS, uint verts)
 {
-  uint i = 0;
-
-  for (i = 0; i < verts; i++) {
-    VECADDS(to[i], fLongVectorA[i], fLongVectorB[i], bS);
-  }
+  blender::threading::parallel_for(
+      blender::IndexRange(verts), CLOTH_PARALLEL_GRAIN_SIZE, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          VECADDS(to[i], fLongVectorA[i], fLongVectorB[i], bS);
+        }
+      });
 }
 /* `A = B * float + C * float` -> for big vector */
 DO_INLINE void add_lfvectorS_lfvectorS(float (*to)[3],
@@ -228,11 +258,12 @@ DO_INLINE void sub_lfvector_lfvector(float (*to)[3],
                                      float (*fLongVectorB)[3],
                                      uint verts)
 {
-  uint i = 0;
-
-  for (i = 0; i < verts; i++) {
-    sub_v3_v3v3(to[i], fLongVectorA[i], fLongVectorB[i]);
-  }
+  blender::threading::parallel_for(
+      blender::IndexRange(verts), CLOTH_PARALLEL_GRAIN_SIZE, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          sub_v3_v3v3(to[i], fLongVectorA[i], fLongVectorB[i]);
+        }
+      });
 }
 ///////////////////////////
 // 3x3 matrix
@@ -582,23 +613,21 @@ DO_INLINE void mul_bfmatrix_lfvector(float (*to)[3], fmatrix3x3 *from, lfVector
 
   zero_lfvector(to, vcount);
 
-#  pragma omp parallel sections if (vcount > CLOTH_OPENMP_LIMIT)
-  {
-#  pragma omp section
-    {
-      for (uint i = from[0].vcount; i < from[0].vcount + from[0].scount; i++) {
-        /* This is the lower triangle of the sparse matrix,
-         * therefore multiplication occurs with transposed sub-matrices. */
-        muladd_fmatrixT_fvector(to[from[i].c], from[i].m, fLongVector[from[i].r]);
-      }
-    }
-#  pragma omp section
-    {
-      for (uint i = 0; i < from[0].vcount + from[0].scount; i++) {
-        muladd_fmatrix_fvector(temp[from[i].r], from[i].m, fLongVector[from[i].c]);
-      }
-    }
-  }
+  /* Both halves scatter into their own vector, so they can be computed at the same time. */
+  blender::threading::parallel_invoke(
+      vcount > CLOTH_PARALLEL_GRAIN_SIZE,
+      [&]() {
+        for (uint i = from[0].vcount; i < from[0].vcount + from[0].scount; i++) {
+          /* This is the lower triangle of the sparse matrix,
+           * therefore multiplication occurs with transposed sub-matrices. */
+          muladd_fmatrixT_fvector(to[from[i].c], from[i].m, fLongVector[from[i].r]);
+        }
+      },
+      [&]() {
+        for (uint i = 0; i < from[0].vcount + from[0].scount; i++) {
+          muladd_fmatrix_fvector(temp[from[i].r], from[i].m, fLongVector[from[i].c]);
+        }
+      });
   add_lfvector_lfvector(to, to, temp, from[0].vcount);
 
   del_lfvector(temp);
@@ -733,11 +762,14 @@ BLI_INLINE void root_to_world_m3(Implicit_Data *data,
 
 DO_INLINE void filter(lfVector *V, fmatrix3x3 *S)
 {
-  uint i = 0;
-
-  for (i = 0; i < S[0].vcount; i++) {
-    mul_m3_v3(S[i].m, V[S[i].r]);
-  }
+  /* The constraint matrix is block diagonal, every block filters a different vertex. */
+  blender::threading::parallel_for(blender::IndexRange(S[0].vcount),
+                                   CLOTH_PARALLEL_GRAIN_SIZE,
+                                   [&](const blender::IndexRange range) {
+                                     for (const int64_t i : range) {
+                                       mul_m3_v3(S[i].m, V[S[i].r]);
+                                     }
+                                   });
 }
 
 /* this version of the CG algorithm does not work very well with partial constraints
@@ -979,6 +979,10 @@ static void file_read_reports_finalize(BlendFileReadReport *bf_reports)
             bf_reports->count.resynced_lib_overrides,
             duration_lib_override_recursive_resync_minutes,
             duration_lib_override_recursive_resync_seconds);
+  BLO_read_report_stats_log(bf_reports);
+  if (G.debug & G_DEBUG_IO) {
+    printf("Blender file read statistics: %s\n", BLO_read_report_stats_json(bf_reports).c_str());
+  }
 
   if (bf_reports->resynced_lib_overrides_libraries_count != 0) {
     for (LinkNode *node_lib = bf_reports->resynced_lib_overrides_libraries; node_lib != nullptr;
@@ -1124,7 +1128,9 @@ bool WM_file_read(bContext *C, const char *filepath, ReportList *reports)
       read_file_post_params.reset_app_template = false;
       read_file_post_params.success = true;
       read_file_post_params.is_alloc = false;
+      bf_reports.duration.post_load = BLI_time_now_seconds();
       wm_file_read_post(C, filepath, &read_file_post_params);
+      bf_reports.duration.post_load = BLI_time_now_seconds() - bf_reports.duration.post_load;
 
       bf_reports.duration.whole = BLI_time_now_seconds() - bf_reports.duration.whole;
       file_read_reports_finalize(&bf_reports);
@@ -2335,9 +2341,10 @@ void WM_autosave_write(wmWindowManager *wm, Main *bmain)
    */
   const int fileflags = G.fileflags | G_FILE_RECOVER_WRITE | G_FILE_COMPRESS;
 
-  /* Error reporting into console. */
+  /* Error reporting into console. Only serialize the file here, compressing and writing it
+   * happens in the background so that the UI is not blocked for the whole save. */
   BlendFileWriteParams params{};
-  BLO_write_file(bmain, filepath, fileflags, &params, nullptr);
+  BLO_write_file_deferred(bmain, filepath, fileflags, &params, nullptr);
 
   /* Restart auto-save timer. */
   wm_autosave_timer_end(wm);
@@ -2403,6 +2410,8 @@ void wm_autosave_delete()
 {
   char filepath[FILE_MAX];
 
+  BLO_write_file_deferred_wait();
+
   wm_autosave_location(filepath);
 
   if (BLI_exists(filepath)) {
@@ -3507,6 +3516,9 @@ static int wm_recover_auto_save_exec(bContext *C, wmOperator *op)
   RNA_string_get(op->ptr, "filepath", filepath);
   BLI_path_canonicalize_native(filepath, sizeof(filepath));
 
+  /* The auto-save file may still be written in the background. */
+  BLO_write_file_deferred_wait();
+
   wm_open_init_use_scripts(op, true);
   SET_FLAG_FROM_TEST(G.f, RNA_boolean_get(op->ptr, "use_scripts"), G_FLAG_SCRIPT_AUTOEXEC);
 
@@ -73,6 +73,7 @@
 #  endif
 
 #  include "DEG_depsgraph.hh"
+#  include "DEG_depsgraph_debug.hh"
 
 #  include "WM_types.hh"
 
@@ -750,6 +751,7 @@ static void print_help(bArgs *ba, bool all)
   BLI_args_print_arg_doc(ba, "--debug-depsgraph-time");
   BLI_args_print_arg_doc(ba, "--debug-depsgraph-pretty");
   BLI_args_print_arg_doc(ba, "--debug-depsgraph-uid");
+  BLI_args_print_arg_doc(ba, "--debug-depsgraph-trace");
   BLI_args_print_arg_doc(ba, "--debug-ghost");
   BLI_args_print_arg_doc(ba, "--debug-wintab");
   BLI_args_print_arg_doc(ba, "--debug-gpu");
@@ -793,6 +795,7 @@ static void print_help(bArgs *ba, bool all)
   BLI_args_print_arg_doc(ba, "--app-template");
   BLI_args_print_arg_doc(ba, "--factory-startup");
   BLI_args_print_arg_doc(ba, "--enable-event-simulate");
+  BLI_args_print_arg_doc(ba, "--enable-huge-pages");
   PRINT("\n");
   BLI_args_print_arg_doc(ba, "--env-system-datafiles");
   BLI_args_print_arg_doc(ba, "--env-system-scripts");
@@ -1007,6 +1010,17 @@ static int arg_handle_abort_handler_disable(int /*argc*/, const char ** /*argv*/
   return 0;
 }
 
+static const char arg_handle_huge_pages_enable_doc[] =
+    "\n\t"
+    "Back large memory allocations with transparent huge pages (Linux only).\n"
+    "\tThis can improve performance when processing very large data-sets,\n"
+    "\tat the cost of a possibly higher memory usage.";
+static int arg_handle_huge_pages_enable(int /*argc*/, const char ** /*argv*/, void * /*data*/)
+{
+  MEM_use_transparent_huge_pages();
+  return 0;
+}
+
 static void clog_abort_on_error_callback(void *fp)
 {
   BLI_system_backtrace(static_cast<FILE *>(fp));
@@ -1144,6 +1158,19 @@ static int arg_handle_disable_liboverride_auto_resync(int /*argc*/,
   return 0;
 }
 
+static const char arg_handle_defer_geometry_on_file_load_doc[] =
+    "\n"
+    "\tDefer loading the large geometry arrays (mesh, curves and point cloud attributes...)\n"
+    "\tof uncompressed blendfiles until they are used, instead of reading them all on load.\n"
+    "\tUseful for files where most of the geometry is hidden or excluded.";
+static int arg_handle_defer_geometry_on_file_load(int /*argc*/,
+                                                  const char ** /*argv*/,
+                                                  void * /*data*/)
+{
+  G.fileflags |= G_FILE_DEFER_GEOMETRY_READ;
+  return 0;
+}
+
 static const char arg_handle_log_level_set_doc[] =
     "<level>\n"
     "\tSet the logging verbosity level (higher for more details) defaults to 1,\n"
@@ -1365,6 +1392,22 @@ static int arg_handle_debug_mode_generic_set(int /*argc*/, const char ** /*argv*
   return 0;
 }
 
+static const char arg_handle_debug_depsgraph_trace_set_doc[] =
+    "<filepath>\n"
+    "\tRecord evaluation of every dependency graph operation, with its thread and timing.\n"
+    "\tThe trace is written to the file on exit in the Trace Event Format\n"
+    "\t(viewable in 'chrome://tracing' or Perfetto).";
+static int arg_handle_debug_depsgraph_trace_set(int argc, const char **argv, void * /*data*/)
+{
+  const char *arg_id = "--debug-depsgraph-trace";
+  if (argc > 1) {
+    DEG_debug_trace_begin(argv[1]);
+    return 1;
+  }
+  fprintf(stderr, "\nError: '%s' no args given.\n", arg_id);
+  return 0;
+}
+
 static const char arg_handle_debug_mode_io_doc[] =
     "\n\t"
     "Enable debug messages for I/O (Collada, ...).";
@@ -2714,6 +2757,7 @@ void main_args_setup(bContext *C, bArgs *ba, bool all)
       ba, nullptr, "--disable-crash-handler", CB(arg_handle_crash_handler_disable), nullptr);
   BLI_args_add(
       ba, nullptr, "--disable-abort-handler", CB(arg_handle_abort_handler_disable), nullptr);
+  BLI_args_add(ba, nullptr, "--enable-huge-pages", CB(arg_handle_huge_pages_enable), nullptr);
 
   BLI_args_add(ba, "-q", "--quiet", CB(arg_handle_quiet_set), nullptr);
   BLI_args_add(ba, "-b", "--background", CB(arg_handle_background_mode_set), nullptr);
@@ -2732,6 +2776,12 @@ void main_args_setup(bContext *C, bArgs *ba, bool all)
                CB(arg_handle_disable_liboverride_auto_resync),
                nullptr);
 
+  BLI_args_add(ba,
+               nullptr,
+               "--defer-geometry-on-file-load",
+               CB(arg_handle_defer_geometry_on_file_load),
+               nullptr);
+
   BLI_args_add(ba, "-a", nullptr, CB(arg_handle_playback_mode), nullptr);
 
   BLI_args_add(ba, "-d", "--debug", CB(arg_handle_debug_mode_set), ba);
@@ -2867,6 +2917,11 @@ void main_args_setup(bContext *C, bArgs *ba, bool all)
                "--debug-depsgraph-uid",
                CB_EX(arg_handle_debug_mode_generic_set, depsgraph_uid),
                (void *)G_DEBUG_DEPSGRAPH_UID);
+  BLI_args_add(ba,
+               nullptr,
+               "--debug-depsgraph-trace",
+               CB(arg_handle_debug_depsgraph_trace_set),
+               nullptr);
   BLI_args_add(ba,
                nullptr,
                "--debug-gpu-force-workarounds",
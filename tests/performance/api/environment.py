@@ -257,9 +257,10 @@ class TestEnvironment:
 
         expression = (f'import sys, pickle, base64;'
                       f'sys.path.append(r"{package_path}");'
-                      f'import {modulename};'
+                      f'import api, {modulename};'
                       f'args = pickle.loads(base64.b64decode({args}));'
                       f'result = {modulename}.{functionname}(args);'
+                      f'result = api.add_memory_statistics(result);'
                       f'result = base64.b64encode(pickle.dumps(result));'
                       f'print("\\n{output_prefix}" + result.decode() + "\\n")')
 
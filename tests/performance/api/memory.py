@@ -0,0 +1,44 @@
+# SPDX-FileCopyrightText: 2025 Blender Authors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import sys
+
+
+def peak_memory() -> float:
+    """
+    Peak resident memory of the current process in bytes, or -1 when it can't be queried.
+
+    Meant to be called from inside the Blender process running a test, at the end of the test.
+    """
+    try:
+        import resource
+    except ImportError:
+        return -1.0
+
+    usage = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    # Linux reports kilobytes, macOS reports bytes.
+    if sys.platform == 'darwin':
+        return float(usage)
+    return float(usage) * 1024.0
+
+
+def add_memory_statistics(result):
+    """
+    Add memory statistics of the current process to the output of a test, keeping any values the
+    test already measured itself. Results that are not a dictionary are returned unchanged.
+
+    The allocator statistics are only available in newer Blender versions, older versions only
+    report the peak resident memory.
+    """
+    if not isinstance(result, dict):
+        return result
+
+    import bpy
+
+    result.setdefault('peak_memory', peak_memory())
+    if hasattr(bpy.app, "memory_statistics"):
+        statistics = bpy.app.memory_statistics()
+        result.setdefault('guardedalloc_peak_memory', float(statistics['peak']))
+        result.setdefault('allocations', float(statistics['allocations']))
+    return result
@@ -79,6 +79,8 @@ def print_row(config: api.TestConfig, entries: list, end='\n') -> None:
         result = ''
         if status in {'done', 'outdated'} and output:
             result = '%.4fs' % output['time']
+            if output.get('peak_memory', -1.0) > 0.0:
+                result += ' %.0fMB' % (output['peak_memory'] / (1024 * 1024))
 
             if status == 'outdated':
                 result += " (outdated)"
@@ -0,0 +1,126 @@
+# SPDX-FileCopyrightText: 2025 Blender Authors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+
+
+def _generate_scene(args):
+    import bpy
+
+    bpy.ops.wm.read_homefile(use_empty=True, use_factory_startup=True)
+
+    # One dense mesh for the bulk data, and many small objects for the per-ID overhead.
+    bpy.ops.mesh.primitive_grid_add(
+        x_subdivisions=args['resolution'], y_subdivisions=args['resolution'], size=2.0)
+
+    mesh = bpy.data.meshes.new("Cube")
+    mesh.from_pydata(
+        [(x, y, z) for x in (-0.1, 0.1) for y in (-0.1, 0.1) for z in (-0.1, 0.1)],
+        [],
+        [(0, 1, 3, 2), (4, 6, 7, 5), (0, 4, 5, 1), (2, 3, 7, 6), (0, 2, 6, 4), (1, 5, 7, 3)])
+    collection = bpy.context.scene.collection
+    for i in range(args['objects_num']):
+        ob = bpy.data.objects.new(f"Cube {i}", mesh)
+        ob.location = (i % 100, i // 100, 1.0)
+        collection.objects.link(ob)
+
+
+def _run_save(args):
+    import bpy
+    import os
+    import tempfile
+    import time
+
+    _generate_scene(args)
+
+    with tempfile.TemporaryDirectory() as temp_dir:
+        filepath = os.path.join(temp_dir, "benchmark.blend")
+
+        # Save once first, so that the timed save doesn't include creating the file.
+        bpy.ops.wm.save_as_mainfile(filepath=filepath, compress=args['compress'])
+
+        start_time = time.time()
+        bpy.ops.wm.save_as_mainfile(filepath=filepath, compress=args['compress'])
+        elapsed_time = time.time() - start_time
+
+    return {'time': elapsed_time}
+
+
+def _run_undo_push(args):
+    import bpy
+    import time
+
+    _generate_scene(args)
+
+    # Create an undo stack explicitly. This isn't created by default in background mode.
+    bpy.ops.ed.undo_push(message="Generate")
+
+    # Change a single object between pushes, which is the common case when working interactively.
+    ob = bpy.data.objects[0]
+    measured_times = []
+    for i in range(args['pushes_num']):
+        ob.location.z = float(i)
+        start_time = time.time()
+        bpy.ops.ed.undo_push(message="Move")
+        measured_times.append(time.time() - start_time)
+
+    average_time = sum(measured_times) / len(measured_times)
+    return {'time': average_time}
+
+
+class BlendSaveTest(api.Test):
+    def __init__(self, compress, objects_num, resolution):
+        self.compress = compress
+        self.objects_num = objects_num
+        self.resolution = resolution
+
+    def name(self):
+        compress_suffix = "_compressed" if self.compress else ""
+        return f"save_{self.objects_num}_objects{compress_suffix}"
+
+    def category(self):
+        return "blend_save"
+
+    def run(self, env, device_id):
+        args = {
+            'compress': self.compress,
+            'objects_num': self.objects_num,
+            'resolution': self.resolution,
+        }
+
+        result, _ = env.run_in_blender(_run_save, args, ['--factory-startup'])
+
+        return result
+
+
+class UndoPushTest(api.Test):
+    def __init__(self, objects_num, resolution, pushes_num):
+        self.objects_num = objects_num
+        self.resolution = resolution
+        self.pushes_num = pushes_num
+
+    def name(self):
+        return f"undo_push_{self.objects_num}_objects"
+
+    def category(self):
+        return "blend_save"
+
+    def run(self, env, device_id):
+        args = {
+            'objects_num': self.objects_num,
+            'resolution': self.resolution,
+            'pushes_num': self.pushes_num,
+        }
+
+        result, _ = env.run_in_blender(_run_undo_push, args, ['--factory-startup'])
+
+        return result
+
+
+def generate(env):
+    return [
+        BlendSaveTest(compress=False, objects_num=10000, resolution=1000),
+        BlendSaveTest(compress=True, objects_num=10000, resolution=1000),
+        UndoPushTest(objects_num=10000, resolution=1000, pushes_num=20),
+    ]
@@ -0,0 +1,107 @@
+# SPDX-FileCopyrightText: 2025 Blender Authors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+
+
+def _build_compositor_tree(scene, image, blur_size):
+    """
+    Build a node tree with a mix of cheap per-pixel nodes and expensive neighborhood nodes, reading
+    from an image so that no scene has to be rendered.
+    """
+    scene.use_nodes = True
+    tree = scene.node_tree
+    tree.nodes.clear()
+
+    image_node = tree.nodes.new('CompositorNodeImage')
+    image_node.image = image
+
+    blur = tree.nodes.new('CompositorNodeBlur')
+    blur.size_x = blur_size
+    blur.size_y = blur_size
+
+    glare = tree.nodes.new('CompositorNodeGlare')
+    glare.glare_type = 'FOG_GLOW'
+
+    color_balance = tree.nodes.new('CompositorNodeColorBalance')
+    color_balance.lift = (0.9, 1.0, 1.1)
+
+    defocus = tree.nodes.new('CompositorNodeDefocus')
+    defocus.use_zbuffer = False
+
+    composite = tree.nodes.new('CompositorNodeComposite')
+
+    tree.links.new(image_node.outputs['Image'], blur.inputs['Image'])
+    tree.links.new(blur.outputs['Image'], glare.inputs['Image'])
+    tree.links.new(glare.outputs['Image'], color_balance.inputs['Image'])
+    tree.links.new(color_balance.outputs['Image'], defocus.inputs['Image'])
+    tree.links.new(defocus.outputs['Image'], composite.inputs['Image'])
+
+
+def _run(args):
+    import bpy
+    import time
+
+    scene = bpy.context.scene
+    width = args['width']
+    height = args['height']
+
+    image = bpy.data.images.new("Benchmark", width, height, alpha=True, float_buffer=True)
+    image.generated_type = 'COLOR_GRID'
+
+    scene.render.resolution_x = width
+    scene.render.resolution_y = height
+    scene.render.resolution_percentage = 100
+    scene.render.use_compositing = True
+    scene.render.use_sequencer = False
+    scene.render.compositor_device = args['device']
+
+    _build_compositor_tree(scene, image, args['blur_size'])
+
+    # Execute once first, so that one-time setup like shader compilation is not measured.
+    bpy.ops.render.render()
+
+    measured_times = []
+    for _ in range(args['iterations']):
+        start_time = time.time()
+        bpy.ops.render.render()
+        measured_times.append(time.time() - start_time)
+
+    average_time = sum(measured_times) / len(measured_times)
+    return {'time': average_time}
+
+
+class CompositorTest(api.Test):
+    def __init__(self, device, width, height):
+        self.device = device
+        self.width = width
+        self.height = height
+
+    def name(self):
+        return f"{self.device.lower()}_{self.width}x{self.height}"
+
+    def category(self):
+        return "compositor"
+
+    def run(self, env, device_id):
+        args = {
+            'device': self.device,
+            'width': self.width,
+            'height': self.height,
+            'blur_size': 32,
+            'iterations': 3,
+        }
+
+        result, _ = env.run_in_blender(_run, args, ['--factory-startup'])
+
+        return result
+
+
+def generate(env):
+    # Only the CPU device is measured, the GPU compositor needs a GPU context which isn't
+    # available in background mode.
+    return [
+        CompositorTest('CPU', 1920, 1080),
+        CompositorTest('CPU', 3840, 2160),
+    ]
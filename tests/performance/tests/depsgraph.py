@@ -0,0 +1,96 @@
+# SPDX-FileCopyrightText: 2025 Blender Authors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+
+
+def _generate_scene(args):
+    """
+    Create many objects with modifiers, parenting and drivers, so that building the dependency
+    graph has a lot of nodes and relations to handle.
+    """
+    import bpy
+
+    bpy.ops.wm.read_homefile(use_empty=True, use_factory_startup=True)
+
+    mesh = bpy.data.meshes.new("Cube")
+    mesh.from_pydata(
+        [(x, y, z) for x in (-0.1, 0.1) for y in (-0.1, 0.1) for z in (-0.1, 0.1)],
+        [],
+        [(0, 1, 3, 2), (4, 6, 7, 5), (0, 4, 5, 1), (2, 3, 7, 6), (0, 2, 6, 4), (1, 5, 7, 3)])
+
+    collection = bpy.context.scene.collection
+    parent = None
+    for i in range(args['objects_num']):
+        ob = bpy.data.objects.new(f"Cube {i}", mesh)
+        ob.location = (1.0, 0.0, 0.0) if parent else (0.0, i * 0.5, 0.0)
+        ob.modifiers.new("Subdivision", 'SUBSURF').levels = 1
+        # Build short parent chains, long chains would mostly measure evaluation order.
+        if parent is not None:
+            ob.parent = parent
+            driver = ob.driver_add("rotation_euler", 2).driver
+            driver.type = 'SCRIPTED'
+            driver.expression = "frame * 0.01"
+        collection.objects.link(ob)
+        parent = ob if (i + 1) % args['chain_length'] else None
+
+
+def _run(args):
+    import bpy
+    import time
+
+    _generate_scene(args)
+
+    # The first update builds the dependency graph from scratch and evaluates everything.
+    view_layer = bpy.context.view_layer
+    start_time = time.time()
+    view_layer.update()
+    build_time = time.time() - start_time
+
+    # Adding an object tags relations for a rebuild, which is what happens on most edits that
+    # change the scene structure. Evaluation of the rest of the scene is skipped.
+    measured_times = []
+    for i in range(args['rebuilds_num']):
+        ob = bpy.data.objects.new(f"Empty {i}", None)
+        bpy.context.scene.collection.objects.link(ob)
+        start_time = time.time()
+        view_layer.update()
+        measured_times.append(time.time() - start_time)
+
+    rebuild_time = sum(measured_times) / len(measured_times)
+    return {
+        'time': rebuild_time,
+        'build_time': build_time,
+    }
+
+
+class DepsgraphTest(api.Test):
+    def __init__(self, objects_num, chain_length, rebuilds_num):
+        self.objects_num = objects_num
+        self.chain_length = chain_length
+        self.rebuilds_num = rebuilds_num
+
+    def name(self):
+        return f"relations_{self.objects_num}_objects"
+
+    def category(self):
+        return "depsgraph"
+
+    def run(self, env, device_id):
+        args = {
+            'objects_num': self.objects_num,
+            'chain_length': self.chain_length,
+            'rebuilds_num': self.rebuilds_num,
+        }
+
+        result, _ = env.run_in_blender(_run, args, ['--factory-startup'])
+
+        return result
+
+
+def generate(env):
+    return [
+        DepsgraphTest(objects_num=10000, chain_length=10, rebuilds_num=10),
+        DepsgraphTest(objects_num=50000, chain_length=10, rebuilds_num=5),
+    ]
@@ -0,0 +1,93 @@
+# SPDX-FileCopyrightText: 2025 Blender Authors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+
+# File format name, extension, export operator and import operator names in `bpy.ops.wm`.
+FORMATS = (
+    ('obj', '.obj', 'obj_export', 'obj_import'),
+    ('ply', '.ply', 'ply_export', 'ply_import'),
+    ('usd', '.usdc', 'usd_export', 'usd_import'),
+    ('alembic', '.abc', 'alembic_export', 'alembic_import'),
+)
+
+
+def _generate_scene(args):
+    import bpy
+
+    bpy.ops.wm.read_homefile(use_empty=True, use_factory_startup=True)
+
+    # A few dense meshes with UVs, so that both per-element and per-object costs show up.
+    resolution = args['resolution']
+    for i in range(args['objects_num']):
+        bpy.ops.mesh.primitive_grid_add(
+            x_subdivisions=resolution,
+            y_subdivisions=resolution,
+            size=2.0,
+            calc_uvs=True,
+            location=(i * 2.5, 0.0, 0.0))
+
+
+def _run(args):
+    import bpy
+    import os
+    import tempfile
+    import time
+
+    _, extension, export_operator, import_operator = next(
+        file_format for file_format in FORMATS if file_format[0] == args['format'])
+
+    with tempfile.TemporaryDirectory() as temp_dir:
+        filepath = os.path.join(temp_dir, "benchmark" + extension)
+
+        _generate_scene(args)
+
+        start_time = time.time()
+        getattr(bpy.ops.wm, export_operator)(filepath=filepath)
+        export_time = time.time() - start_time
+
+        if args['mode'] == 'export':
+            return {'time': export_time}
+
+        bpy.ops.wm.read_homefile(use_empty=True, use_factory_startup=True)
+
+        start_time = time.time()
+        getattr(bpy.ops.wm, import_operator)(filepath=filepath)
+        import_time = time.time() - start_time
+
+        return {'time': import_time}
+
+
+class FileIOTest(api.Test):
+    def __init__(self, file_format, mode, objects_num, resolution):
+        self.file_format = file_format
+        self.mode = mode
+        self.objects_num = objects_num
+        self.resolution = resolution
+
+    def name(self):
+        return f"{self.file_format}_{self.mode}_{self.objects_num}x{self.resolution}"
+
+    def category(self):
+        return "io"
+
+    def run(self, env, device_id):
+        args = {
+            'format': self.file_format,
+            'mode': self.mode,
+            'objects_num': self.objects_num,
+            'resolution': self.resolution,
+        }
+
+        result, _ = env.run_in_blender(_run, args, ['--factory-startup'])
+
+        return result
+
+
+def generate(env):
+    tests = []
+    for file_format, _, _, _ in FORMATS:
+        for mode in ('export', 'import'):
+            tests.append(FileIOTest(file_format, mode, objects_num=4, resolution=1000))
+    return tests
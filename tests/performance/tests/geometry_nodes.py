@@ -5,7 +5,7 @@
 import api
 
 
-def _run(args):
+def _measure_update_time():
     import bpy
     import time
 
@@ -42,6 +42,60 @@ def _run(args):
     return result
 
 
+def _run(args):
+    return _measure_update_time()
+
+
+def _run_many_nodes(args):
+    import bpy
+
+    # Build a node tree with many cheap single value nodes, so that the time is dominated by the
+    # scheduling overhead of the evaluator rather than by the work done in the nodes.
+    tree = bpy.data.node_groups.new("Many Nodes", 'GeometryNodeTree')
+    tree.interface.new_socket("Geometry", in_out='INPUT', socket_type='NodeSocketGeometry')
+    tree.interface.new_socket("Geometry", in_out='OUTPUT', socket_type='NodeSocketGeometry')
+    group_input = tree.nodes.new('NodeGroupInput')
+    group_output = tree.nodes.new('NodeGroupOutput')
+    set_position = tree.nodes.new('GeometryNodeSetPosition')
+    combine = tree.nodes.new('ShaderNodeCombineXYZ')
+
+    chain_ends = []
+    for chain_index in range(args['chains_num']):
+        previous = None
+        for i in range(args['chain_length']):
+            node = tree.nodes.new('ShaderNodeMath')
+            node.operation = 'ADD' if i % 2 == 0 else 'MULTIPLY'
+            node.inputs[0].default_value = chain_index
+            node.inputs[1].default_value = 1.0 if i % 2 == 0 else 0.5
+            if previous is not None:
+                tree.links.new(previous.outputs[0], node.inputs[0])
+            previous = node
+        chain_ends.append(previous)
+
+    # Sum up all chains so that every node is required for the output.
+    total = chain_ends[0]
+    for chain_end in chain_ends[1:]:
+        node = tree.nodes.new('ShaderNodeMath')
+        node.operation = 'ADD'
+        tree.links.new(total.outputs[0], node.inputs[0])
+        tree.links.new(chain_end.outputs[0], node.inputs[1])
+        total = node
+
+    tree.links.new(total.outputs[0], combine.inputs['Z'])
+    tree.links.new(group_input.outputs[0], set_position.inputs['Geometry'])
+    tree.links.new(combine.outputs[0], set_position.inputs['Offset'])
+    tree.links.new(set_position.outputs[0], group_output.inputs[0])
+
+    mesh = bpy.data.meshes.new("Mesh")
+    mesh.from_pydata([(0.0, 0.0, 0.0)], [], [])
+    ob = bpy.data.objects.new("Object", mesh)
+    bpy.context.scene.collection.objects.link(ob)
+    modifier = ob.modifiers.new("Nodes", 'NODES')
+    modifier.node_group = tree
+
+    return _measure_update_time()
+
+
 class GeometryNodesTest(api.Test):
     def __init__(self, filepath):
         self.filepath = filepath
@@ -60,6 +114,33 @@ class GeometryNodesTest(api.Test):
         return result
 
 
+class GeometryNodesManyNodesTest(api.Test):
+    """
+    Evaluates a generated node tree with thousands of cheap nodes to measure the overhead of
+    scheduling nodes in the lazy-function graph executor.
+    """
+
+    def __init__(self, chains_num, chain_length):
+        self.chains_num = chains_num
+        self.chain_length = chain_length
+
+    def name(self):
+        return f"many_nodes_{self.chains_num}x{self.chain_length}"
+
+    def category(self):
+        return "geometry_nodes"
+
+    def run(self, env, device_id):
+        args = {'chains_num': self.chains_num, 'chain_length': self.chain_length}
+
+        result, _ = env.run_in_blender(_run_many_nodes, args, ['--factory-startup'])
+
+        return result
+
+
 def generate(env):
     filepaths = env.find_blend_files('geometry_nodes/*')
-    return [GeometryNodesTest(filepath) for filepath in filepaths]
+    tests = [GeometryNodesTest(filepath) for filepath in filepaths]
+    tests.append(GeometryNodesManyNodesTest(chains_num=1, chain_length=2000))
+    tests.append(GeometryNodesManyNodesTest(chains_num=100, chain_length=20))
+    return tests
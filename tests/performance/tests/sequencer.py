@@ -0,0 +1,109 @@
+# SPDX-FileCopyrightText: 2025 Blender Authors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+
+
+def _generate_timeline(scene, args):
+    """
+    Fill the sequencer with stacked color and text strips and effects on top of them, so that
+    every frame has to blend several full resolution images.
+    """
+    scene.sequence_editor_create()
+    strips = scene.sequence_editor.strips
+
+    frame_start = scene.frame_start
+    frame_end = frame_start + args['frames_num']
+
+    background = strips.new_effect(
+        "Background", 'COLOR', 1, frame_start=frame_start, frame_end=frame_end)
+    background.color = (0.2, 0.3, 0.4)
+
+    overlay = strips.new_effect(
+        "Overlay", 'COLOR', 2, frame_start=frame_start, frame_end=frame_end)
+    overlay.color = (0.8, 0.4, 0.1)
+    overlay.blend_type = 'ALPHA_OVER'
+    overlay.blend_alpha = 0.5
+
+    text = strips.new_effect("Text", 'TEXT', 3, frame_start=frame_start, frame_end=frame_end)
+    text.text = "Benchmark"
+    text.font_size = 200
+    text.blend_type = 'ALPHA_OVER'
+
+    cross = strips.new_effect(
+        "Cross", 'CROSS', 4, frame_start=frame_start, frame_end=frame_end,
+        seq1=background, seq2=text)
+
+    transform = strips.new_effect(
+        "Transform", 'TRANSFORM', 5, frame_start=frame_start, frame_end=frame_end, seq1=cross)
+    transform.rotation_start = 10.0
+    transform.scale_start_x = 1.2
+    transform.scale_start_y = 1.2
+
+    blur = strips.new_effect(
+        "Blur", 'GAUSSIAN_BLUR', 6, frame_start=frame_start, frame_end=frame_end,
+        seq1=transform)
+    blur.size_x = 20.0
+    blur.size_y = 20.0
+
+    glow = strips.new_effect(
+        "Glow", 'GLOW', 7, frame_start=frame_start, frame_end=frame_end, seq1=blur)
+    glow.threshold = 0.3
+
+    scene.frame_end = frame_end - 1
+
+
+def _run(args):
+    import bpy
+    import time
+
+    scene = bpy.context.scene
+    scene.render.resolution_x = args['width']
+    scene.render.resolution_y = args['height']
+    scene.render.resolution_percentage = 100
+    scene.render.use_sequencer = True
+    scene.render.use_compositing = False
+
+    _generate_timeline(scene, args)
+
+    # Render every frame once, each frame is different so the sequencer cache doesn't help.
+    start_time = time.time()
+    for frame in range(scene.frame_start, scene.frame_end + 1):
+        scene.frame_set(frame)
+        bpy.ops.render.render()
+    elapsed_time = time.time() - start_time
+
+    time_per_frame = elapsed_time / args['frames_num']
+    return {'time': time_per_frame}
+
+
+class SequencerTest(api.Test):
+    def __init__(self, width, height, frames_num):
+        self.width = width
+        self.height = height
+        self.frames_num = frames_num
+
+    def name(self):
+        return f"effects_{self.width}x{self.height}"
+
+    def category(self):
+        return "sequencer"
+
+    def run(self, env, device_id):
+        args = {
+            'width': self.width,
+            'height': self.height,
+            'frames_num': self.frames_num,
+        }
+
+        result, _ = env.run_in_blender(_run, args, ['--factory-startup'])
+
+        return result
+
+
+def generate(env):
+    return [
+        SequencerTest(1920, 1080, frames_num=50),
+        SequencerTest(3840, 2160, frames_num=20),
+    ]
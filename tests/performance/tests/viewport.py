@@ -0,0 +1,119 @@
+# SPDX-FileCopyrightText: 2025 Blender Authors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+
+LOG_KEY = "VIEWPORT_PERFORMANCE: "
+WARMUP_ITERATIONS = 10
+RECORD_ITERATIONS = 50
+
+
+def _generate_scene(args):
+    import bpy
+
+    # Remove the objects from the startup file, the window layout is kept.
+    for ob in list(bpy.data.objects):
+        bpy.data.objects.remove(ob)
+
+    collection = bpy.context.scene.collection
+    if args['case'] == 'objects':
+        mesh = bpy.data.meshes.new("Cube")
+        mesh.from_pydata(
+            [(x, y, z) for x in (-0.1, 0.1) for y in (-0.1, 0.1) for z in (-0.1, 0.1)],
+            [],
+            [(0, 1, 3, 2), (4, 6, 7, 5), (0, 4, 5, 1), (2, 3, 7, 6), (0, 2, 6, 4), (1, 5, 7, 3)])
+        for i in range(args['objects_num']):
+            ob = bpy.data.objects.new(f"Cube {i}", mesh)
+            ob.location = (i % 100 * 0.5, i // 100 * 0.5, 0.0)
+            collection.objects.link(ob)
+    else:
+        bpy.ops.mesh.primitive_grid_add(
+            x_subdivisions=args['resolution'], y_subdivisions=args['resolution'], size=2.0)
+
+
+def _measure(args):
+    import bpy
+    import time
+
+    window = bpy.context.window_manager.windows[0]
+    area = next(area for area in window.screen.areas if area.type == 'VIEW_3D')
+    region = next(region for region in area.regions if region.type == 'WINDOW')
+    space = area.spaces.active
+
+    space.shading.type = 'SOLID'
+    space.overlay.show_overlays = True
+    if args['case'] == 'overlays':
+        space.overlay.show_wireframes = True
+        space.overlay.show_face_orientation = True
+        space.overlay.show_stats = True
+
+    with bpy.context.temp_override(window=window, area=area, region=region):
+        if args['case'] == 'edit_mesh':
+            bpy.ops.object.mode_set(mode='EDIT')
+            bpy.ops.mesh.select_all(action='SELECT')
+        bpy.ops.view3d.view_all()
+
+        # Warm up, so that shader compilation and first time batch creation are not measured.
+        bpy.ops.wm.redraw_timer(type='DRAW_SWAP', iterations=WARMUP_ITERATIONS)
+
+        start_time = time.perf_counter()
+        bpy.ops.wm.redraw_timer(type='DRAW_SWAP', iterations=RECORD_ITERATIONS)
+        elapsed_time = time.perf_counter() - start_time
+
+    result = api.add_memory_statistics({'time': elapsed_time / RECORD_ITERATIONS})
+    print(f"{LOG_KEY}{result}")
+    bpy.ops.wm.quit_blender()
+    return None
+
+
+def _run(args):
+    import bpy
+    import functools
+
+    _generate_scene(args)
+
+    # Drawing needs the window to be fully set up, which only happens after this script ran.
+    bpy.app.timers.register(functools.partial(_measure, args), first_interval=1.0)
+
+
+class ViewportTest(api.Test):
+    def __init__(self, case, objects_num=0, resolution=0):
+        self.case = case
+        self.objects_num = objects_num
+        self.resolution = resolution
+
+    def name(self):
+        if self.case == 'objects':
+            return f"{self.case}_{self.objects_num}"
+        return f"{self.case}_{self.resolution}x{self.resolution}"
+
+    def category(self):
+        return "viewport"
+
+    def use_background(self):
+        return False
+
+    def run(self, env, device_id):
+        args = {
+            'case': self.case,
+            'objects_num': self.objects_num,
+            'resolution': self.resolution,
+        }
+
+        _, log = env.run_in_blender(_run, args, [], foreground=True)
+        for line in log:
+            if line.startswith(LOG_KEY):
+                result_str = line[len(LOG_KEY):]
+                result = eval(result_str)
+                return result
+
+        raise Exception("No viewport performance result found in log.")
+
+
+def generate(env):
+    return [
+        ViewportTest('objects', objects_num=10000),
+        ViewportTest('edit_mesh', resolution=1000),
+        ViewportTest('overlays', resolution=1000),
+    ]